@@ -0,0 +1,182 @@
+/*******************************************************************************
+* K65TWR_OSTick.c - Dynamic (tickless) uC/OS-III tick for the K65TWR
+*
+* With OS_CFG_DYN_TICK_EN the kernel calls BSP_OS_TickNextSet() with the number
+* of ticks, counted from OSTickCtr, to the next delay or timeout. LPTMR0 is
+* programmed to interrupt then, and the interrupt hands every tick that has
+* passed since the previous one to OSTimeDynTick(). Between interrupts the
+* idle task sleeps with WFI.
+*
+* LPTMR0 runs from the 1kHz LPO so it keeps counting in low power modes. The
+* tick rate must divide 1kHz. The compare register is 16 bits, so a step is at
+* most 65536 counts; longer waits take more than one interrupt.
+*
+* Notes:
+*   OS_CFG_DYN_TICK_EN is disabled by default. The LPO is not trimmed, so
+*   time kept by this tick drifts from the crystal derived SysTick.
+*   Restarting the timer for an earlier deadline drops the part of the LPO
+*   count in progress, less than 1ms.
+*   Round-robin time slicing is not driven by the dynamic tick.
+*   The statistic task CPU usage counts sleep time as busy time.
+*
+* Dominic Danis, 10/18/2026
+ ******************************************************************************/
+#include "os.h"
+#include "MCUType.h"
+#include "K65TWR_OSTick.h"
+
+#if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+
+#define OSTICK_LPO_HZ   1000u
+#define OSTICK_CNTS     (OSTICK_LPO_HZ/OS_CFG_TICK_RATE_HZ)     /* LPTMR counts per tick */
+#define OSTICK_STEP_MAX (0x10000u/OSTICK_CNTS)                  /* Longest step, 16-bit CMR */
+
+#if (OS_CFG_TICK_RATE_HZ > OSTICK_LPO_HZ) || ((OSTICK_LPO_HZ % OS_CFG_TICK_RATE_HZ) != 0u)
+#error "K65TWR_OSTick: OS_CFG_TICK_RATE_HZ must divide the 1kHz LPO"
+#endif
+
+static CPU_BOOLEAN osTickRunning = DEF_FALSE;
+static OS_TICK osTickUnannounced;   /* Ticks from the last OSTimeDynTick() to the period start */
+static OS_TICK osTickPeriod;        /* Ticks in the current LPTMR period */
+
+static OS_TICK osTickElapsed(void);
+static void osTickStart(OS_TICK step);
+static void osTickIdle(void);
+
+/*******************************************************************************
+* BSP_OS_TickInit - Starts LPTMR0 as the kernel tick and installs the idle
+*                   hook that sleeps between deadlines. Call it from the first
+*                   task in place of OS_CPU_SysTickInitFreq().
+ ******************************************************************************/
+void BSP_OS_TickInit(void){
+    CPU_SR_ALLOC();
+
+    SIM->SCGC5 |= SIM_SCGC5_LPTMR_MASK;                 /* Enable clock gate for LPTMR */
+    LPTMR0->CSR = 0u;
+    LPTMR0->PSR = LPTMR_PSR_PCS(1)|LPTMR_PSR_PBYP_MASK; /* 1kHz LPO, no prescaler */
+
+    CPU_CRITICAL_ENTER();
+    osTickUnannounced = 0u;
+    osTickStart(OSTICK_STEP_MAX);
+    osTickRunning = DEF_TRUE;
+    if(OS_AppIdleTaskHookPtr == (OS_APP_HOOK_VOID)0){
+        OS_AppIdleTaskHookPtr = osTickIdle;
+    }else{}
+    CPU_CRITICAL_EXIT();
+    (void)BSP_OS_TickNextSet(OSTickCtrStep);            /* Delays made before the timer ran */
+
+    NVIC_ClearPendingIRQ(LPTMR0_IRQn);
+    NVIC_EnableIRQ(LPTMR0_IRQn);
+}
+
+/*******************************************************************************
+* BSP_OS_TickGet - Returns the current tick count, including the ticks that
+*                  have passed but have not been given to the kernel yet.
+ ******************************************************************************/
+OS_TICK BSP_OS_TickGet(void){
+    OS_TICK ticks;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    ticks = OSTickCtr + OSTickCtrPend;
+    if(osTickRunning != DEF_FALSE){
+        ticks += osTickElapsed();
+    }else{}
+    CPU_CRITICAL_EXIT();
+    return ticks;
+}
+
+/*******************************************************************************
+* BSP_OS_TickNextSet - Sets the next tick interrupt 'ticks' ticks after
+*                      OSTickCtr, or as far as the timer allows for
+*                      (OS_TICK)-1. A deadline that has already passed fires
+*                      on the next LPO count. Returns the ticks from now to
+*                      the interrupt.
+ ******************************************************************************/
+OS_TICK BSP_OS_TickNextSet(OS_TICK ticks){
+    OS_TICK elapsed;
+    OS_TICK now;
+    OS_TICK step;
+    CPU_SR_ALLOC();
+
+    if(osTickRunning == DEF_FALSE){                     /* BSP_OS_TickInit() picks it up */
+        return ticks;
+    }else{}
+    CPU_CRITICAL_ENTER();
+    elapsed = osTickElapsed();
+    now = OSTickCtrPend + elapsed;                      /* Ticks past OSTickCtr */
+    if(ticks == (OS_TICK)-1){
+        step = OSTICK_STEP_MAX;
+    }else if(ticks <= now){                             /* Already due */
+        step = 1u;
+    }else if((ticks - now) > OSTICK_STEP_MAX){
+        step = OSTICK_STEP_MAX;
+    }else{
+        step = ticks - now;
+    }
+    /* Leave the timer alone when the current period already ends there */
+    if((elapsed + step) != (osTickUnannounced + osTickPeriod)){
+        osTickUnannounced = elapsed;
+        osTickStart(step);
+    }else{}
+    CPU_CRITICAL_EXIT();
+    return step;
+}
+
+/*******************************************************************************
+* LPTMR0_IRQHandler - End of an LPTMR period. Passes the ticks since the last
+*                     interrupt to the kernel. The timer keeps running with
+*                     the same period until the tick task sets the next one.
+ ******************************************************************************/
+void LPTMR0_IRQHandler(void){
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    if((LPTMR0->CSR & LPTMR_CSR_TCF_MASK) != 0u){      /* Not cleared by a restart */
+        LPTMR0->CSR = LPTMR_CSR_TCF_MASK|LPTMR_CSR_TIE_MASK|LPTMR_CSR_TEN_MASK;
+        OSTimeDynTick(osTickUnannounced + osTickPeriod);
+        osTickUnannounced = 0u;
+    }else{}
+    CPU_CRITICAL_EXIT();
+    OSIntExit();
+}
+
+/*******************************************************************************
+* osTickElapsed - Ticks since the last OSTimeDynTick(). Call with interrupts
+*                 disabled. The counter is latched by writing CNR.
+ ******************************************************************************/
+static OS_TICK osTickElapsed(void){
+    OS_TICK ticks;
+    INT32U cnt;
+
+    ticks = osTickUnannounced;
+    LPTMR0->CNR = 0u;
+    cnt = LPTMR0->CNR;
+    if((LPTMR0->CSR & LPTMR_CSR_TCF_MASK) != 0u){      /* Period ended, interrupt pending */
+        LPTMR0->CNR = 0u;                               /* Read again, counter restarted at 0 */
+        cnt = LPTMR0->CNR;
+        ticks += osTickPeriod;
+    }else{}
+    return ticks + (OS_TICK)(cnt/OSTICK_CNTS);
+}
+
+/*******************************************************************************
+* osTickStart - Restarts LPTMR0 for a period of 'step' ticks. Disabling the
+*               timer clears CNR and TCF, CMR can only be written then.
+ ******************************************************************************/
+static void osTickStart(OS_TICK step){
+    LPTMR0->CSR = 0u;
+    LPTMR0->CMR = (step*OSTICK_CNTS) - 1u;
+    LPTMR0->CSR = LPTMR_CSR_TIE_MASK|LPTMR_CSR_TEN_MASK;
+    osTickPeriod = step;
+}
+
+/*******************************************************************************
+* osTickIdle - Idle task hook. Sleeps until the next interrupt.
+ ******************************************************************************/
+static void osTickIdle(void){
+    __WFI();
+}
+
+#endif
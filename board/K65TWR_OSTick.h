@@ -0,0 +1,24 @@
+/*******************************************************************************
+* K65TWR_OSTick.h - Dynamic (tickless) uC/OS-III tick for the K65TWR
+*
+* Used when OS_CFG_DYN_TICK_EN is enabled in os_cfg.h. The kernel tick comes
+* from LPTMR0, clocked by the 1kHz LPO, instead of SysTick. The timer is set
+* to interrupt at the next tick list deadline only, so while every task is
+* blocked the CPU sleeps in the idle task.
+*
+* BSP_OS_TickGet() and BSP_OS_TickNextSet() are declared in os.h.
+*
+* Dominic Danis, 10/18/2026
+ ******************************************************************************/
+
+#ifndef K65TWR_OSTICK_H_
+#define K65TWR_OSTICK_H_
+
+/*******************************************************************************
+* BSP_OS_TickInit - Starts LPTMR0 as the kernel tick and installs the idle
+*                   hook that sleeps between deadlines. Call it from the first
+*                   task in place of OS_CPU_SysTickInitFreq().
+ ******************************************************************************/
+void BSP_OS_TickInit(void);
+
+#endif /* K65TWR_OSTICK_H_ */
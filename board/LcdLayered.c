@@ -24,6 +24,11 @@
 * 03/13/2019 Changed LcdCursorDispMode() to be private, now lcdCursorDispMode(). BJC
 * 02/18/2020 Fixed col input error check. TDM
 * 1/24/2022  Ported code for displaying hexword from LCD module. Code by TDM, ported by Dominic Danis
+* 10/18/2026 Geometry from app_cfg.h, generated row addresses and per-row dirty mask.
+* 10/18/2026 Added per-layer viewports and the marquee.
+* 10/18/2026 Added optional 8-bit bus and busy flag polling.
+* 10/18/2026 Added the refresh rate governor and LcdStatsGet().
+* 10/18/2026 Added APP_CFG_LCD_1X16_SPLIT for 1x16 modules addressed as 2x8.
 *****************************************************************************************
 * Header Files - Dependencies
 *****************************************************************************************/
@@ -34,32 +39,127 @@
 #include "K65TWR_GPIO.h"
 #include "math.h"
 
+/*****************************************************************************************
+* LCD Bus Options - Set in app_cfg.h, both default to off
+*   APP_CFG_LCD_BUS_8BIT  - 8-bit data bus. DB4-DB7 stay on PTD3-PTD6 and
+*                           DB0-DB3 are added on PTD7-PTD10.
+*   APP_CFG_LCD_BUSY_POLL - Poll the busy flag (DB7) instead of waiting the
+*                           worst case time after each write. Needs R/W on
+*                           PTD0 and a panel whose outputs are safe at 3.3V.
+*****************************************************************************************/
+#ifdef APP_CFG_LCD_BUS_8BIT
+#define LCD_BUS_8BIT_EN APP_CFG_LCD_BUS_8BIT
+#else
+#define LCD_BUS_8BIT_EN 0
+#endif
+
+#ifdef APP_CFG_LCD_BUSY_POLL
+#define LCD_BUSY_POLL_EN APP_CFG_LCD_BUSY_POLL
+#else
+#define LCD_BUSY_POLL_EN 0
+#endif
+
 /*****************************************************************************************
 * LCD Port Defines 
 *****************************************************************************************/
+#define LCD_RW_BIT     0x1
 #define LCD_RS_BIT     0x2
 #define LCD_E_BIT      0x4
+#define LCD_DB7_BIT    0x40
+#if LCD_BUS_8BIT_EN
+#define LCD_DB_MASK    0x7F8
+#else
 #define LCD_DB_MASK    0x78
+#endif
+#if LCD_BUSY_POLL_EN
+#define LCD_CTRL_MASK  (LCD_RW_BIT|LCD_RS_BIT|LCD_E_BIT)
+#else
+#define LCD_CTRL_MASK  (LCD_RS_BIT|LCD_E_BIT)
+#endif
 #define LCD_PORT       GPIOD->PDOR
 #define LCD_PORT_DIR   GPIOD->PDDR
-#define INIT_BIT_DIR() (LCD_PORT_DIR |= (LCD_RS_BIT|LCD_E_BIT|LCD_DB_MASK))
+#define INIT_BIT_DIR() (LCD_PORT_DIR |= (LCD_CTRL_MASK|LCD_DB_MASK))
 #define LCD_SET_RS()   GPIOD->PSOR = LCD_RS_BIT
 #define LCD_CLR_RS()   GPIOD->PCOR = LCD_RS_BIT
 #define LCD_SET_E()    GPIOD->PSOR = LCD_E_BIT
 #define LCD_CLR_E()    GPIOD->PCOR = LCD_E_BIT
+#define LCD_SET_RW()   GPIOD->PSOR = LCD_RW_BIT
+#define LCD_CLR_RW()   GPIOD->PCOR = LCD_RW_BIT
+#define LCD_DB_IN()    (LCD_PORT_DIR &= ~LCD_DB_MASK)
+#define LCD_DB_OUT()   (LCD_PORT_DIR |= LCD_DB_MASK)
+#define LCD_RD_BUSY()  ((GPIOD->PDIR & LCD_DB7_BIT) != 0)
 #define LCD_WR_DB(nib) (GPIOD->PDOR = (GPIOD->PDOR & ~LCD_DB_MASK)|((nib)<<3))
+#define LCD_WR_DB8(byte) (GPIOD->PDOR = (GPIOD->PDOR & ~LCD_DB_MASK)           \
+                                        |(((byte)>>4)<<3)|(((byte)&0x0F)<<7))
+#if LCD_BUS_8BIT_EN
+#define LCD_WR_RESET() LCD_WR_DB8(0x30)
+#else
+#define LCD_WR_RESET() LCD_WR_DB(0x3)
+#endif
+
+// Worst case execution time waits. Not needed when polling the busy flag.
+#if LCD_BUSY_POLL_EN
+#define LCD_EXEC_DLY(us)
+#else
+#define LCD_EXEC_DLY(us) lcdDlyus(us)
+#endif
+#define LCD_BUSY_TOUT  4000u   //Busy polls before giving up, > 4ms
+
+/*****************************************************************************************
+* Refresh Governor - APP_CFG_LCD_FRAME_TICKS in app_cfg.h is the minimum number of
+*   ticks between frames. Changes inside a frame interval are coalesced into one frame
+*   at the next frame boundary. The first change after an idle interval is drawn
+*   immediately. 0 draws every change as soon as possible.
+*****************************************************************************************/
+#ifdef APP_CFG_LCD_FRAME_TICKS
+#define LCD_FRAME_TICKS APP_CFG_LCD_FRAME_TICKS
+#else
+#define LCD_FRAME_TICKS 0u
+#endif
 
 
 /*****************************************************************************************
 * LCD Defines                                                                            *
 *****************************************************************************************/
-// LCD Configuration
-#define LCD_NUM_ROWS   2
-#define LCD_NUM_COLS   16
-
+// LCD Configuration - LCD_NUM_ROWS and LCD_NUM_COLS come from LcdLayered.h
 #define LCD_ENABLE     0x04
 #define LCD_CLEAR_BYTE 0x20    //SPACE is set as the transparent character
 
+// HD44780 DD RAM row start addresses. Rows 3 and 4 continue rows 1 and 2.
+#define LCD_ROW_ADDR_1 0x00u
+#define LCD_ROW_ADDR_2 0x40u
+#define LCD_ROW_ADDR_3 (LCD_ROW_ADDR_1 + LCD_NUM_COLS)
+#define LCD_ROW_ADDR_4 (LCD_ROW_ADDR_2 + LCD_NUM_COLS)
+
+// A split 1x16 shows the second DD RAM line from column 9
+#define LCD_SPLIT_COLS (LCD_NUM_COLS / 2u)
+#define LCD_DD_ADDR(row_index, col_index) \
+    (((LCD_1X16_SPLIT != 0u) && ((col_index) >= LCD_SPLIT_COLS)) ? \
+     (LCD_ROW_ADDR_2 + (col_index) - LCD_SPLIT_COLS) : (lcdRowAddress[row_index] + (col_index)))
+
+// Function set N bit, two line mode for every panel except a true 1x16
+#define LCD_FUNC_LINES (((LCD_NUM_ROWS > 1u) || (LCD_1X16_SPLIT != 0u)) ? 1u : 0u)
+
+// Per-row dirty mask. Bit n set means row n+1 of a layer has changed.
+typedef INT8U LCD_ROW_MASK;
+#define LCD_ROW_BIT(row_index) ((LCD_ROW_MASK)(1u << (row_index)))
+#define LCD_ALL_ROWS           ((LCD_ROW_MASK)((1u << LCD_NUM_ROWS) - 1u))
+
+// Compile time checks on the configured geometry
+#define LCD_CT_ASSERT(name, cond) typedef char lcd_ct_assert_##name[(cond) ? 1 : -1]
+LCD_CT_ASSERT(dirty_mask_width, LCD_NUM_ROWS <= (8u * sizeof(LCD_ROW_MASK)));
+LCD_CT_ASSERT(dd_ram_range, (LCD_ROW_ADDR_2 + LCD_NUM_COLS) <= 0x68u);
+
+// DD RAM line length, the display shift wraps around at this column
+#define LCD_DDRAM_LINE ((LCD_FUNC_LINES != 0u) ? 40u : 80u)
+
+// The display shift moves every row, so it is only usable for a marquee
+// when each panel row is its own DD RAM line and the layer fits the line.
+#define LCD_MARQUEE_HW_EN ((LCD_NUM_ROWS <= 2u) && (LCD_1X16_SPLIT == 0u) && \
+                           (LCD_LAYER_COLS <= LCD_DDRAM_LINE))
+#define LCD_MARQUEE_COLS  (LCD_MARQUEE_HW_EN ? LCD_DDRAM_LINE : LCD_LAYER_COLS)
+#define LCD_NO_MARQUEE    LCD_NUM_LAYERS
+
 // LCD Cursor typedef
 typedef struct {
     INT8U col;
@@ -68,24 +168,55 @@ typedef struct {
     INT8U blink;
 }LCD_CURSOR;
 
-// LCD layer and buffer typdedef
+// LCD buffer typdedef
 typedef struct {
     INT8C lcd_char[LCD_NUM_ROWS][LCD_NUM_COLS];
     INT8U hidden;
     LCD_CURSOR cursor;
 } LCD_BUFFER;
 
+// LCD layer typedef, org_row/org_col is the layer position at panel 1,1
+typedef struct {
+    INT8C lcd_char[LCD_LAYER_ROWS][LCD_LAYER_COLS];
+    INT8U hidden;
+    LCD_CURSOR cursor;
+    INT8U org_row;
+    INT8U org_col;
+} LCD_LAYER;
+
+// Marquee state, handed to lcdLayeredTask through lcdFlattenLayers()
+typedef struct {
+    INT8U layer;      // Layer being scrolled, LCD_NO_MARQUEE when off
+    INT8U mode_chg;   // Set when a marquee is started or stopped
+    INT8S shift;      // Display shift steps not yet sent to the LCD
+} LCD_MARQUEE;
+
 /*************************************************************************
   Private Local Functions
 *************************************************************************/
 static void lcdDlyus(INT16U us);
 static void lcdDly500ns(void);
 static void lcdWrite(INT16U data);
+#if LCD_BUSY_POLL_EN
+static void lcdWaitReady(void);
+#endif
 static void lcdClear(LCD_BUFFER *buffer);
-
-static void lcdFlattenLayers(LCD_BUFFER *dest_buffer,
-                             LCD_BUFFER *src_layers);
-static void lcdWriteBuffer(LCD_BUFFER *buffer);
+static void lcdClearLayer(LCD_LAYER *layer);
+#if LCD_MARQUEE_HW_EN
+static void lcdInvalidate(LCD_BUFFER *buffer);
+static void lcdInvalidateMarquee(void);
+#endif
+static void lcdMarkRow(LCD_LAYER *layer, INT8U row_index);
+static void lcdPostChange(void);
+static void lcdSetOrigin(LCD_LAYER *layer, INT16S org_row, INT16S org_col);
+
+static LCD_ROW_MASK lcdFlattenLayers(LCD_BUFFER *dest_buffer,
+                                     LCD_LAYER *src_layers,
+                                     LCD_MARQUEE *marquee);
+static void lcdWriteBuffer(LCD_BUFFER *buffer, LCD_ROW_MASK rows);
+#if LCD_MARQUEE_HW_EN
+static void lcdWriteMarquee(LCD_ROW_MASK rows, INT8S shift);
+#endif
 static void lcdMoveCursor(INT8U row, INT8U col);
 static void lcdCursorDispMode(INT8U on, INT8U blink);
 static INT8C lcdHtoA(INT8U hnib);
@@ -102,12 +233,30 @@ static CPU_STK  lcdLayeredTaskStk[APP_CFG_LCD_TASK_STK_SIZE];
   Global Variables
 *************************************************************************/
 // Stored Constants
-static const INT8U lcdRowAddress[LCD_NUM_ROWS] = {0x00, 0x40};
+static const INT8U lcdRowAddress[LCD_NUM_ROWS] = {
+    LCD_ROW_ADDR_1,
+#if LCD_NUM_ROWS >= 2u
+    LCD_ROW_ADDR_2,
+#endif
+#if LCD_NUM_ROWS >= 4u
+    LCD_ROW_ADDR_3,
+    LCD_ROW_ADDR_4,
+#endif
+};
 
 // Static Globals
 static LCD_BUFFER lcdBuffer;
 static LCD_BUFFER lcdPreviousBuffer;
-static LCD_BUFFER lcdLayers[LCD_NUM_LAYERS];
+static LCD_LAYER lcdLayers[LCD_NUM_LAYERS];
+static LCD_ROW_MASK lcdDirtyRows;    //Rows changed since last flatten
+static LCD_MARQUEE lcdMarquee = {LCD_NO_MARQUEE, 0, 0};
+static LCD_STATS lcdStats;
+static INT32U lcdPostCnt;            //Posts since the last frame was started
+static OS_TICK lcdPostTick;          //Tick of the first of those posts
+#if LCD_MARQUEE_HW_EN
+static INT8C lcdMarqueeLines[LCD_NUM_ROWS][LCD_DDRAM_LINE];
+static INT8C lcdMarqueeDDRam[LCD_NUM_ROWS][LCD_DDRAM_LINE];   //Copy of the DD RAM lines
+#endif
 
 /*************************************************************************
   LCD Command Macros
@@ -154,9 +303,20 @@ static LCD_BUFFER lcdLayers[LCD_NUM_LAYERS];
         When writing to the LCD, will block until thescreen is updated.  
         This is worst-case x.xms, but will be much lower if not every character 
         on the screen is changing.
+
+        Posts that arrive before a frame is drawn are folded into that frame.
+        A change less than LCD_FRAME_TICKS after the last frame waits for
+        the frame boundary. Staleness is counted from the first post folded
+        into a frame to the start of that frame.
 ******************************************************************************/
 static void lcdLayeredTask(void *p_arg) {
     OS_ERR os_err;
+    LCD_ROW_MASK rows;
+    LCD_MARQUEE marquee;
+    INT32U posts;
+    OS_TICK changed;
+    OS_TICK frame = 0;
+    CPU_SR_ALLOC();
     
     // Avoid compiler warning
     (void)p_arg;
@@ -165,11 +325,63 @@ static void lcdLayeredTask(void *p_arg) {
     
         // Wait for an lcd layer to be modified
     	DB4_TURN_OFF();
-        OSTaskSemPend(0,OS_OPT_PEND_BLOCKING,(CPU_TS *)0, &os_err);
+        (void)OSTaskSemPend(0,OS_OPT_PEND_BLOCKING,(CPU_TS *)0, &os_err);
     	DB4_TURN_ON();
+        changed = OSTimeGet(&os_err);
+
+#if LCD_FRAME_TICKS > 0
+        // Inside the frame interval, coalesce until the frame boundary
+        if((lcdStats.frames_drawn != 0) && ((OS_TICK)(changed - frame) < LCD_FRAME_TICKS)){
+            OSTimeDly((OS_TICK)(LCD_FRAME_TICKS - (changed - frame)), OS_OPT_TIME_DLY, &os_err);
+        }else{
+        }
+#endif
+        // Fold posts made since the last frame into this frame
+        (void)OSTaskSemSet((OS_TCB *)0, 0, &os_err);
+        CPU_CRITICAL_ENTER();
+        posts = lcdPostCnt;
+        changed = lcdPostTick;
+        lcdPostCnt = 0;
+        CPU_CRITICAL_EXIT();
+        if(posts == 0){
+            continue;   //Woken by a post already folded into the last frame
+        }else{
+        }
+        frame = OSTimeGet(&os_err);
+
+        CPU_CRITICAL_ENTER();
+        lcdStats.frames_drawn++;
+        lcdStats.frames_skipped += posts - 1;
+        if((INT32U)(frame - changed) > lcdStats.max_stale_ticks){
+            lcdStats.max_stale_ticks = (INT32U)(frame - changed);
+        }else{
+        }
+        CPU_CRITICAL_EXIT();
         
-        lcdFlattenLayers(&lcdBuffer, (LCD_BUFFER *)&lcdLayers);
-        lcdWriteBuffer(&lcdBuffer);
+        rows = lcdFlattenLayers(&lcdBuffer, lcdLayers, &marquee);
+#if LCD_MARQUEE_HW_EN
+        if(marquee.mode_chg != 0){
+            // Undo any display shift, the DD RAM no longer matches
+            // lcdPreviousBuffer so force every character to be rewritten
+            lcdWrite(LCD_CUR_HOME());
+            LCD_EXEC_DLY(1520);
+            lcdInvalidate(&lcdPreviousBuffer);
+            lcdInvalidateMarquee();
+            if(marquee.layer != LCD_NO_MARQUEE){
+                lcdCursorDispMode(FALSE, FALSE);
+            }else{
+            }
+            rows = LCD_ALL_ROWS;
+        }else{
+        }
+        if(marquee.layer != LCD_NO_MARQUEE){
+            lcdWriteMarquee(rows, marquee.shift);
+        }else{
+            lcdWriteBuffer(&lcdBuffer, rows);
+        }
+#else
+        lcdWriteBuffer(&lcdBuffer, rows);
+#endif
     }
 }
 
@@ -187,7 +399,8 @@ INT8U LcdCursor(INT8U row, INT8U col, INT8U layer, INT8U on, INT8U blink){
     
     OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
 
-    if ((layer < LCD_NUM_LAYERS) && (col <= LCD_NUM_COLS) && (row <= LCD_NUM_ROWS)){
+    if ((layer < LCD_NUM_LAYERS) && (col >= 1) && (col <= LCD_NUM_COLS) &&
+        (row >= 1) && (row <= LCD_NUM_ROWS)){
         lcdLayers[layer].cursor.col = col;
         lcdLayers[layer].cursor.row = row;
         if ( blink ){
@@ -207,7 +420,7 @@ INT8U LcdCursor(INT8U row, INT8U col, INT8U layer, INT8U on, INT8U blink){
     (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
 
     // We have modified a layer
-    (void)OSTaskSemPost(&lcdLayeredTaskTCB, OS_OPT_POST_NONE, &os_err);
+    lcdPostChange();
 
     return(noerr);
 }
@@ -219,20 +432,21 @@ INT8U LcdCursor(INT8U row, INT8U col, INT8U layer, INT8U on, INT8U blink){
 *************************************************************************/
 void LcdDispClear(INT8U layer) {
     OS_ERR os_err;
-    LCD_BUFFER *llayer = &lcdLayers[layer];
+    LCD_LAYER *llayer = &lcdLayers[layer];
 
     OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
     while(os_err != OS_ERR_NONE){           /* Error Trap                        */
     }
 
-    lcdClear(llayer);
+    lcdClearLayer(llayer);
+    lcdDirtyRows = LCD_ALL_ROWS;
 
     (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
     while(os_err != OS_ERR_NONE){           /* Error Trap                        */
     }
     
     // We have modified a layer
-    (void)OSTaskSemPost(&lcdLayeredTaskTCB, OS_OPT_POST_NONE, &os_err);
+    lcdPostChange();
 }
 
 
@@ -246,25 +460,26 @@ void LcdDispClrLine(INT8U row, INT8U layer) {
     INT8U col;
     OS_ERR os_err;
     
-    LCD_BUFFER *llayer = &lcdLayers[layer];
+    LCD_LAYER *llayer = &lcdLayers[layer];
     
     OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
     while(os_err != OS_ERR_NONE){           /* Error Trap                        */
     }
     
     // For each column...
-    for(col = 0; col < LCD_NUM_COLS; col++) {
+    for(col = 0; col < LCD_LAYER_COLS; col++) {
 
         // Clear the character at that position
         llayer->lcd_char[row-1][col] = LCD_CLEAR_BYTE;
     }
+    lcdMarkRow(llayer, row-1);
     
     (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
     while(os_err != OS_ERR_NONE){           /* Error Trap                        */
     }
     
     // We have modified a layer
-    (void)OSTaskSemPost(&lcdLayeredTaskTCB,OS_OPT_POST_NONE,&os_err);
+    lcdPostChange();
 }
 
 
@@ -283,7 +498,7 @@ void LcdDispString(INT8U row,
     INT8U cnt;
     INT8U row_index;
     INT8U col_index;
-    LCD_BUFFER *llayer = &lcdLayers[layer];
+    LCD_LAYER *llayer = &lcdLayers[layer];
 
     row_index = row - 1;
     col_index = col - 1;
@@ -295,19 +510,20 @@ void LcdDispString(INT8U row,
     // Iterate through the string until we reach a null
     for(cnt = 0; string[cnt] != 0x00; cnt++) {
     
-        if((col_index+cnt) < LCD_NUM_COLS){ // not at end of row
+        if((col_index+cnt) < LCD_LAYER_COLS){ // not at end of row
             // Copy from the passed paramater to the layer
             llayer->lcd_char[row_index][col_index+cnt] = string[cnt];
         }else{ //outside buffer
         }
     }
+    lcdMarkRow(llayer, row_index);
     
     (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
     while(os_err != OS_ERR_NONE){           /* Error Trap                        */
     }
     
     // We have modified a layer
-    (void)OSTaskSemPost(&lcdLayeredTaskTCB,OS_OPT_POST_NONE,&os_err);
+    lcdPostChange();
 }
 
 
@@ -325,25 +541,26 @@ void LcdDispChar(INT8U row,
     OS_ERR os_err;
     INT8U row_index;
     INT8U col_index;
-    LCD_BUFFER *llayer = &lcdLayers[layer];
+    LCD_LAYER *llayer = &lcdLayers[layer];
 
     row_index = row - 1;
     col_index = col - 1;
     
-    if(col_index < LCD_NUM_COLS){
+    if(col_index < LCD_LAYER_COLS){
         OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
         while(os_err != OS_ERR_NONE){           /* Error Trap                        */
         }
     
         // Copy from the passed paramater to the layer
         llayer->lcd_char[row_index][col_index] = character;
+        lcdMarkRow(llayer, row_index);
     
         (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
         while(os_err != OS_ERR_NONE){           /* Error Trap                        */
         }
     
         // We have modified a layer
-        (void)OSTaskSemPost(&lcdLayeredTaskTCB,OS_OPT_POST_NONE,&os_err);
+        lcdPostChange();
     }else{ //outside layer
     }
 }
@@ -361,13 +578,13 @@ void LcdDispByte(INT8U row, INT8U col, INT8U layer, INT8U byte) {
     OS_ERR os_err;
     INT8U row_index;
     INT8U col_index;
-    LCD_BUFFER *llayer = &lcdLayers[layer];
+    LCD_LAYER *llayer = &lcdLayers[layer];
     
     // Convert row / col index 1 to index 0
     row_index = row - 1;
     col_index = col - 1;
     
-    if(col < LCD_NUM_COLS){
+    if(col < LCD_LAYER_COLS){
         OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
         while(os_err != OS_ERR_NONE){           /* Error Trap                        */
         }
@@ -382,14 +599,14 @@ void LcdDispByte(INT8U row, INT8U col, INT8U layer, INT8U byte) {
         // Convert LSB to ASCII character
         llayer->lcd_char[row_index][col_index+1] +=
             (llayer->lcd_char[row_index][col_index+1] <= 9 ? '0' : 'A' - 10);
-
+        lcdMarkRow(llayer, row_index);
 
         (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
         while(os_err != OS_ERR_NONE){           /* Error Trap                        */
         }
 
         // We have modified a layer
-        (void)OSTaskSemPost(&lcdLayeredTaskTCB,OS_OPT_POST_NONE,&os_err);
+        lcdPostChange();
         while(os_err != OS_ERR_NONE){           /* Error Trap                        */
         }
     }else{ //outside layer
@@ -429,15 +646,11 @@ void LcdDispDecWord(INT8U row,
     INT8U align_left_offset;
     INT8U align_left_flag = 0;
 
-    INT8U row_index;
-    INT8U col_index;
-    LCD_BUFFER *llayer = &lcdLayers[layer];
-
-    if((col) <= LCD_NUM_COLS){
-        //Convert row / col index 1 to index 0
-        row_index = row - 1;
-        col_index = col - 1;
+    INT8U row_index = row - 1;
+    INT8U col_index = col - 1;
+    LCD_LAYER *llayer = &lcdLayers[layer];
 
+    if((col) <= LCD_LAYER_COLS){
         //Clamp leading zeros to acceptable values
         if(num_zeros > 10){
             num_zeros = 10;
@@ -448,6 +661,10 @@ void LcdDispDecWord(INT8U row,
     }else{
     }
 
+    OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
     //Calculates maximum bin parameter
     max_field_num = pow(10,field) - 1;
     if(lbinword > max_field_num){  //Writes '-' to all field slots if bin length exceeded
@@ -476,10 +693,6 @@ void LcdDispDecWord(INT8U row,
             }
         }
 
-        OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
-        while(os_err != OS_ERR_NONE){           /* Error Trap                        */
-        }
-
         //Display ascii digits
         dig_num = 9;
         while(dig_num > 0){
@@ -501,13 +714,16 @@ void LcdDispDecWord(INT8U row,
         }else if(mode == LCD_DEC_MODE_AL){
             llayer->lcd_char[row_index][col_index+field-dig_num-align_left_offset] = digits[0];
         }else{
-        }(void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
-         while(os_err != OS_ERR_NONE){           /* Error Trap                        */
-         }
+        }
+    }
+    lcdMarkRow(llayer, row_index);
+
+    (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
     }
 
     //We have modified a layer
-    (void)OSTaskSemPost(&lcdLayeredTaskTCB,OS_OPT_POST_NONE,&os_err);
+    lcdPostChange();
     while(os_err != OS_ERR_NONE){           /* Error Trap                        */
     }
 
@@ -528,9 +744,9 @@ void LcdDispTime(INT8U row,
     OS_ERR os_err;
     INT8U row_index;
     INT8U col_index;
-    LCD_BUFFER *llayer = &lcdLayers[layer];
+    LCD_LAYER *llayer = &lcdLayers[layer];
 
-    if((col + 6) < LCD_NUM_COLS){
+    if((col + 6) < LCD_LAYER_COLS){
         // Convert row / col index 1 to index 0
         row_index = row - 1;
         col_index = col - 1;
@@ -553,6 +769,7 @@ void LcdDispTime(INT8U row,
 
         llayer->lcd_char[row_index][col_index+6] = secs / 10 + '0';
         llayer->lcd_char[row_index][col_index+7] = secs % 10 + '0';
+        lcdMarkRow(llayer, row_index);
     
            
         (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
@@ -560,7 +777,7 @@ void LcdDispTime(INT8U row,
         }
     
         // We have modified a layer
-        (void)OSTaskSemPost(&lcdLayeredTaskTCB,OS_OPT_POST_NONE,&os_err);
+        lcdPostChange();
     }else{ //outside layer
     }
 }
@@ -606,47 +823,64 @@ void LcdInit(void) {
     PORTD->PCR[4]=(0|PORT_PCR_MUX(1));
     PORTD->PCR[5]=(0|PORT_PCR_MUX(1));
     PORTD->PCR[6]=(0|PORT_PCR_MUX(1));
+#if LCD_BUSY_POLL_EN
+    PORTD->PCR[0]=(0|PORT_PCR_MUX(1));
+#endif
+#if LCD_BUS_8BIT_EN
+    PORTD->PCR[7]=(0|PORT_PCR_MUX(1));
+    PORTD->PCR[8]=(0|PORT_PCR_MUX(1));
+    PORTD->PCR[9]=(0|PORT_PCR_MUX(1));
+    PORTD->PCR[10]=(0|PORT_PCR_MUX(1));
+#endif
     INIT_BIT_DIR();
     LCD_CLR_E(); 
+#if LCD_BUSY_POLL_EN
+    LCD_CLR_RW();           /*Write unless in lcdWaitReady() */
+#endif
     LCD_SET_RS();           /*Data select unless in LcdWrCmd()  */
     lcdDlyus(15000);           /* LCD requires 15ms delay at powerup */
    
     LCD_CLR_RS();           /*Send first command for RESET sequence*/
-    LCD_WR_DB(0x3);
+    LCD_WR_RESET();
     LCD_SET_E();
     lcdDly500ns();
     LCD_CLR_E();
     lcdDlyus(4200);            /*Wait >4.1ms */
   
-    LCD_WR_DB(0x3);         /*Repeat */
+    LCD_WR_RESET();         /*Repeat */
     LCD_SET_E();
     lcdDly500ns();
     LCD_CLR_E();
     lcdDlyus(101);            /*Wait >100us */
   
-    LCD_WR_DB(0x3);         /* Repeat */
+    LCD_WR_RESET();         /* Repeat */
     LCD_SET_E();
     lcdDly500ns();
     LCD_CLR_E();
     lcdDlyus(41);           /*Wait >40us*/
   
+#if !LCD_BUS_8BIT_EN
     LCD_WR_DB(0x2);         /*Send last command for RESET sequence*/
     LCD_SET_E();
     lcdDly500ns();
     LCD_CLR_E();
     lcdDlyus(41);
+#endif
   
-    lcdWrite(LCD_FUNCTION(0, 1, 0));     /*Send command for 4-bit mode */
+    /*Send command for 4-bit or 8-bit mode. The busy flag is valid from here */
+    lcdWrite(LCD_FUNCTION(LCD_BUS_8BIT_EN, LCD_FUNC_LINES, 0));
     lcdWrite(LCD_ENTRY_MODE(1, 0)); // Increment, no shift
     lcdWrite(LCD_ON_OFF(1, 0, 0));  // LCD on, cursor off, blink off
     lcdWrite(LCD_CLR_DISP());       // Clear display
-    lcdDlyus(1650);
+    LCD_EXEC_DLY(1650);
     lcdWrite(LCD_DD_RAM(0x0000));   // Reset cursor
     
     
-    // Clear all of our layers
+    // Clear all of our layers, cursors start at the top left
     for(layer_cnt = 0; layer_cnt < LCD_NUM_LAYERS; layer_cnt++) {
-        lcdClear(&lcdLayers[layer_cnt]);
+        lcdClearLayer(&lcdLayers[layer_cnt]);
+        lcdLayers[layer_cnt].cursor.row = 1;
+        lcdLayers[layer_cnt].cursor.col = 1;
     }
     
     // Clear the current buffer
@@ -662,39 +896,113 @@ void LcdInit(void) {
         The src_layer with the lowest index will be on the bottom, the
         src_layer with the highest index will be on the top.  Treats the
         character defined as LCD_CLEAR_BYTE as a transparent byte.
+        Only rows marked in lcdDirtyRows are recomposed. Each layer is
+        read through its viewport origin.
+
+        While a marquee runs only the marquee layer is shown. When the
+        display shift is used the layer is copied to lcdMarqueeLines as
+        whole DD RAM lines instead of to *dest_buffer.
+
+        A snapshot of lcdMarquee is returned in *marquee and the pending
+        mode change and shift are consumed.
 
                        Pends on the lcdLayersKey mutex
+        RETURNS: The mask of rows that were recomposed
 *************************************************************************/
-static void lcdFlattenLayers(LCD_BUFFER *dest_buffer,
-                             LCD_BUFFER *src_layers) {
+static LCD_ROW_MASK lcdFlattenLayers(LCD_BUFFER *dest_buffer,
+                                     LCD_LAYER *src_layers,
+                                     LCD_MARQUEE *marquee) {
     
     INT8U layer;
     INT8U row;
     INT8U col;
+    INT8U src_row;
+    INT8U src_col;
+    INT8U shown;
     INT8U current_char;
+    LCD_LAYER *slayer;
+    LCD_ROW_MASK rows;
     OS_ERR os_err;
-    // Clear the destination buffer
-    lcdClear(dest_buffer);
 
 //    DBUG_PORT &= ~DBUG_LCDTASK;
     OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
     while(os_err != OS_ERR_NONE){           /* Error Trap                        */
     }
 //    DBUG_PORT |= DBUG_LCDTASK;
+    rows = lcdDirtyRows;
+    lcdDirtyRows = 0;
+    *marquee = lcdMarquee;
+    lcdMarquee.mode_chg = 0;
+    lcdMarquee.shift = 0;
+
+#if LCD_MARQUEE_HW_EN
+    if(marquee->layer != LCD_NO_MARQUEE) {
+        // Load whole DD RAM lines, the display shift selects the window
+        slayer = src_layers + marquee->layer;
+        for(row = 0; row < LCD_NUM_ROWS; row++) {
+            if((rows & LCD_ROW_BIT(row)) != 0) {
+                src_row = row + slayer->org_row;
+                for(col = 0; col < LCD_DDRAM_LINE; col++) {
+                    if((src_row < LCD_LAYER_ROWS) && (col < LCD_LAYER_COLS)) {
+                        lcdMarqueeLines[row][col] = slayer->lcd_char[src_row][col];
+                    }else{
+                        lcdMarqueeLines[row][col] = LCD_CLEAR_BYTE;
+                    }
+                }
+            }else{
+            }
+        }
+        (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+        while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+        }
+        return rows;
+    }else{
+    }
+#endif
+
+    // Clear the dirty rows of the destination buffer
+    for(row = 0; row < LCD_NUM_ROWS; row++) {
+        if((rows & LCD_ROW_BIT(row)) != 0) {
+            for(col = 0; col < LCD_NUM_COLS; col++) {
+                dest_buffer->lcd_char[row][col] = LCD_CLEAR_BYTE;
+            }
+        }else{
+        }
+    }
     // Set the destination buffer cursor to false initially
     dest_buffer->cursor.on = FALSE;
     dest_buffer->cursor.blink = FALSE;
 
     // For each layer...
     for(layer = 0; layer < LCD_NUM_LAYERS; layer++) {
+        slayer = src_layers + layer;
+        if(marquee->layer == LCD_NO_MARQUEE) {
+            shown = (slayer->hidden == 0);
+        }else{
+            shown = (layer == marquee->layer);
+        }
 
         // If that layer is not hidden...
-        if((src_layers+layer)->hidden == 0) {
-            // For each row...
+        if(shown) {
+            // For each dirty row...
             for(row = 0; row < LCD_NUM_ROWS; row++) {
+                src_row = row + slayer->org_row;
+                if(((rows & LCD_ROW_BIT(row)) == 0) || (src_row >= LCD_LAYER_ROWS)) {
+                    continue;
+                }else{
+                }
                 // For each column...
                 for(col = 0; col < LCD_NUM_COLS; col++) {
-                    current_char = (src_layers+layer)->lcd_char[row][col];
+                    if(layer == marquee->layer) {
+                        src_col = (col + slayer->org_col) % LCD_MARQUEE_COLS;
+                    }else{
+                        src_col = col + slayer->org_col;
+                    }
+                    if(src_col >= LCD_LAYER_COLS) {
+                        continue;                   //Outside layer - transparent
+                    }else{
+                    }
+                    current_char = slayer->lcd_char[src_row][src_col];
                 
                     // If the source layer is not null
                     if(current_char != LCD_CLEAR_BYTE) {
@@ -707,11 +1015,11 @@ static void lcdFlattenLayers(LCD_BUFFER *dest_buffer,
             } // row
 
             //Handle the cursor status
-//            if ( (src_layers+layer)->cursor.on != FALSE){
-                dest_buffer->cursor.col = (src_layers+layer)->cursor.col;
-                dest_buffer->cursor.row = (src_layers+layer)->cursor.row;
-                dest_buffer->cursor.on = (src_layers+layer)->cursor.on;
-                dest_buffer->cursor.blink = (src_layers+layer)->cursor.blink;
+//            if ( slayer->cursor.on != FALSE){
+                dest_buffer->cursor.col = slayer->cursor.col;
+                dest_buffer->cursor.row = slayer->cursor.row;
+                dest_buffer->cursor.on = slayer->cursor.on;
+                dest_buffer->cursor.blink = slayer->cursor.blink;
 //            }else{
                 // This layer doesn't move the cursor, do nothing
 //            }
@@ -722,7 +1030,7 @@ static void lcdFlattenLayers(LCD_BUFFER *dest_buffer,
     (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
     while(os_err != OS_ERR_NONE){           /* Error Trap                        */
     }
-
+    return rows;
 }
 
 
@@ -732,17 +1040,21 @@ static void lcdFlattenLayers(LCD_BUFFER *dest_buffer,
         The previous buffer lcdPreviousBuffer is a global variable
         containing a copy of the actual contents of the LCD module.  By 
         using the lcdPreviousBuffer and repos_flag, we are able to only
-        write bytes that have changed.
+        write bytes that have changed. Rows not set in rows are skipped.
                                                            
                      Blocks for as long as lcdWrite() blocks
 *************************************************************************/
-static void lcdWriteBuffer(LCD_BUFFER *buffer) {
+static void lcdWriteBuffer(LCD_BUFFER *buffer, LCD_ROW_MASK rows) {
     INT8U row;
     INT8U col;
     INT8U repos_flag;
     
-    // For each row...
+    // For each dirty row...
     for(row = 0; row < LCD_NUM_ROWS; row++) {
+        if((rows & LCD_ROW_BIT(row)) == 0) {
+            continue;
+        }else{
+        }
     
         // Set our cursor to the beginning of the row
         lcdWrite(LCD_DD_RAM(lcdRowAddress[row]));
@@ -751,13 +1063,19 @@ static void lcdWriteBuffer(LCD_BUFFER *buffer) {
         // For each column...
         for(col = 0; col < LCD_NUM_COLS; col++) {
 
+            // A split 1x16 does not continue into its second half
+            if((LCD_1X16_SPLIT != 0u) && (col == LCD_SPLIT_COLS)) {
+                repos_flag = 1;
+            }else{
+            }
+
             // If the character at the current position has changed...
             if(lcdPreviousBuffer.lcd_char[row][col]
                 != buffer->lcd_char[row][col]) {
                 
                 // If we need to reposition, do that now
                 if(repos_flag == 1) {
-                    lcdWrite(LCD_DD_RAM((lcdRowAddress[row] + col)));
+                    lcdWrite(LCD_DD_RAM(LCD_DD_ADDR(row, col)));
                     repos_flag = 0;
                 }
             
@@ -783,11 +1101,58 @@ static void lcdWriteBuffer(LCD_BUFFER *buffer) {
 
 }
 
+#if LCD_MARQUEE_HW_EN
+/*************************************************************************
+  lcdWriteMarquee() - Writes the characters of the dirty rows of     (Private)
+                      lcdMarqueeLines that differ from lcdMarqueeDDRam
+                      then sends the pending display shifts.
+                      A one column step is a single bus write.
+
+                     Blocks for as long as lcdWrite() blocks
+*************************************************************************/
+static void lcdWriteMarquee(LCD_ROW_MASK rows, INT8S shift) {
+    INT8U row;
+    INT8U col;
+    INT8U repos_flag;
+
+    for(row = 0; row < LCD_NUM_ROWS; row++) {
+        if((rows & LCD_ROW_BIT(row)) == 0) {
+            continue;
+        }else{
+        }
+        repos_flag = 1;
+        for(col = 0; col < LCD_DDRAM_LINE; col++) {
+            if(lcdMarqueeLines[row][col] != lcdMarqueeDDRam[row][col]) {
+                if(repos_flag == 1) {
+                    lcdWrite(LCD_DD_RAM(lcdRowAddress[row] + col));
+                    repos_flag = 0;
+                }else{
+                }
+                lcdWrite(LCD_WRITE(lcdMarqueeLines[row][col]));
+                lcdMarqueeDDRam[row][col] = lcdMarqueeLines[row][col];
+            }else{
+                repos_flag = 1;
+            }
+        }
+    }
+    while(shift > 0) {
+        lcdWrite(LCD_SHIFT(1, 0));      //Display left, text moves left
+        shift--;
+    }
+    while(shift < 0) {
+        lcdWrite(LCD_SHIFT(1, 1));      //Display right, text moves right
+        shift++;
+    }
+}
+#endif
+
 /******************************************************************************
   lcdWrite() - Writes a command (both data and control busses)   (Private)
                to the LCD.
                data is a 16-bit value bits 9-15 are not used, bit 8 is the 
                register select, bits 0-7 is the character or command.
+               Returns when the LCD is ready for the next write, either
+               after the busy flag clears or after the worst case 41us.
                
 ******************************************************************************/
 static void lcdWrite(INT16U data) {
@@ -801,6 +1166,12 @@ static void lcdWrite(INT16U data) {
     
     c = (INT8U)data;
     // Write character/command to LCD
+#if LCD_BUS_8BIT_EN
+    LCD_WR_DB8(c);
+    LCD_SET_E();
+    lcdDly500ns();
+    LCD_CLR_E();
+#else
     LCD_WR_DB((c>>4));
     LCD_SET_E();
     lcdDly500ns();
@@ -811,8 +1182,46 @@ static void lcdWrite(INT16U data) {
     LCD_SET_E();
     lcdDly500ns();
     LCD_CLR_E();
+#endif
+#if LCD_BUSY_POLL_EN
+    lcdWaitReady();
+#else
     lcdDlyus(41);
+#endif
+}
+
+#if LCD_BUSY_POLL_EN
+/******************************************************************************
+  lcdWaitReady() - Reads the busy flag until the LCD is ready    (Private)
+                   In 4-bit mode each read takes two E pulses, the second
+                   nibble is the address counter and is discarded.
+                   Gives up after LCD_BUSY_TOUT reads so a missing R/W
+                   line can not hang the LCD task.
+******************************************************************************/
+static void lcdWaitReady(void) {
+    INT16U tout;
+    INT8U busy = TRUE;
+
+    LCD_DB_IN();
+    LCD_CLR_RS();
+    LCD_SET_RW();
+    for(tout = 0; (busy != FALSE) && (tout < LCD_BUSY_TOUT); tout++) {
+        LCD_SET_E();
+        lcdDly500ns();
+        busy = LCD_RD_BUSY();
+        LCD_CLR_E();
+        lcdDly500ns();
+#if !LCD_BUS_8BIT_EN
+        LCD_SET_E();
+        lcdDly500ns();
+        LCD_CLR_E();
+        lcdDly500ns();
+#endif
+    }
+    LCD_CLR_RW();
+    LCD_DB_OUT();
 }
+#endif
 
 
 /*************************************************************************
@@ -835,20 +1244,126 @@ static void lcdClear(LCD_BUFFER *buffer) {
     
 }
 
+/*************************************************************************
+  lcdClearLayer() - Clears the characters of a layer             (Private)
+*************************************************************************/
+static void lcdClearLayer(LCD_LAYER *layer) {
+    INT8U row;
+    INT8U col;
+
+    for(row = 0; row < LCD_LAYER_ROWS; row++) {
+        for(col = 0; col < LCD_LAYER_COLS; col++) {
+            layer->lcd_char[row][col] = LCD_CLEAR_BYTE;
+        }
+    }
+}
+
+#if LCD_MARQUEE_HW_EN
+/*************************************************************************
+  lcdInvalidate() - Fills a buffer with a value that is never     (Private)
+                    displayed so every character differs from it.
+*************************************************************************/
+static void lcdInvalidate(LCD_BUFFER *buffer) {
+    INT8U row;
+    INT8U col;
+
+    for(row = 0; row < LCD_NUM_ROWS; row++) {
+        for(col = 0; col < LCD_NUM_COLS; col++) {
+            buffer->lcd_char[row][col] = 0x00;
+        }
+    }
+}
+
+/*************************************************************************
+  lcdInvalidateMarquee() - Same as lcdInvalidate() for the copy   (Private)
+                           of the DD RAM lines used by the marquee.
+*************************************************************************/
+static void lcdInvalidateMarquee(void) {
+    INT8U row;
+    INT8U col;
+
+    for(row = 0; row < LCD_NUM_ROWS; row++) {
+        for(col = 0; col < LCD_DDRAM_LINE; col++) {
+            lcdMarqueeDDRam[row][col] = 0x00;
+        }
+    }
+}
+#endif
+
+/*************************************************************************
+  lcdMarkRow() - Marks the panel row showing row_index of a layer (Private)
+                 as dirty. Rows outside the viewport are ignored.
+                 Call with lcdLayersKey held.
+*************************************************************************/
+static void lcdMarkRow(LCD_LAYER *layer, INT8U row_index) {
+    INT8U panel_row = (INT8U)(row_index - layer->org_row);
+
+    if(panel_row < LCD_NUM_ROWS) {
+        lcdDirtyRows |= LCD_ROW_BIT(panel_row);
+    }else{
+    }
+}
+
+/*************************************************************************
+  lcdPostChange() - Wakes lcdLayeredTask after a layer change.    (Private)
+                    The tick of the first post since the last frame
+                    was started is kept for the staleness statistic.
+*************************************************************************/
+static void lcdPostChange(void) {
+    OS_ERR os_err;
+    OS_TICK now;
+    CPU_SR_ALLOC();
+
+    now = OSTimeGet(&os_err);
+    CPU_CRITICAL_ENTER();
+    if(lcdPostCnt == 0) {
+        lcdPostTick = now;
+    }else{
+    }
+    lcdPostCnt++;
+    CPU_CRITICAL_EXIT();
+    (void)OSTaskSemPost(&lcdLayeredTaskTCB, OS_OPT_POST_NONE, &os_err);
+}
+
+/*************************************************************************
+  lcdSetOrigin() - Sets a layer viewport origin, clamped so the   (Private)
+                   viewport stays inside the layer, and marks every
+                   row dirty. Call with lcdLayersKey held.
+*************************************************************************/
+static void lcdSetOrigin(LCD_LAYER *layer, INT16S org_row, INT16S org_col) {
+    if(org_row < 0) {
+        org_row = 0;
+    }else if(org_row > (INT16S)(LCD_LAYER_ROWS - LCD_NUM_ROWS)) {
+        org_row = (INT16S)(LCD_LAYER_ROWS - LCD_NUM_ROWS);
+    }else{
+    }
+    if(org_col < 0) {
+        org_col = 0;
+    }else if(org_col > (INT16S)(LCD_LAYER_COLS - LCD_NUM_COLS)) {
+        org_col = (INT16S)(LCD_LAYER_COLS - LCD_NUM_COLS);
+    }else{
+    }
+    layer->org_row = (INT8U)org_row;
+    layer->org_col = (INT8U)org_col;
+    lcdDirtyRows = LCD_ALL_ROWS;
+}
+
 /********************************************************************
 ** lcdMoveCursor(INT8U row, INT8U col)
 *
 *  FILENAME: LCD.c
 *
-*  PARAMETERS: row - Destination row (1 or 2).
-*              col - Destination column (1 - 16).
+*  PARAMETERS: row - Destination row (1 - LCD_NUM_ROWS).
+*              col - Destination column (1 - LCD_NUM_COLS).
 *
-*  DESCRIPTION: Moves the cursor to [row,col].
+*  DESCRIPTION: Moves the cursor to [row,col]. The position is not
+*               checked here, LcdCursor() only stores positions on the
+*               panel and LcdInit() starts every layer at [1,1].
 *
 *  RETURNS: None
 ********************************************************************/
 static void lcdMoveCursor(INT8U row, INT8U col) {
-   lcdWrite(LCD_DD_RAM((lcdRowAddress[(row-1)]) + (col-1)));
+   lcdWrite(LCD_DD_RAM(LCD_DD_ADDR(row-1, col-1)));
 }
 
 /********************************************************************
@@ -879,7 +1394,21 @@ static void lcdCursorDispMode(INT8U on, INT8U blink) {
 *  RETURNS: None
 ********************************************************************/
 void LcdHideLayer(INT8U layer){
+    OS_ERR os_err;
+
+    OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
     lcdLayers[layer].hidden = 1;
+    lcdDirtyRows = LCD_ALL_ROWS;
+
+    (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
+    // We have modified a layer
+    lcdPostChange();
 }
 
 
@@ -895,7 +1424,21 @@ void LcdHideLayer(INT8U layer){
 *  RETURNS: None
 ********************************************************************/
 void LcdShowLayer(INT8U layer){
+    OS_ERR os_err;
+
+    OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
     lcdLayers[layer].hidden = 0;
+    lcdDirtyRows = LCD_ALL_ROWS;
+
+    (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
+    // We have modified a layer
+    lcdPostChange();
 }
 
 /********************************************************************
@@ -910,11 +1453,25 @@ void LcdShowLayer(INT8U layer){
 *  RETURNS: None
 ********************************************************************/
 void LcdToggleLayer(INT8U layer){
+    OS_ERR os_err;
+
+    OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
     if(lcdLayers[layer].hidden){
         lcdLayers[layer].hidden = 0;
     }else{
         lcdLayers[layer].hidden = 1;
     }
+    lcdDirtyRows = LCD_ALL_ROWS;
+
+    (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
+    // We have modified a layer
+    lcdPostChange();
 }
 
 /*************************************************************************
@@ -980,3 +1537,195 @@ static INT8C lcdHtoA(INT8U hnib){
     }
     return asciic;
 }
+
+/*************************************************************************
+  LcdLayerOrigin() - Sets the layer position shown at panel row 1,  (Public)
+                     column 1. row and col start at 1 and are clamped
+                     so the viewport stays inside the layer.
+
+                     Pends on the lcdLayersKey mutex
+                     Posts the lcdModifiedFlag semaphore
+*************************************************************************/
+void LcdLayerOrigin(INT8U layer, INT8U row, INT8U col) {
+    OS_ERR os_err;
+
+    if(layer < LCD_NUM_LAYERS) {
+        OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+        }
+
+        lcdSetOrigin(&lcdLayers[layer], (INT16S)row - 1, (INT16S)col - 1);
+
+        (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+        while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+        }
+
+        // We have modified a layer
+        lcdPostChange();
+    }else{
+    }
+}
+
+/*************************************************************************
+  LcdLayerScroll() - Moves the viewport origin of a layer by drow   (Public)
+                     rows and dcol columns. Only the origin changes, the
+                     layer contents are not rewritten.
+
+                     Pends on the lcdLayersKey mutex
+                     Posts the lcdModifiedFlag semaphore
+*************************************************************************/
+void LcdLayerScroll(INT8U layer, INT8S drow, INT8S dcol) {
+    OS_ERR os_err;
+    LCD_LAYER *llayer;
+
+    if(layer < LCD_NUM_LAYERS) {
+        llayer = &lcdLayers[layer];
+        OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+        }
+
+        lcdSetOrigin(llayer, (INT16S)llayer->org_row + drow,
+                             (INT16S)llayer->org_col + dcol);
+
+        (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+        while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+        }
+
+        // We have modified a layer
+        lcdPostChange();
+    }else{
+    }
+}
+
+/*************************************************************************
+  LcdMarqueeStart() - Starts scrolling a layer as a marquee         (Public)
+
+        The layer takes over the display and wraps around after
+        LCD_MARQUEE_COLS columns. When LCD_MARQUEE_HW_EN the layer is
+        loaded into DD RAM once and steps use the LCD_SHIFT command.
+
+                     Pends on the lcdLayersKey mutex
+                     Posts the lcdModifiedFlag semaphore
+*************************************************************************/
+void LcdMarqueeStart(INT8U layer) {
+    OS_ERR os_err;
+
+    if(layer < LCD_NUM_LAYERS) {
+        OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+        }
+
+        if(lcdMarquee.layer != LCD_NO_MARQUEE) {
+            lcdLayers[lcdMarquee.layer].org_col = 0;
+        }else{
+        }
+        lcdMarquee.layer = layer;
+        lcdMarquee.mode_chg = 1;
+        lcdMarquee.shift = 0;
+        lcdLayers[layer].org_col = 0;
+        lcdDirtyRows = LCD_ALL_ROWS;
+
+        (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+        while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+        }
+
+        // We have modified a layer
+        lcdPostChange();
+    }else{
+    }
+}
+
+/*************************************************************************
+  LcdMarqueeStep() - Scrolls the marquee by cols columns. Positive  (Public)
+                     moves the text left. Does nothing if no marquee
+                     is running.
+
+                     Pends on the lcdLayersKey mutex
+                     Posts the lcdModifiedFlag semaphore
+*************************************************************************/
+void LcdMarqueeStep(INT8S cols) {
+    OS_ERR os_err;
+    INT16S org_col;
+#if LCD_MARQUEE_HW_EN
+    INT16S shift;
+#endif
+    LCD_LAYER *llayer;
+
+    OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
+    if(lcdMarquee.layer != LCD_NO_MARQUEE) {
+        llayer = &lcdLayers[lcdMarquee.layer];
+        org_col = ((INT16S)llayer->org_col + cols) % (INT16S)LCD_MARQUEE_COLS;
+        if(org_col < 0) {
+            org_col += (INT16S)LCD_MARQUEE_COLS;
+        }else{
+        }
+        llayer->org_col = (INT8U)org_col;
+#if LCD_MARQUEE_HW_EN
+        // Each shift is a full command delay, send the shorter way round
+        shift = ((INT16S)lcdMarquee.shift + cols) % (INT16S)LCD_DDRAM_LINE;
+        if(shift > (INT16S)(LCD_DDRAM_LINE / 2u)) {
+            shift -= (INT16S)LCD_DDRAM_LINE;
+        }else if(shift < -(INT16S)(LCD_DDRAM_LINE / 2u)) {
+            shift += (INT16S)LCD_DDRAM_LINE;
+        }else{
+        }
+        lcdMarquee.shift = (INT8S)shift;
+#else
+        lcdDirtyRows = LCD_ALL_ROWS;
+#endif
+    }else{
+    }
+
+    (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
+    lcdPostChange();
+}
+
+/*************************************************************************
+  LcdMarqueeStop() - Stops the marquee and returns to the layered   (Public)
+                     display. The marquee layer origin is reset.
+
+                     Pends on the lcdLayersKey mutex
+                     Posts the lcdModifiedFlag semaphore
+*************************************************************************/
+void LcdMarqueeStop(void) {
+    OS_ERR os_err;
+
+    OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
+    if(lcdMarquee.layer != LCD_NO_MARQUEE) {
+        lcdLayers[lcdMarquee.layer].org_col = 0;
+        lcdMarquee.layer = LCD_NO_MARQUEE;
+        lcdMarquee.mode_chg = 1;
+        lcdMarquee.shift = 0;
+        lcdDirtyRows = LCD_ALL_ROWS;
+    }else{
+    }
+
+    (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+    while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+    }
+
+    lcdPostChange();
+}
+
+/*************************************************************************
+  LcdStatsGet() - Copies the refresh governor counters to *stats  (Public)
+                  The LCD task updates them in a critical section and
+                  the copy is taken in one, so all three fields are
+                  from the same frame.
+*************************************************************************/
+void LcdStatsGet(LCD_STATS *stats) {
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    *stats = lcdStats;
+    CPU_CRITICAL_EXIT();
+}
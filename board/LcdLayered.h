@@ -22,6 +22,7 @@
 * 01/20/2019 Changed for MCUXpresso and added LcdDispDecWord(). TDM
 * 03/09/2019 Added additional defines and modified LcdDispDecWord. Brad Cowgill
 * 01/24/2022  Ported code for displaying hexword from LCD module. Code by TDM, ported by Dominic Danis
+* 10/18/2026 Panel geometry is now set at compile time in app_cfg.h.
 ****************************************************************************************/
 
 #ifndef LCD_DEF
@@ -40,13 +41,92 @@
 //Define for byte length
 #define LCD_BYTE 4
 
+/*************************************************************************
+* LCD Geometry - Set APP_CFG_LCD_ROWS and APP_CFG_LCD_COLS in app_cfg.h
+*                to match the panel. Supported HD44780 panels are
+*                1x16, 2x16, 2x20, 4x20 and 2x40. Defaults to 2x16.
+*                For 1x16 also see LCD_1X16_SPLIT below.
+*************************************************************************/
+#include "app_cfg.h"
+
+#ifdef APP_CFG_LCD_ROWS
+#define LCD_NUM_ROWS APP_CFG_LCD_ROWS
+#else
+#define LCD_NUM_ROWS 2u
+#endif
+
+#ifdef APP_CFG_LCD_COLS
+#define LCD_NUM_COLS APP_CFG_LCD_COLS
+#else
+#define LCD_NUM_COLS 16u
+#endif
+
+#if !(((LCD_NUM_ROWS == 1u) && (LCD_NUM_COLS == 16u)) || \
+      ((LCD_NUM_ROWS == 2u) && (LCD_NUM_COLS == 16u)) || \
+      ((LCD_NUM_ROWS == 2u) && (LCD_NUM_COLS == 20u)) || \
+      ((LCD_NUM_ROWS == 4u) && (LCD_NUM_COLS == 20u)) || \
+      ((LCD_NUM_ROWS == 2u) && (LCD_NUM_COLS == 40u)))
+#error "LcdLayered: unsupported LCD geometry, see APP_CFG_LCD_ROWS/COLS"
+#endif
+
+/*************************************************************************
+* 1x16 DD RAM Layout - Most 1x16 modules are addressed as 2x8: columns
+*                      1-8 are DD RAM 0x00-0x07 and columns 9-16 are
+*                      0x40-0x47, in two line mode. Set
+*                      APP_CFG_LCD_1X16_SPLIT to 1u for those. 0u is a
+*                      true single line module, columns 1-16 at
+*                      0x00-0x0F in one line mode. Defaults to 0u.
+*                      A split module has no hardware marquee, the
+*                      display shift would move the halves apart.
+*************************************************************************/
+#ifdef APP_CFG_LCD_1X16_SPLIT
+#define LCD_1X16_SPLIT APP_CFG_LCD_1X16_SPLIT
+#else
+#define LCD_1X16_SPLIT 0u
+#endif
+
+#if (LCD_1X16_SPLIT != 0u) && !((LCD_NUM_ROWS == 1u) && (LCD_NUM_COLS == 16u))
+#error "LcdLayered: APP_CFG_LCD_1X16_SPLIT is only for a 1x16 panel"
+#endif
+
+/*************************************************************************
+* LCD Layer Size - A layer may be larger than the panel. The panel shows
+*                  a window of each layer starting at the layer's
+*                  viewport origin, see LcdLayerOrigin()/LcdLayerScroll().
+*                  Set APP_CFG_LCD_LAYER_ROWS/COLS in app_cfg.h.
+*                  Defaults to the panel size.
+*************************************************************************/
+#ifdef APP_CFG_LCD_LAYER_ROWS
+#define LCD_LAYER_ROWS APP_CFG_LCD_LAYER_ROWS
+#else
+#define LCD_LAYER_ROWS LCD_NUM_ROWS
+#endif
+
+#ifdef APP_CFG_LCD_LAYER_COLS
+#define LCD_LAYER_COLS APP_CFG_LCD_LAYER_COLS
+#else
+#define LCD_LAYER_COLS LCD_NUM_COLS
+#endif
+
+#if (LCD_LAYER_ROWS < LCD_NUM_ROWS) || (LCD_LAYER_ROWS > 16u) || \
+    (LCD_LAYER_COLS < LCD_NUM_COLS) || (LCD_LAYER_COLS > 80u)
+#error "LcdLayered: layer size must be panel size up to 16 rows x 80 cols"
+#endif
+
 /*************************************************************************
 * LCD Rows and Columns Defines
-*
+* Only the rows and columns that exist on the configured panel are
+* defined, so an out of range constant position fails to compile.
 *************************************************************************/
 // LCD ROWS
 #define LCD_ROW_1 1
+#if LCD_NUM_ROWS >= 2u
 #define LCD_ROW_2 2
+#endif
+#if LCD_NUM_ROWS >= 4u
+#define LCD_ROW_3 3
+#define LCD_ROW_4 4
+#endif
 
 // LCD COLUMNS
 #define LCD_COL_1 1
@@ -65,6 +145,34 @@
 #define LCD_COL_14 14
 #define LCD_COL_15 15
 #define LCD_COL_16 16
+#if LCD_NUM_COLS >= 20u
+#define LCD_COL_17 17
+#define LCD_COL_18 18
+#define LCD_COL_19 19
+#define LCD_COL_20 20
+#endif
+#if LCD_NUM_COLS >= 40u
+#define LCD_COL_21 21
+#define LCD_COL_22 22
+#define LCD_COL_23 23
+#define LCD_COL_24 24
+#define LCD_COL_25 25
+#define LCD_COL_26 26
+#define LCD_COL_27 27
+#define LCD_COL_28 28
+#define LCD_COL_29 29
+#define LCD_COL_30 30
+#define LCD_COL_31 31
+#define LCD_COL_32 32
+#define LCD_COL_33 33
+#define LCD_COL_34 34
+#define LCD_COL_35 35
+#define LCD_COL_36 36
+#define LCD_COL_37 37
+#define LCD_COL_38 38
+#define LCD_COL_39 39
+#define LCD_COL_40 40
+#endif
 
 /*************************************************************************
 * Enumerated type for mode parameter in LcdDispDecWord()
@@ -77,6 +185,18 @@ typedef enum {
     LCD_DEC_MODE_AL
 } LCD_MODE;
 
+/*************************************************************************
+* Refresh governor counters, see LcdStatsGet()
+*   frames_drawn    - Frames composed and written to the LCD
+*   frames_skipped  - Posts folded into another frame
+*   max_stale_ticks - Worst ticks from a change to the frame showing it
+*************************************************************************/
+typedef struct {
+    INT32U frames_drawn;
+    INT32U frames_skipped;
+    INT32U max_stale_ticks;
+} LCD_STATS;
+
 /*************************************************************************
   Public Functions
 *************************************************************************/
@@ -101,5 +221,27 @@ INT8U LcdCursor(INT8U row, INT8U col, INT8U layer, INT8U on, INT8U blink);
 void LcdHideLayer(INT8U layer);
 void LcdShowLayer(INT8U layer);
 void LcdToggleLayer(INT8U layer);
+
+/*************************************************************************
+* Viewports and marquee
+*   LcdLayerOrigin() - Sets the layer position (row, col) shown at panel
+*                      row 1, column 1.
+*   LcdLayerScroll() - Moves the viewport origin by drow rows and dcol
+*                      columns. The origin is clamped to the layer.
+*   LcdMarqueeStart() - The layer takes over the display and scrolls
+*                       horizontally with wrap around. Uses the HD44780
+*                       display shift when the panel allows it, so a step
+*                       is a single bus write.
+*   LcdMarqueeStep() - Scrolls the marquee by cols, positive moves the
+*                      text left.
+*   LcdMarqueeStop() - Returns to normal layered display.
+*************************************************************************/
+void LcdLayerOrigin(INT8U layer, INT8U row, INT8U col);
+void LcdLayerScroll(INT8U layer, INT8S drow, INT8S dcol);
+void LcdMarqueeStart(INT8U layer);
+void LcdMarqueeStep(INT8S cols);
+void LcdMarqueeStop(void);
+
+void LcdStatsGet(LCD_STATS *stats);
 #endif
 
@@ -0,0 +1,37 @@
+/* MemCRCSw.c is a table driven software CRC that gives the same result as the CRC0
+ * module set up by MemCRCConfig(), so a CRC can be checked off-target or without CRC0.
+ * Author: Dominic Danis Last Edit: 10/18/2026
+ * */
+#include "MCUType.h"
+
+#ifndef MEMCRCSW_H_
+#define MEMCRCSW_H_
+
+/* CRC width, 16 matches MemCRCConfig(). 32 matches CRC0 with TCRC=1 and the
+ * CRC-32 polynomial 0x04C11DB7, all other options the same.
+ * */
+#ifndef MEM_CRC_SW_WIDTH
+#define MEM_CRC_SW_WIDTH 16u
+#endif
+
+#if MEM_CRC_SW_WIDTH == 16u
+typedef INT16U MEM_CRC_SW;
+#elif MEM_CRC_SW_WIDTH == 32u
+typedef INT32U MEM_CRC_SW;
+#else
+#error "MemCRCSw: MEM_CRC_SW_WIDTH must be 16 or 32"
+#endif
+
+/* MEM_CRC_SW MemCRCSwGet(INT8U *startaddr, INT8U *endaddr)
+ * Description: Computes the CRC of a block of memory with slicing-by-8
+ * Arguments: INT8U *startaddr - pointer to the address to begin the CRC
+ *            INT8U *endaddr   - pointer to the address to end the CRC
+ * Return:    The CRC, same value MemCRCGet() returns for the range
+ * */
+MEM_CRC_SW MemCRCSwGet(INT8U *startaddr, INT8U *endaddr);
+
+/* Same CRC with a byte at a time and slicing-by-4 kernel, for cross checks */
+MEM_CRC_SW MemCRCSwGetByte(INT8U *startaddr, INT8U *endaddr);
+MEM_CRC_SW MemCRCSwGetSlice4(INT8U *startaddr, INT8U *endaddr);
+
+#endif
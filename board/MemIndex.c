@@ -0,0 +1,167 @@
+/* MemIndex.c is a per-block integrity index for a range of memory. Each block has a CRC
+ * and the CRCs are combined pairwise into a binary tree, so a range can be rechecked
+ * block by block and a changed block can be found from the root in O(log n) steps.
+ * Block CRCs use the software CRC so building an index does not tie up CRC0.
+ * Author: Dominic Danis Last Edit: 10/18/2026
+ * */
+
+#include "MemIndex.h"
+#include "MemCRCSw.h"
+#include "MCUType.h"
+
+static MEM_CRC_SW memIdxBlock(const MEM_IDX *idx, INT32U block);
+static MEM_CRC_SW memIdxCombine(MEM_CRC_SW left, MEM_CRC_SW right);
+static INT32U memIdxFind(const MEM_IDX *ref, const MEM_IDX *cur, INT32U node, INT32U first,
+                         INT32U count, INT32U from);
+
+/* void MemIdxBuild(MEM_IDX *idx, INT8U *startaddr, INT8U *endaddr)
+ * Description: Computes the block CRCs and the tree for a block of memory. Traps if the
+ *              range needs more than MEM_IDX_MAX_BLOCKS blocks.
+ * Arguments: MEM_IDX *idx     - index to build
+ *            INT8U *startaddr - pointer to the address to begin the index
+ *            INT8U *endaddr   - pointer to the address to end the index
+ * Return:    none
+ * */
+void MemIdxBuild(MEM_IDX *idx, INT8U *startaddr, INT8U *endaddr){
+    INT32U i;
+    idx->base = startaddr;
+    idx->end = endaddr;
+    idx->nblocks = ((INT32U)(endaddr-startaddr)/MEM_IDX_BLOCK_SIZE) + 1;
+    while(idx->nblocks > MEM_IDX_MAX_BLOCKS){               //Range too big for the index
+    }
+    idx->nleaves = 1;
+    while(idx->nleaves < idx->nblocks){
+        idx->nleaves = idx->nleaves*2;
+    }
+    for(i = 0; i < idx->nleaves; i++){
+        if(i < idx->nblocks){
+            idx->node[idx->nleaves+i] = memIdxBlock(idx, i);
+        }else{
+            idx->node[idx->nleaves+i] = 0;
+        }
+    }
+    for(i = idx->nleaves-1; i > 0; i--){
+        idx->node[i] = memIdxCombine(idx->node[2*i], idx->node[(2*i)+1]);
+    }
+}
+
+/* void MemIdxUpdate(MEM_IDX *idx, INT32U block)
+ * Description: Recomputes one block CRC and the nodes above it
+ * Arguments: MEM_IDX *idx - index to update
+ *            INT32U block - block number, ignored if out of range
+ * Return:    none
+ * */
+void MemIdxUpdate(MEM_IDX *idx, INT32U block){
+    INT32U i;
+    if(block < idx->nblocks){
+        i = idx->nleaves + block;
+        idx->node[i] = memIdxBlock(idx, block);
+        i = i/2;
+        while(i > 0){
+            idx->node[i] = memIdxCombine(idx->node[2*i], idx->node[(2*i)+1]);
+            i = i/2;
+        }
+    }else{}
+}
+
+/* INT32U MemIdxCheck(const MEM_IDX *idx, INT8U *startaddr, INT8U *endaddr)
+ * Description: Checks a range against the index, reading only the blocks it overlaps.
+ *              The range is clipped to the indexed range.
+ * Arguments: const MEM_IDX *idx - reference index
+ *            INT8U *startaddr   - pointer to the address to begin the check
+ *            INT8U *endaddr     - pointer to the address to end the check
+ * Return:    The first block that does not match, MEM_IDX_NONE if all match
+ * */
+INT32U MemIdxCheck(const MEM_IDX *idx, INT8U *startaddr, INT8U *endaddr){
+    INT32U block;
+    INT32U last;
+    INT32U bad = MEM_IDX_NONE;
+    if(startaddr < idx->base){
+        startaddr = idx->base;
+    }else{}
+    if(endaddr > idx->end){
+        endaddr = idx->end;
+    }else{}
+    if(startaddr <= endaddr){
+        block = (INT32U)(startaddr-idx->base)/MEM_IDX_BLOCK_SIZE;
+        last = (INT32U)(endaddr-idx->base)/MEM_IDX_BLOCK_SIZE;
+        while((block <= last) && (bad == MEM_IDX_NONE)){
+            if(memIdxBlock(idx, block) != idx->node[idx->nleaves+block]){
+                bad = block;
+            }else{}
+            block++;
+        }
+    }else{}
+    return bad;
+}
+
+/* INT32U MemIdxFind(const MEM_IDX *ref, const MEM_IDX *cur, INT32U from)
+ * Description: Finds the next block that differs between two indexes of the same
+ *              range by walking down the tree, skipping subtrees that match.
+ *              Each differing block costs O(log n) node compares.
+ * Arguments: const MEM_IDX *ref - reference index
+ *            const MEM_IDX *cur - index of the current memory contents
+ *            INT32U from        - first block to consider
+ * Return:    The block number, MEM_IDX_NONE if there is none
+ * */
+INT32U MemIdxFind(const MEM_IDX *ref, const MEM_IDX *cur, INT32U from){
+    INT32U block = MEM_IDX_NONE;
+    if((ref->nleaves == cur->nleaves) && (from < ref->nblocks)){
+        block = memIdxFind(ref, cur, 1, 0, ref->nleaves, from);
+    }else{}
+    return block;
+}
+
+/* MEM_CRC_SW MemIdxRoot(const MEM_IDX *idx)
+ * Description: Returns the root digest, which covers the whole range
+ * */
+MEM_CRC_SW MemIdxRoot(const MEM_IDX *idx){
+    return idx->node[1];
+}
+
+/* static INT32U memIdxFind(...)
+ * Description: Searches the subtree at node, which covers count blocks from first.
+ *              Recursion depth is log2(MEM_IDX_MAX_BLOCKS)+1.
+ * Return:      The first differing block at or after from, MEM_IDX_NONE if none
+ * */
+static INT32U memIdxFind(const MEM_IDX *ref, const MEM_IDX *cur, INT32U node, INT32U first,
+                         INT32U count, INT32U from){
+    INT32U block = MEM_IDX_NONE;
+    if(((first+count) <= from) || (ref->node[node] == cur->node[node])){
+        //Subtree is before from or matches
+    }else if(count == 1){
+        block = first;
+    }else{
+        count = count/2;
+        block = memIdxFind(ref, cur, 2*node, first, count, from);
+        if(block == MEM_IDX_NONE){
+            block = memIdxFind(ref, cur, (2*node)+1, first+count, count, from);
+        }else{}
+    }
+    return block;
+}
+
+/* static MEM_CRC_SW memIdxBlock(const MEM_IDX *idx, INT32U block)
+ * Description: CRC of one block, the last block ends at idx->end
+ * */
+static MEM_CRC_SW memIdxBlock(const MEM_IDX *idx, INT32U block){
+    INT8U *start = idx->base + (block*MEM_IDX_BLOCK_SIZE);
+    INT8U *end = start + (MEM_IDX_BLOCK_SIZE-1);
+    if(end > idx->end){
+        end = idx->end;
+    }else{}
+    return MemCRCSwGet(start, end);
+}
+
+/* static MEM_CRC_SW memIdxCombine(MEM_CRC_SW left, MEM_CRC_SW right)
+ * Description: Parent digest, the CRC of the two child digests, little-endian
+ * */
+static MEM_CRC_SW memIdxCombine(MEM_CRC_SW left, MEM_CRC_SW right){
+    INT8U buf[2u*sizeof(MEM_CRC_SW)];
+    INT8U i;
+    for(i = 0; i < sizeof(MEM_CRC_SW); i++){
+        buf[i] = (INT8U)(left >> (8u*i));
+        buf[sizeof(MEM_CRC_SW)+i] = (INT8U)(right >> (8u*i));
+    }
+    return MemCRCSwGet(&buf[0], &buf[sizeof(buf)-1]);
+}
@@ -0,0 +1,78 @@
+/* MemIndex.c is a per-block integrity index for a range of memory. Each block has a CRC
+ * and the CRCs are combined pairwise into a binary tree, so a range can be rechecked
+ * block by block and a changed block can be found from the root in O(log n) steps.
+ * Author: Dominic Danis Last Edit: 10/18/2026
+ * */
+#include "MCUType.h"
+#include "MemCRCSw.h"
+
+#ifndef MEMINDEX_H_
+#define MEMINDEX_H_
+
+//Block size in bytes and most blocks in an index, MEM_IDX_MAX_BLOCKS must be a power of 2
+#ifndef MEM_IDX_BLOCK_SIZE
+#define MEM_IDX_BLOCK_SIZE 4096u
+#endif
+#ifndef MEM_IDX_MAX_BLOCKS
+#define MEM_IDX_MAX_BLOCKS 512u
+#endif
+#if (MEM_IDX_MAX_BLOCKS & (MEM_IDX_MAX_BLOCKS - 1u)) != 0u
+#error "MemIndex: MEM_IDX_MAX_BLOCKS must be a power of 2"
+#endif
+
+#define MEM_IDX_NONE 0xFFFFFFFFu           //No block found
+
+/* The tree is stored heap style, node[1] is the root, the children of node[i] are
+ * node[2i] and node[2i+1] and block b is node[nleaves+b]. Leaves past the last block
+ * are 0. An index is a plain struct, the reference index may be kept in any section.
+ * */
+typedef struct{
+    INT8U *base;
+    INT8U *end;
+    INT32U nblocks;
+    INT32U nleaves;
+    MEM_CRC_SW node[2u*MEM_IDX_MAX_BLOCKS];
+}MEM_IDX;
+
+/* void MemIdxBuild(MEM_IDX *idx, INT8U *startaddr, INT8U *endaddr)
+ * Description: Computes the block CRCs and the tree for a block of memory
+ * Arguments: MEM_IDX *idx     - index to build
+ *            INT8U *startaddr - pointer to the address to begin the index
+ *            INT8U *endaddr   - pointer to the address to end the index
+ * Return:    none
+ * */
+void MemIdxBuild(MEM_IDX *idx, INT8U *startaddr, INT8U *endaddr);
+
+/* void MemIdxUpdate(MEM_IDX *idx, INT32U block)
+ * Description: Recomputes one block CRC and the nodes above it
+ * Arguments: MEM_IDX *idx - index to update
+ *            INT32U block - block number
+ * Return:    none
+ * */
+void MemIdxUpdate(MEM_IDX *idx, INT32U block);
+
+/* INT32U MemIdxCheck(const MEM_IDX *idx, INT8U *startaddr, INT8U *endaddr)
+ * Description: Checks a range against the index, reading only the blocks it overlaps
+ * Arguments: const MEM_IDX *idx - reference index
+ *            INT8U *startaddr   - pointer to the address to begin the check
+ *            INT8U *endaddr     - pointer to the address to end the check
+ * Return:    The first block that does not match, MEM_IDX_NONE if all match
+ * */
+INT32U MemIdxCheck(const MEM_IDX *idx, INT8U *startaddr, INT8U *endaddr);
+
+/* INT32U MemIdxFind(const MEM_IDX *ref, const MEM_IDX *cur, INT32U from)
+ * Description: Finds the next block that differs between two indexes of the same
+ *              range by walking down the tree, skipping subtrees that match.
+ * Arguments: const MEM_IDX *ref - reference index
+ *            const MEM_IDX *cur - index of the current memory contents
+ *            INT32U from        - first block to consider
+ * Return:    The block number, MEM_IDX_NONE if there is none
+ * */
+INT32U MemIdxFind(const MEM_IDX *ref, const MEM_IDX *cur, INT32U from);
+
+/* MEM_CRC_SW MemIdxRoot(const MEM_IDX *idx)
+ * Description: Returns the root digest, which covers the whole range
+ * */
+MEM_CRC_SW MemIdxRoot(const MEM_IDX *idx);
+
+#endif
@@ -11,21 +11,110 @@
 #define CRC_POLYNOMIAL 0x8005
 #define SEED 0x0000
 
+//Defines for the word parallel checksum. USADA8 sums the four bytes of a word in one
+//instruction on the Cortex-M4, other targets use a 64-bit SWAR kernel.
+#if (defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+#define MEM_CHK_USADA8_EN 1
+#define MEM_CHK_WORD_BYTES 4u
+typedef INT32U MEM_CHK_WORD;
+#else
+#define MEM_CHK_USADA8_EN 0
+#define MEM_CHK_WORD_BYTES 8u
+typedef INT64U MEM_CHK_WORD;
+#define MEM_SWAR_BYTE_MASK 0x00FF00FF00FF00FFull   //Even bytes into 16-bit lanes
+#define MEM_SWAR_LANE_MASK 0x0000FFFF0000FFFFull   //Even 16-bit lanes into 32-bit lanes
+#define MEM_SWAR_FLUSH     128u                    //Words per flush, 128*510 < 65536
+#endif
+
+static INT32U memChkSumWords(const MEM_CHK_WORD *src, INT32U nwords);
+
 /* INT16U MemChkSum(INT8U *startaddr, INT8U *endaddr);
  *  Description: Computes the check sum for a specified block of memory
+ *               Bytes up to the first word boundary and after the last whole word are
+ *               added one at a time, the aligned words in between by memChkSumWords().
+ *               The sum is kept in 32 bits and truncated at the end, which gives the
+ *               same result as a 16-bit wraparound sum.
  *  Arguments: INT8U *startaddr - pointer to the address to begin the checksum
  *             INT8U *endaddr   - pointer to the address to end the checksum
  *  Return value: Returns an INT16U containing the checksum value of the specific block
  * */
 INT16U MemChkSum(INT8U *startaddr, INT8U *endaddr){
-    INT16U sum = 0;
+    INT32U sum = 0;
+    INT32U nwords = 0;
+    while((startaddr<endaddr) && (((CPU_ADDR)startaddr & (MEM_CHK_WORD_BYTES-1)) != 0)){
+        sum = sum + (INT32U)*startaddr;                 //Head bytes before word boundary
+        startaddr++;
+    }
+    if(startaddr<endaddr){
+        nwords = (INT32U)(endaddr-startaddr)/MEM_CHK_WORD_BYTES;   //Whole words before endaddr
+    }else{}
+    sum = sum + memChkSumWords((const MEM_CHK_WORD *)startaddr, nwords);
+    startaddr = startaddr + (nwords*MEM_CHK_WORD_BYTES);
     while(startaddr<endaddr){
-        sum = sum + (INT16U)*startaddr;                 //Accumulate values at each address
+        sum = sum + (INT32U)*startaddr;                 //Tail bytes
         startaddr++;
     }
-    sum = sum + (INT16U)*endaddr;                       //Avoid terminal count bug
+    sum = sum + (INT32U)*endaddr;                       //Avoid terminal count bug
+    return (INT16U)sum;
+}
+
+#if MEM_CHK_USADA8_EN
+/* static INT32U memChkSumWords(const MEM_CHK_WORD *src, INT32U nwords)
+ * Description: Sums the bytes of nwords aligned words with USADA8. Unrolled by four
+ *              with separate accumulators so the loads and adds can overlap.
+ *              A 32-bit accumulator can not overflow before 16MB.
+ * Arguments: src    - pointer to the first word, must be word aligned
+ *            nwords - number of words
+ * Return:    The byte sum
+ * */
+static INT32U memChkSumWords(const MEM_CHK_WORD *src, INT32U nwords){
+    INT32U sum0 = 0;
+    INT32U sum1 = 0;
+    INT32U sum2 = 0;
+    INT32U sum3 = 0;
+    while(nwords >= 4){
+        sum0 = __USADA8(src[0], 0, sum0);
+        sum1 = __USADA8(src[1], 0, sum1);
+        sum2 = __USADA8(src[2], 0, sum2);
+        sum3 = __USADA8(src[3], 0, sum3);
+        src = src + 4;
+        nwords = nwords - 4;
+    }
+    while(nwords > 0){
+        sum0 = __USADA8(*src, 0, sum0);
+        src++;
+        nwords--;
+    }
+    return sum0 + sum1 + sum2 + sum3;
+}
+#else
+/* static INT32U memChkSumWords(const MEM_CHK_WORD *src, INT32U nwords)
+ * Description: Sums the bytes of nwords aligned 64-bit words using SWAR. The even and
+ *              odd bytes of each word are added into four 16-bit lanes, which are
+ *              folded into the result every MEM_SWAR_FLUSH words before they can carry.
+ * Arguments: src    - pointer to the first word, must be 8 byte aligned
+ *            nwords - number of words
+ * Return:    The byte sum
+ * */
+static INT32U memChkSumWords(const MEM_CHK_WORD *src, INT32U nwords){
+    INT32U sum = 0;
+    INT32U cnt;
+    MEM_CHK_WORD lanes;
+    while(nwords > 0){
+        cnt = (nwords < MEM_SWAR_FLUSH) ? nwords : MEM_SWAR_FLUSH;
+        nwords = nwords - cnt;
+        lanes = 0;
+        while(cnt > 0){
+            lanes = lanes + (*src & MEM_SWAR_BYTE_MASK) + ((*src >> 8) & MEM_SWAR_BYTE_MASK);
+            src++;
+            cnt--;
+        }
+        lanes = (lanes & MEM_SWAR_LANE_MASK) + ((lanes >> 16) & MEM_SWAR_LANE_MASK);
+        sum = sum + (INT32U)lanes + (INT32U)(lanes >> 32);
+    }
     return sum;
 }
+#endif
 
 /* void MemCRCConfig()
  * Description: Configures the CRC module with our given seed, polynomial, size, complement and transpose read/writes
@@ -45,62 +134,157 @@ void MemCRCConfig(void){
 
 }
 
-//States for CRC writing
-typedef enum{HU,HL,LU,LL}WRITE_DEST;
+//Defines for the CRC write paths. Bytes up to the first word boundary and after the
+//last whole word go through the 8-bit DATALL lane, the words in between are written to
+//the 32-bit DATA register. With TOT=2 a little-endian word is fed to the engine in
+//address order, so both paths give the same CRC as sequential byte writes.
+#define MEM_CRC_WORD_BYTES 4u
+#define MEM_CRC_DMA_CH     0u                  //eDMA channel used by MemCRCDMAStart()
+
+static void memCRCWords(const INT32U *src, INT32U nwords);
+static void memCRCBytes(INT8U *startaddr, INT8U *endaddr);
+static INT32U memCRCHead(INT8U **startaddr, INT8U *endaddr);
 
+static INT8U *memCRCDMATail;                   //Bytes left for the CPU after the transfer
+static INT8U *memCRCDMAEnd;
+static INT8U memCRCDMABusy;
 
 /* INT16U MemCRCGet(INT8U *startaddr, INT8U *endaddr)
  * Description: Runs CRC test for a given address on the CRC module
+ *              Head and tail bytes are written one at a time, the aligned words with
+ *              32-bit writes, so the bulk of the range costs one bus write per word.
  * Arguments: INT8U *startaddr - pointer to the address to begin the CRC
  *            INT8U *endaddr   - pointer to the address to end the CRC
  * Return:    Returns the CRC16 an INT16U
  * */
 
 INT16U MemCRCGet(INT8U *startaddr, INT8U *endaddr){
-    WRITE_DEST current_state = HU;                     //write to HU first
-    while(startaddr<endaddr){
+    INT32U nwords;
+    nwords = memCRCHead(&startaddr, endaddr);
+    memCRCWords((const INT32U *)startaddr, nwords);
+    startaddr = startaddr + (nwords*MEM_CRC_WORD_BYTES);
+    memCRCBytes(startaddr, endaddr);
+    return CRC0->ACCESS16BIT.DATAL;
+}
 
-        switch(current_state){                         //write to different registers depending on state
-            case HU:
-                CRC0->ACCESS8BIT.DATAHU = *startaddr;
-                startaddr++;
-                current_state = HL;
-                break;
-            case HL:
-                CRC0->ACCESS8BIT.DATAHL = *startaddr;
-                startaddr++;
-                current_state = LU;
-                break;
-            case LU:
-                CRC0->ACCESS8BIT.DATALU = *startaddr;
-                startaddr++;
-                current_state = LL;
-                break;
-            case LL:
-                CRC0->ACCESS8BIT.DATALL = *startaddr;
-                startaddr++;
-                current_state = HU;
-                break;
-            default:
-                current_state = HU;
-                break;
-        }
+/* void MemCRCDMAStart(INT8U *startaddr, INT8U *endaddr)
+ * Description: Starts a CRC of the range with the aligned words moved to CRC0 by eDMA
+ *              channel MEM_CRC_DMA_CH. The head bytes are written before returning,
+ *              the tail bytes by MemCRCDMAFinish(). The range must not change and
+ *              CRC0 must not be used until MemCRCDMAFinish() returns.
+ * Arguments: INT8U *startaddr - pointer to the address to begin the CRC
+ *            INT8U *endaddr   - pointer to the address to end the CRC
+ * Return:    none
+ * */
+void MemCRCDMAStart(INT8U *startaddr, INT8U *endaddr){
+    INT32U nwords;
+    nwords = memCRCHead(&startaddr, endaddr);
+    memCRCDMATail = startaddr + (nwords*MEM_CRC_WORD_BYTES);
+    memCRCDMAEnd = endaddr;
+    if(nwords > 0){
+        SIM->SCGC7 |= SIM_SCGC7_DMA_MASK;
+        DMA0->CERQ = DMA_CERQ_CERQ(MEM_CRC_DMA_CH);        //Software start only
+        DMA0->CDNE = DMA_CDNE_CDNE(MEM_CRC_DMA_CH);
+        DMA0->TCD[MEM_CRC_DMA_CH].SADDR = (INT32U)(CPU_ADDR)startaddr;
+        DMA0->TCD[MEM_CRC_DMA_CH].SOFF = MEM_CRC_WORD_BYTES;
+        DMA0->TCD[MEM_CRC_DMA_CH].ATTR = DMA_ATTR_SSIZE(2) | DMA_ATTR_DSIZE(2);   //32-bit
+        DMA0->TCD[MEM_CRC_DMA_CH].NBYTES_MLNO = nwords*MEM_CRC_WORD_BYTES;     //One minor loop
+        DMA0->TCD[MEM_CRC_DMA_CH].SLAST = 0;
+        DMA0->TCD[MEM_CRC_DMA_CH].DADDR = (INT32U)(CPU_ADDR)&CRC0->DATA;
+        DMA0->TCD[MEM_CRC_DMA_CH].DOFF = 0;
+        DMA0->TCD[MEM_CRC_DMA_CH].CITER_ELINKNO = 1;
+        DMA0->TCD[MEM_CRC_DMA_CH].BITER_ELINKNO = 1;
+        DMA0->TCD[MEM_CRC_DMA_CH].DLAST_SGA = 0;
+        DMA0->TCD[MEM_CRC_DMA_CH].CSR = DMA_CSR_START_MASK;
+        memCRCDMABusy = 1;
+    }else{
+        memCRCDMABusy = 0;
     }
-    switch(current_state){                             //Avoid terminal count bug
-        case HU:
-            CRC0->ACCESS8BIT.DATAHU = *startaddr;
-            break;
-        case HL:
-            CRC0->ACCESS8BIT.DATAHL = *startaddr;
-            break;
-        case LU:
-            CRC0->ACCESS8BIT.DATALU = *startaddr;
-            break;
-        case LL:
-            CRC0->ACCESS8BIT.DATALL = *startaddr;
-            break;
-        default:
-            break;
+}
+
+/* INT8U MemCRCDMADone(void)
+ * Description: Checks if the transfer started by MemCRCDMAStart() has completed
+ * Arguments: none
+ * Return:    1 when done, 0 while the DMA is still feeding CRC0
+ * */
+INT8U MemCRCDMADone(void){
+    INT8U done;
+    if(memCRCDMABusy == 0){
+        done = 1;
+    }else if((DMA0->TCD[MEM_CRC_DMA_CH].CSR & DMA_CSR_DONE_MASK) != 0){
+        DMA0->CDNE = DMA_CDNE_CDNE(MEM_CRC_DMA_CH);
+        memCRCDMABusy = 0;
+        done = 1;
+    }else{
+        done = 0;
     }
+    return done;
+}
+
+/* INT16U MemCRCDMAFinish(void)
+ * Description: Waits for the transfer started by MemCRCDMAStart() then writes the
+ *              tail bytes. Poll MemCRCDMADone() first to avoid the busy wait.
+ * Arguments: none
+ * Return:    Returns the CRC16 an INT16U
+ * */
+INT16U MemCRCDMAFinish(void){
+    while(MemCRCDMADone() == 0){}
+    memCRCBytes(memCRCDMATail, memCRCDMAEnd);
     return CRC0->ACCESS16BIT.DATAL;
 }
+
+/* static INT32U memCRCHead(INT8U **startaddr, INT8U *endaddr)
+ * Description: Writes the bytes before the first word boundary and advances *startaddr
+ * Arguments: startaddr - pointer to the start pointer
+ *            endaddr   - pointer to the address to end the CRC
+ * Return:    Number of whole words from *startaddr that are before endaddr
+ * */
+static INT32U memCRCHead(INT8U **startaddr, INT8U *endaddr){
+    INT8U *addr = *startaddr;
+    INT32U nwords = 0;
+    while((addr<endaddr) && (((CPU_ADDR)addr & (MEM_CRC_WORD_BYTES-1)) != 0)){
+        CRC0->ACCESS8BIT.DATALL = *addr;
+        addr++;
+    }
+    if(addr<endaddr){
+        nwords = (INT32U)(endaddr-addr)/MEM_CRC_WORD_BYTES;
+    }else{}
+    *startaddr = addr;
+    return nwords;
+}
+
+/* static void memCRCWords(const INT32U *src, INT32U nwords)
+ * Description: Writes nwords aligned words to CRC0, unrolled by four
+ * Arguments: src    - pointer to the first word, must be word aligned
+ *            nwords - number of words
+ * Return:    none
+ * */
+static void memCRCWords(const INT32U *src, INT32U nwords){
+    while(nwords >= 4){
+        CRC0->DATA = src[0];
+        CRC0->DATA = src[1];
+        CRC0->DATA = src[2];
+        CRC0->DATA = src[3];
+        src = src + 4;
+        nwords = nwords - 4;
+    }
+    while(nwords > 0){
+        CRC0->DATA = *src;
+        src++;
+        nwords--;
+    }
+}
+
+/* static void memCRCBytes(INT8U *startaddr, INT8U *endaddr)
+ * Description: Writes the bytes from startaddr through endaddr, inclusive
+ * Arguments: startaddr - pointer to the first byte
+ *            endaddr   - pointer to the last byte
+ * Return:    none
+ * */
+static void memCRCBytes(INT8U *startaddr, INT8U *endaddr){
+    while(startaddr<endaddr){
+        CRC0->ACCESS8BIT.DATALL = *startaddr;
+        startaddr++;
+    }
+    CRC0->ACCESS8BIT.DATALL = *endaddr;                //Avoid terminal count bug
+}
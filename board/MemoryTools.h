@@ -23,8 +23,23 @@ INT16U MemChkSum(INT8U *startaddr, INT8U *endaddr);
  * */
 void MemCRCConfig(void);
 
+/* INT16U MemCRCGet(INT8U *startaddr, INT8U *endaddr)
+ * Description: Runs CRC test for a given address on the CRC module
+ * Arguments: INT8U *startaddr - pointer to the address to begin the CRC
+ *            INT8U *endaddr   - pointer to the address to end the CRC
+ * Return:    Returns the CRC16 an INT16U
+ * */
 INT16U MemCRCGet(INT8U *startaddr, INT8U *endaddr);
 
+/* DMA fed CRC, gives the same result as MemCRCGet()
+ *  MemCRCDMAStart()  - Starts the CRC of a range, the words are moved by eDMA
+ *  MemCRCDMADone()   - Returns 1 when the transfer is complete
+ *  MemCRCDMAFinish() - Waits for the transfer, adds the tail bytes and returns the CRC16
+ * */
+void MemCRCDMAStart(INT8U *startaddr, INT8U *endaddr);
+INT8U MemCRCDMADone(void);
+INT16U MemCRCDMAFinish(void);
+
 
 
 #endif
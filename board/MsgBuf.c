@@ -0,0 +1,133 @@
+/*****************************************************************************************
+* MsgBuf
+* Zero-copy, reference counted message buffers on OS_MEM partitions and OSQ queues.
+* A multicast post hands the same block to every queue with one reference per queue,
+* so no consumer needs a copy and no consumer frees the block from under another.
+* Reference counts are changed with the port's compare and swap, OS_CPU_CAS32(), so
+* a buffer can be released from an ISR. Ports without it use a critical section.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include "MsgBuf.h"
+#include "MCUType.h"
+#include "os.h"
+/*****************************************************************************************
+* Private function prototypes
+*****************************************************************************************/
+static INT32U msgBufRefAdd(MSG_BUF *buf, INT32S delta);
+/*****************************************************************************************
+* MsgBufPoolCreate
+* Creates a partition of nblks buffers with OSMemCreate(). Blocks that cannot hold the
+* header and at least one byte are refused with OS_ERR_MEM_INVALID_SIZE.
+*****************************************************************************************/
+void MsgBufPoolCreate(OS_MEM *pool, CPU_CHAR *name, void *addr, OS_MEM_QTY nblks,
+                      OS_MEM_SIZE blksize, OS_ERR *p_err){
+    if((blksize <= sizeof(MSG_BUF)) || ((blksize - sizeof(MSG_BUF)) > 0xFFFFu)){
+        *p_err = OS_ERR_MEM_INVALID_SIZE;
+    }else{
+        OSMemCreate(pool, name, addr, nblks, blksize, p_err);
+    }
+}
+/*****************************************************************************************
+* MsgBufGet
+* Takes a buffer from pool with one reference, owned by the caller.
+*****************************************************************************************/
+MSG_BUF *MsgBufGet(OS_MEM *pool, OS_ERR *p_err){
+    MSG_BUF *buf;
+    buf = (MSG_BUF *)OSMemGet(pool, p_err);
+    if(*p_err == OS_ERR_NONE){
+        buf->pool = pool;
+        buf->refs = 1u;
+        buf->size = (INT16U)(pool->BlkSize - sizeof(MSG_BUF));
+        buf->len = 0u;
+    }else{
+        buf = (MSG_BUF *)0;
+    }
+    return buf;
+}
+/*****************************************************************************************
+* MsgBufRef
+* Adds a reference for a new holder
+*****************************************************************************************/
+void MsgBufRef(MSG_BUF *buf){
+    (void)msgBufRefAdd(buf, 1);
+}
+/*****************************************************************************************
+* MsgBufRelease
+* Drops a reference, the holder that drops the last one returns the block
+*****************************************************************************************/
+void MsgBufRelease(MSG_BUF *buf){
+    OS_ERR os_err;
+    if(msgBufRefAdd(buf, -1) == 0u){
+        OSMemPut(buf->pool, (void *)buf, &os_err);
+    }else{}
+}
+/*****************************************************************************************
+* MsgBufPost
+* The queues' references are added before the first post, in one step, so a consumer
+* that runs at once and releases cannot free the block. References of failed posts are
+* given back at the end, the caller's own reference keeps the count from reaching zero.
+* Every post but the last is made with OS_OPT_POST_NO_SCHED so the scheduler runs
+* once, with all the consumers ready.
+*****************************************************************************************/
+INT8U MsgBufPost(MSG_BUF *buf, OS_Q *const qtbl[], INT8U nq, OS_OPT opt, OS_ERR *p_err){
+    INT8U i;
+    INT8U posted = 0u;
+    OS_OPT qopt;
+    *p_err = OS_ERR_NONE;
+    if(nq > 0u){
+        (void)msgBufRefAdd(buf, (INT32S)nq);
+        for(i = 0u; i < nq; i++){
+            if(i < (nq - 1u)){
+                qopt = opt | OS_OPT_POST_NO_SCHED;
+            }else{
+                qopt = opt;
+            }
+            OSQPost(qtbl[i], (void *)buf, (OS_MSG_SIZE)buf->len, qopt, p_err);
+            if(*p_err == OS_ERR_NONE){
+                posted++;
+            }else{}
+        }
+        if(posted != nq){
+            (void)msgBufRefAdd(buf, -(INT32S)(nq - posted));
+        }else{}
+        if((nq > 1u) && ((opt & OS_OPT_POST_NO_SCHED) == 0u) && (*p_err != OS_ERR_NONE)){
+            OSSched();                                  /* Last post failed, did not schedule */
+        }else{}
+    }else{}
+    return posted;
+}
+/*****************************************************************************************
+* MsgBufPend
+* Waits on q for a buffer
+*****************************************************************************************/
+MSG_BUF *MsgBufPend(OS_Q *q, OS_TICK timeout, OS_OPT opt, OS_ERR *p_err){
+    OS_MSG_SIZE size;
+    MSG_BUF *buf;
+    buf = (MSG_BUF *)OSQPend(q, timeout, opt, &size, (CPU_TS *)0, p_err);
+    if(*p_err != OS_ERR_NONE){
+        buf = (MSG_BUF *)0;
+    }else{}
+    return buf;
+}
+/*****************************************************************************************
+* msgBufRefAdd
+* Adds delta to the reference count atomically, returns the new count
+*****************************************************************************************/
+static INT32U msgBufRefAdd(MSG_BUF *buf, INT32S delta){
+    INT32U refs;
+#ifdef OS_CPU_CAS32
+    INT32U old;
+    do{
+        old = buf->refs;
+        refs = old + (INT32U)delta;
+    }while(OS_CPU_CAS32(&buf->refs, old, refs) == 0);
+#else
+    CPU_SR_ALLOC();
+    CPU_CRITICAL_ENTER();
+    refs = buf->refs + (INT32U)delta;
+    buf->refs = refs;
+    CPU_CRITICAL_EXIT();
+#endif
+    return refs;
+}
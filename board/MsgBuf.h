@@ -0,0 +1,82 @@
+/*****************************************************************************************
+* MsgBuf
+* Zero-copy, reference counted message buffers. A buffer is a block of an OS_MEM
+* partition with a small header. The buffer pointer is what goes through OSQPost(), so
+* one buffer can be posted to any number of queues without copying the data. Every
+* holder owns a reference and the block goes back to its partition when the last
+* reference is released.
+*
+* Usage:
+*   Producer - MsgBufGet(), fill MSG_BUF_DATA(buf) and set buf->len, MsgBufPost() to
+*              one or more queues, then MsgBufRelease() its own reference.
+*   Consumer - MsgBufPend() or OSQPend(), read the data, then MsgBufRelease().
+* The data must not be changed once the buffer has been posted.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include "MCUType.h"
+#include "os.h"
+
+#ifndef MSGBUF_DEF
+#define MSGBUF_DEF
+/*****************************************************************************************
+* Buffer header, at the start of the block. The payload follows it.
+*   pool - Partition the block goes back to
+*   refs - Number of holders. Only changed through MsgBufRef()/MsgBufRelease()
+*   size - Payload capacity in bytes
+*   len  - Payload length in bytes, set by the producer. Posted as the message size.
+*****************************************************************************************/
+typedef struct{
+    OS_MEM *pool;
+    volatile INT32U refs;
+    INT16U size;
+    INT16U len;
+}MSG_BUF;
+/*****************************************************************************************
+* Payload of a buffer
+*****************************************************************************************/
+#define MSG_BUF_DATA(buf)   ((INT8U *)((MSG_BUF *)(buf) + 1))
+/*****************************************************************************************
+* Partition block size needed for a payload of size bytes
+*****************************************************************************************/
+#define MSG_BUF_BLK_SIZE(size)  (sizeof(MSG_BUF) + (size))
+/*****************************************************************************************
+* MsgBufPoolCreate
+* Creates a partition of nblks buffers with OSMemCreate(). blksize is the block size
+* in bytes, MSG_BUF_BLK_SIZE() of the largest payload. addr must hold nblks*blksize
+* bytes and be aligned for a pointer.
+*****************************************************************************************/
+void MsgBufPoolCreate(OS_MEM *pool, CPU_CHAR *name, void *addr, OS_MEM_QTY nblks,
+                      OS_MEM_SIZE blksize, OS_ERR *p_err);
+/*****************************************************************************************
+* MsgBufGet
+* Takes a buffer from pool with one reference, owned by the caller, and len 0.
+* Returns 0 with OS_ERR_MEM_NO_FREE_BLKS when the pool is empty. ISR safe.
+*****************************************************************************************/
+MSG_BUF *MsgBufGet(OS_MEM *pool, OS_ERR *p_err);
+/*****************************************************************************************
+* MsgBufRef
+* Adds a reference for a new holder. ISR safe.
+*****************************************************************************************/
+void MsgBufRef(MSG_BUF *buf);
+/*****************************************************************************************
+* MsgBufRelease
+* Drops a reference. The last one returns the buffer to its pool. ISR safe.
+*****************************************************************************************/
+void MsgBufRelease(MSG_BUF *buf);
+/*****************************************************************************************
+* MsgBufPost
+* Posts buf to the nq queues in qtbl, each with a reference of its own. opt is passed
+* to OSQPost(). With more than one queue the scheduler runs once, after the last post,
+* unless opt has OS_OPT_POST_NO_SCHED. The caller keeps its own reference.
+* Returns the number of queues posted to, p_err holds the last error.
+*****************************************************************************************/
+INT8U MsgBufPost(MSG_BUF *buf, OS_Q *const qtbl[], INT8U nq, OS_OPT opt, OS_ERR *p_err);
+/*****************************************************************************************
+* MsgBufPend
+* OSQPend() for a queue of buffers. The caller owns the reference of the buffer
+* returned and must release it.
+*****************************************************************************************/
+MSG_BUF *MsgBufPend(OS_Q *q, OS_TICK timeout, OS_OPT opt, OS_ERR *p_err);
+
+#endif
@@ -131,9 +131,16 @@ static void keyTask(void *p_arg) {
     INT8U last_key = 0;
     KEYSTATES KeyState = KEY_OFF;
     (void)p_arg;
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    OSTaskEdfSet((OS_TCB *)0, APP_CFG_KEY_TASK_PERIOD, APP_CFG_KEY_TASK_DEADLINE, &os_err);
+#endif
     while(1){
 		DB3_TURN_OFF();
-        OSTimeDly(8,OS_OPT_TIME_PERIODIC,&os_err);
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+        OSTaskEdfWait(&os_err);
+#else
+        OSTimeDly(APP_CFG_KEY_TASK_PERIOD,OS_OPT_TIME_PERIODIC,&os_err);
+#endif
 		DB3_TURN_ON();
         while(os_err != OS_ERR_NONE){           /* Error Trap                        */
         }
@@ -0,0 +1,21 @@
+/*****************************************************************************************
+* MCUType.h - Host port
+* Uses the application's types with INT32U and INT32S kept at 32 bits. They are long in
+* MCUType.h, which is 64 bits on the host, so board code that walks memory through an
+* INT32U pointer would step 8 bytes at a time.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_MCU_TYPE_H
+#define HOST_MCU_TYPE_H
+
+#define INT32U          HOST_INT32U_TARGET
+#define INT32S          HOST_INT32S_TARGET
+#include "../source/MCUType.h"
+#undef INT32U
+#undef INT32S
+
+typedef unsigned int    INT32U;
+typedef signed int      INT32S;
+
+#endif
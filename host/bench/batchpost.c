@@ -0,0 +1,194 @@
+/*****************************************************************************************
+* batchpost - Batched post and pend benchmark
+* A producer posts bursts of B events to a higher priority consumer, one event at a time
+* and then with one OSSemPostN(), OSQPostN() or OSTaskQPostN() call. The queue consumers
+* pend with OSQPendN()/OSTaskQPendN() for the batch runs. Prints context switches and
+* TSC cycles per event and checks that every message arrives in FIFO order.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+#include "os.h"
+
+#define EVENTS      65536u
+#define BURST_MAX   64u
+#define STK_SIZE    256u
+
+typedef enum{ OBJ_SEM, OBJ_Q, OBJ_TASKQ }OBJ_KIND;
+
+static OS_TCB mainTCB;
+static OS_TCB semTCB;
+static OS_TCB qTCB;
+static OS_TCB taskQTCB;
+static CPU_STK mainStk[STK_SIZE];
+static CPU_STK semStk[STK_SIZE];
+static CPU_STK qStk[STK_SIZE];
+static CPU_STK taskQStk[STK_SIZE];
+
+static OS_SEM sem;
+static OS_Q q;
+static void *msgTbl[BURST_MAX];
+static OS_MSG_SIZE sizeTbl[BURST_MAX];
+
+static volatile CPU_BOOLEAN useBatch;
+static unsigned long consumed;
+static unsigned curBurst;
+static unsigned long orderErrs;
+
+static void checkOrder(void **p_msg, unsigned n){
+    unsigned i;
+    for(i = 0; i < n; i++){
+        if((long)p_msg[i] != (long)((consumed + i) % curBurst) + 1){
+            orderErrs++;
+        }else{
+        }
+    }
+}
+
+static void semTask(void *p_arg){
+    OS_ERR os_err;
+    (void)p_arg;
+    for(;;){
+        (void)OSSemPend(&sem, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        consumed++;
+    }
+}
+
+static void qTask(void *p_arg){
+    OS_ERR os_err;
+    OS_MSG_QTY cnt;
+    void *msg[BURST_MAX];
+    OS_MSG_SIZE size[BURST_MAX];
+    (void)p_arg;
+    for(;;){
+        if(useBatch){
+            cnt = OSQPendN(&q, msg, size, BURST_MAX, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+        }else{
+            msg[0] = OSQPend(&q, 0u, OS_OPT_PEND_BLOCKING, &size[0], (CPU_TS *)0, &os_err);
+            cnt = 1u;
+        }
+        checkOrder(msg, cnt);
+        consumed += cnt;
+    }
+}
+
+static void taskQTask(void *p_arg){
+    OS_ERR os_err;
+    OS_MSG_QTY cnt;
+    void *msg[BURST_MAX];
+    OS_MSG_SIZE size[BURST_MAX];
+    (void)p_arg;
+    for(;;){
+        if(useBatch){
+            cnt = OSTaskQPendN(msg, size, BURST_MAX, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+        }else{
+            msg[0] = OSTaskQPend(0u, OS_OPT_PEND_BLOCKING, &size[0], (CPU_TS *)0, &os_err);
+            cnt = 1u;
+        }
+        checkOrder(msg, cnt);
+        consumed += cnt;
+    }
+}
+
+static void runBench(const char *name, OBJ_KIND kind, CPU_BOOLEAN batch, unsigned burst){
+    OS_ERR os_err = OS_ERR_NONE;
+    unsigned long n = (EVENTS/burst)*burst;
+    unsigned long sw0;
+    unsigned long long t0;
+    unsigned long long t1;
+    unsigned r;
+    unsigned i;
+    useBatch = batch;
+    consumed = 0;
+    curBurst = burst;
+    sw0 = HostCtxSwCtr;
+    t0 = __rdtsc();
+    for(r = 0; r < EVENTS/burst; r++){
+        if(batch){
+            if(kind == OBJ_SEM){
+                (void)OSSemPostN(&sem, burst, OS_OPT_POST_NONE, &os_err);
+            }else if(kind == OBJ_Q){
+                (void)OSQPostN(&q, msgTbl, sizeTbl, burst, OS_OPT_POST_FIFO, &os_err);
+            }else{
+                (void)OSTaskQPostN(&taskQTCB, msgTbl, sizeTbl, burst, OS_OPT_POST_FIFO, &os_err);
+            }
+        }else{
+            for(i = 0; i < burst; i++){
+                if(kind == OBJ_SEM){
+                    (void)OSSemPost(&sem, OS_OPT_POST_1, &os_err);
+                }else if(kind == OBJ_Q){
+                    OSQPost(&q, msgTbl[i], sizeTbl[i], OS_OPT_POST_FIFO, &os_err);
+                }else{
+                    OSTaskQPost(&taskQTCB, msgTbl[i], sizeTbl[i], OS_OPT_POST_FIFO, &os_err);
+                }
+            }
+        }
+        if(os_err != OS_ERR_NONE){
+            printf("%s post error %d\n", name, os_err);
+            exit(1);
+        }else{
+        }
+    }
+    t1 = __rdtsc();
+    if(consumed != n){
+        printf("%s B=%u lost %lu of %lu\n", name, burst, n - consumed, n);
+        exit(1);
+    }else{
+    }
+    printf("%-6s %-6s B=%2u  ctxsw/msg %6.3f  cycles/msg %7.1f\n", name,
+           batch ? "batch" : "single", burst, (double)(HostCtxSwCtr - sw0)/n,
+           (double)(t1 - t0)/n);
+}
+
+static void mainTask(void *p_arg){
+    static const char *name[] = {"sem", "q", "taskq"};
+    OS_ERR os_err;
+    unsigned pass;
+    unsigned kind;
+    unsigned burst;
+    unsigned i;
+    (void)p_arg;
+    for(i = 0; i < BURST_MAX; i++){
+        msgTbl[i] = (void *)(long)(i + 1);
+        sizeTbl[i] = 4u;
+    }
+    OSSemCreate(&sem, "sem", 0u, &os_err);
+    OSQCreate(&q, "q", 2u*BURST_MAX, &os_err);
+    OSTaskCreate(&semTCB, "sem", semTask, (void *)0, 7u, &semStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&qTCB, "q", qTask, (void *)0, 8u, &qStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&taskQTCB, "taskq", taskQTask, (void *)0, 9u, &taskQStk[0], 0u, STK_SIZE,
+                 2u*BURST_MAX, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    for(pass = 0; pass < 2; pass++){
+        for(kind = OBJ_SEM; kind <= OBJ_TASKQ; kind++){
+            for(burst = 1; burst <= BURST_MAX; burst <<= 1){
+                runBench(name[kind], (OBJ_KIND)kind, DEF_FALSE, burst);
+                runBench(name[kind], (OBJ_KIND)kind, DEF_TRUE, burst);
+            }
+        }
+        if(pass == 0){
+            printf("---- second pass, warm ----\n");
+        }else{
+        }
+    }
+    printf("order errors %lu\n", orderErrs);
+    exit(orderErrs != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    OSInit(&os_err);
+    if(os_err != OS_ERR_NONE){
+        printf("OSInit error %d\n", os_err);
+        return 1;
+    }else{
+    }
+    OSTaskCreate(&mainTCB, "main", mainTask, (void *)0, 10u, &mainStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    printf("OSStart error %d\n", os_err);
+    return 1;
+}
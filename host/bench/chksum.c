@@ -0,0 +1,73 @@
+/*****************************************************************************************
+* chksum - MemChkSum() word kernel against a byte loop
+* For every start alignment 0..15 and every length 1..600, so every head and tail
+* length of the 8 byte SWAR word is covered, MemChkSum() must equal the byte at a time
+* 16-bit sum it replaced. Then random lengths up to 64 KB, and a 1 MB block of 0xFF,
+* which is the worst case for the 16-bit lanes between flushes.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "MemoryTools.h"
+
+#define LEN_SHORT   600
+#define LEN_MAX     65536
+#define ALIGN_MAX   16
+#define RUNS        2000
+#define FULL_SIZE   (1024*1024)
+
+#define CHECK(c)    do{ if(!(c)){ printf("FAIL line %d: %s\n", __LINE__, #c); failCnt++; } }while(0)
+
+static INT8U buf[ALIGN_MAX + FULL_SIZE];
+static int failCnt;
+
+/* MemChkSum before the word kernel */
+static INT16U byteSum(INT8U *startaddr, INT8U *endaddr){
+    INT16U sum = 0;
+    while(startaddr<endaddr){
+        sum = sum + *startaddr;
+        startaddr++;
+    }
+    sum = sum + *endaddr;
+    return sum;
+}
+
+static void checkRange(int a, int len){
+    INT16U word = MemChkSum(&buf[a], &buf[a + len - 1]);
+    INT16U byte = byteSum(&buf[a], &buf[a + len - 1]);
+    if(word != byte){
+        printf("FAIL start %d length %d: MemChkSum %04X byte loop %04X\n", a, len, word, byte);
+        failCnt++;
+    }else{
+    }
+}
+
+int main(void){
+    unsigned seed = 1u;
+    int a;
+    int len;
+    int i;
+
+    for(i = 0; i < (int)sizeof(buf); i++){
+        seed = seed*1103515245u + 12345u;
+        buf[i] = (INT8U)(seed >> 16);
+    }
+    for(a = 0; a < ALIGN_MAX; a++){
+        for(len = 1; len <= LEN_SHORT; len++){
+            checkRange(a, len);
+        }
+    }
+    for(i = 0; i < RUNS; i++){
+        seed = seed*1103515245u + 12345u;
+        checkRange(i % ALIGN_MAX, (int)((seed >> 8) % LEN_MAX) + 1);
+    }
+
+    memset(buf, 0xFF, sizeof(buf));
+    for(a = 0; a < ALIGN_MAX; a++){
+        checkRange(a, FULL_SIZE);
+    }
+    CHECK(MemChkSum(&buf[0], &buf[FULL_SIZE - 1]) == (INT16U)(0xFFu*FULL_SIZE));
+    printf("%s (%d failures)\n", (failCnt != 0) ? "FAILED" : "ok", failCnt);
+    return failCnt != 0;
+}
@@ -0,0 +1,130 @@
+/*****************************************************************************************
+* crc0test - MemCRCGet() word path against the byte path on the CRC0 model
+* MemoryTools.c runs unmodified against the CRC0 model in crc0/, set up by the real
+* MemCRCConfig(). For every start alignment 0..7 and random lengths, the CRC from
+* MemCRCGet(), which writes aligned words to DATA, must match the byte path it replaced,
+* which wrote every byte to the ACCESS8BIT lanes in turn, and MemCRCSwGet(). The
+* "123456789" check value is 0xBB3D (CRC-16/ARC) complemented. Prints the data register
+* writes per byte of both paths.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "MemoryTools.h"
+#include "MemCRCSw.h"
+
+#define LEN_MAX     4096
+#define ALIGN_MAX   8
+#define RUNS        4000
+
+#define CHECK(c)    do{ if(!(c)){ printf("FAIL line %d: %s\n", __LINE__, #c); failCnt++; } }while(0)
+
+typedef enum{HU,HL,LU,LL}WRITE_DEST;
+
+static INT8U buf[ALIGN_MAX + LEN_MAX];
+static int failCnt;
+
+/* MemCRCGet() before the word path, one 8 bit write per byte rotating over the lanes */
+static INT16U memCRCGetBytes(INT8U *startaddr, INT8U *endaddr){
+    WRITE_DEST current_state = HU;                     //write to HU first
+    while(startaddr<endaddr){
+
+        switch(current_state){                         //write to different registers depending on state
+            case HU:
+                CRC0->ACCESS8BIT.DATAHU = *startaddr;
+                startaddr++;
+                current_state = HL;
+                break;
+            case HL:
+                CRC0->ACCESS8BIT.DATAHL = *startaddr;
+                startaddr++;
+                current_state = LU;
+                break;
+            case LU:
+                CRC0->ACCESS8BIT.DATALU = *startaddr;
+                startaddr++;
+                current_state = LL;
+                break;
+            case LL:
+                CRC0->ACCESS8BIT.DATALL = *startaddr;
+                startaddr++;
+                current_state = HU;
+                break;
+            default:
+                current_state = HU;
+                break;
+        }
+    }
+    switch(current_state){                             //Avoid terminal count bug
+        case HU:
+            CRC0->ACCESS8BIT.DATAHU = *startaddr;
+            break;
+        case HL:
+            CRC0->ACCESS8BIT.DATAHL = *startaddr;
+            break;
+        case LU:
+            CRC0->ACCESS8BIT.DATALU = *startaddr;
+            break;
+        case LL:
+            CRC0->ACCESS8BIT.DATALL = *startaddr;
+            break;
+        default:
+            break;
+    }
+    return CRC0->ACCESS16BIT.DATAL;
+}
+
+static unsigned long dataWrites(void){
+    return HostCRC0.writeCtr[1] + HostCRC0.writeCtr[2] + HostCRC0.writeCtr[4];
+}
+
+int main(void){
+    static INT8U check[] = "123456789";
+    unsigned long bytes = 0u;
+    unsigned long oldWrites = 0u;
+    unsigned long newWrites = 0u;
+    unsigned long w0;
+    unsigned seed = 1u;
+    INT16U crcWord;
+    INT16U crcByte;
+    INT16U crcSw;
+    int a;
+    int len;
+    int i;
+
+    MemCRCConfig();
+    CHECK(MemCRCGet(&check[0], &check[8]) == (0xBB3Du ^ 0xFFFFu));
+    MemCRCConfig();
+    CHECK(memCRCGetBytes(&check[0], &check[8]) == (0xBB3Du ^ 0xFFFFu));
+
+    for(i = 0; i < (int)sizeof(buf); i++){
+        seed = seed*1103515245u + 12345u;
+        buf[i] = (INT8U)(seed >> 16);
+    }
+    for(i = 0; i < RUNS; i++){
+        a = i % ALIGN_MAX;
+        seed = seed*1103515245u + 12345u;
+        len = (i < 64) ? (i/ALIGN_MAX + 1) : (int)((seed >> 8) % LEN_MAX) + 1;
+        MemCRCConfig();
+        w0 = dataWrites();
+        crcWord = MemCRCGet(&buf[a], &buf[a + len - 1]);
+        newWrites += dataWrites() - w0;
+        MemCRCConfig();
+        w0 = dataWrites();
+        crcByte = memCRCGetBytes(&buf[a], &buf[a + len - 1]);
+        oldWrites += dataWrites() - w0;
+        crcSw = MemCRCSwGet(&buf[a], &buf[a + len - 1]);
+        bytes += (unsigned long)len;
+        if((crcWord != crcByte) || (crcWord != crcSw)){
+            printf("FAIL start %d length %d: word path %04X byte path %04X MemCRCSwGet %04X\n",
+                   a, len, crcWord, crcByte, crcSw);
+            failCnt++;
+        }else{
+        }
+    }
+    printf("data register writes per byte: byte path %.3f, word path %.3f\n",
+           (double)oldWrites/bytes, (double)newWrites/bytes);
+    printf("%s (%d failures)\n", (failCnt != 0) ? "FAILED" : "ok", failCnt);
+    return failCnt != 0;
+}
@@ -0,0 +1,174 @@
+/*****************************************************************************************
+* crcsvc - MemCRCService contexts and software fallback on the CRC0 model
+* MemCRCService.c and MemoryTools.c run unmodified against the CRC0 model in crc0/.
+* Clients above the service task, each with its own polynomial and seed, feed their
+* block in random pieces with random delays between them, so requests from different
+* contexts queue up and interleave on CRC0. Every other request passes MEM_CRC_OPT_SW_OK
+* and is computed in the client when the service is busy. After every request the result
+* must equal a reference computed the reflected way, one bit at a time, over everything
+* fed so far. Both the CRC0 path and the software path must have been taken. The
+* "123456789" check value is 0xBB3D (CRC-16/ARC) complemented. Time is virtual: the idle
+* hook runs OSTimeTick() as the tick ISR would.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "os.h"
+#include "app_cfg.h"
+#include "MemoryTools.h"
+#include "MemCRCSw.h"
+#include "MemCRCService.h"
+
+#define TICKS_MAX       200000u
+#define STK_SIZE        512u
+#define CLIENTS         4
+#define BLOCK_SIZE      (64u*1024u)
+#define PIECE_MAX       3000u
+#define PEND_MAX        3u
+
+#define CHECK(c)    do{ if(!(c)){ printf("FAIL line %d: %s\n", __LINE__, #c); failCnt++; } }while(0)
+
+static const INT16U polyTbl[CLIENTS] = {0x8005u, 0x1021u, 0x8BB7u, 0x3D65u};
+
+static OS_TCB clientTCB[CLIENTS];
+static CPU_STK clientStk[CLIENTS][STK_SIZE];
+static INT8U buf[CLIENTS][BLOCK_SIZE];
+static int failCnt;
+static int doneCnt;
+static unsigned long hwCnt;
+static unsigned long swCnt;
+
+static void simIdle(void){
+    OSIntEnter();
+    OSTimeTick();
+    OSIntExit();
+    if(OSTickCtr > TICKS_MAX){
+        printf("FAIL: no progress after %u ticks\n", TICKS_MAX);
+        exit(1);
+    }else{
+    }
+}
+
+static INT16U reflect16(INT16U value){
+    INT16U out = 0u;
+    int i;
+    for(i = 0; i < 16; i++){
+        out = (INT16U)((out << 1) | (value & 1u));
+        value = value >> 1;
+    }
+    return out;
+}
+
+/* Adds len bytes to reg, the CRC register reflected, with the reflected polynomial */
+static INT16U refUpdate(INT16U reg, INT16U poly, const INT8U *p, INT32U len){
+    INT16U rpoly = reflect16(poly);
+    int bit;
+    while(len > 0u){
+        reg = reg ^ *p;
+        for(bit = 0; bit < 8; bit++){
+            reg = ((reg & 1u) != 0u) ? (INT16U)((reg >> 1) ^ rpoly) : (INT16U)(reg >> 1);
+        }
+        p++;
+        len--;
+    }
+    return reg;
+}
+
+static unsigned long dataWrites(void){
+    return HostCRC0.writeCtr[1] + HostCRC0.writeCtr[2] + HostCRC0.writeCtr[4];
+}
+
+static void clientTask(void *p_arg){
+    int c = (int)(intptr_t)p_arg;
+    OS_ERR os_err;
+    MEM_CRC_CTX ctx;
+    unsigned seed = 7u*(unsigned)c + 1u;
+    unsigned long w0;
+    INT32U pos = 0u;
+    INT32U len;
+    INT16U ref;
+    INT16U crc;
+    INT8U opt;
+    int req = 0;
+
+    seed = seed*1103515245u + 12345u;
+    MemCRCCtxInit(&ctx, polyTbl[c], (INT16U)(seed >> 8));
+    ref = reflect16(ctx.crc);
+    while(pos < BLOCK_SIZE){
+        seed = seed*1103515245u + 12345u;
+        len = (seed >> 8) % PIECE_MAX + 1u;
+        len = (len > BLOCK_SIZE - pos) ? (BLOCK_SIZE - pos) : len;
+        opt = ((req & 1) != 0) ? MEM_CRC_OPT_SW_OK : MEM_CRC_OPT_NONE;
+        w0 = dataWrites();
+        crc = MemCRCServiceRun(&ctx, &buf[c][pos], &buf[c][pos + len - 1u], opt, &os_err);
+        CHECK(os_err == OS_ERR_NONE);
+        if(dataWrites() == w0){                     //Nothing else feeds CRC0 in between
+            swCnt++;
+            CHECK(opt == MEM_CRC_OPT_SW_OK);
+        }else{
+            hwCnt++;
+        }
+        ref = refUpdate(ref, polyTbl[c], &buf[c][pos], len);
+        if((crc != (INT16U)~ref) || (ctx.crc != reflect16(ref))){
+            printf("FAIL client %d poly %04X request %d: %04X, expected %04X\n", c, polyTbl[c],
+                   req, crc, (INT16U)~ref);
+            failCnt++;
+        }else{
+        }
+        pos += len;
+        req++;
+        seed = seed*1103515245u + 12345u;
+        OSTimeDly((seed >> 8) % PEND_MAX, OS_OPT_TIME_DLY, &os_err);
+    }
+    crc = MemCRCServiceRun(&ctx, &buf[c][1], &buf[c][0], MEM_CRC_OPT_NONE, &os_err);
+    CHECK(crc == (INT16U)~ref);                     //An empty block adds nothing
+    printf("client %d poly %04X: %d requests, CRC %04X\n", c, polyTbl[c], req, crc);
+    doneCnt++;
+    if(doneCnt == CLIENTS){
+        printf("CRC0 path %lu, software path %lu\n", hwCnt, swCnt);
+        CHECK((hwCnt != 0u) && (swCnt != 0u));
+        printf("%s (%d failures)\n", (failCnt != 0) ? "FAILED" : "ok", failCnt);
+        exit(failCnt != 0);
+    }else{
+    }
+    OSTaskDel((OS_TCB *)0, &os_err);
+}
+
+/* Runs first, above the clients, then lets them go */
+static void startTask(void *p_arg){
+    static INT8U check[] = "123456789";
+    OS_ERR os_err;
+    MEM_CRC_CTX ctx;
+    int c;
+    (void)p_arg;
+
+    MemCRCServiceInit();
+    MemCRCCtxInit(&ctx, 0x8005u, 0x0000u);
+    CHECK(MemCRCServiceRun(&ctx, &check[0], &check[8], MEM_CRC_OPT_NONE, &os_err) == (0xBB3Du ^ 0xFFFFu));
+    CHECK(MemCRCSwGet(&check[0], &check[8]) == (0xBB3Du ^ 0xFFFFu));
+    for(c = 0; c < CLIENTS; c++){
+        OSTaskCreate(&clientTCB[c], "client", clientTask, (void *)(intptr_t)c, (OS_PRIO)(20 + c),
+                     &clientStk[c][0], 0u, STK_SIZE, 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+        CHECK(os_err == OS_ERR_NONE);
+    }
+    OSTaskDel((OS_TCB *)0, &os_err);
+}
+
+int main(void){
+    static OS_TCB startTCB;
+    static CPU_STK startStk[STK_SIZE];
+    OS_ERR os_err;
+    unsigned seed = 1u;
+    INT32U i;
+    for(i = 0; i < sizeof(buf); i++){
+        seed = seed*1103515245u + 12345u;
+        (&buf[0][0])[i] = (INT8U)(seed >> 16);
+    }
+    HostIdleHookPtr = simIdle;
+    OSInit(&os_err);
+    OSTaskCreate(&startTCB, "start", startTask, (void *)0, 10u, &startStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
@@ -0,0 +1,109 @@
+/*****************************************************************************************
+* crcsw - MemCRCSw check values and cross checks
+* A bitwise reference CRC first reproduces the catalogue check values for "123456789":
+* 0xBB3D for CRC-16/ARC and 0xCBF43926 for CRC-32. MemCRCSwGet(), MemCRCSwGetSlice4()
+* and MemCRCSwGetByte() use the same polynomials with seed 0 and the result complemented
+* (MemCRCConfig()). So the 16 bit CRC of "123456789" is 0xBB3D^0xFFFF, and each function
+* must match the reference with those parameters. This holds for every start alignment
+* 0..7 and every length up to LEN_MAX, and for the empty range, where endaddr is one below
+* startaddr and must not be read.
+* Built as "crcsw" with MEM_CRC_SW_WIDTH 16 and "crcsw32" with 32.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemCRCSw.h"
+
+#define LEN_MAX     600
+#define ALIGN_MAX   8
+
+#define CHECK(c)    do{ if(!(c)){ printf("FAIL line %d: %s\n", __LINE__, #c); failCnt++; } }while(0)
+
+typedef MEM_CRC_SW (*CRC_FUNC)(INT8U *startaddr, INT8U *endaddr);
+
+static const struct{
+    const char *name;
+    CRC_FUNC func;
+}funcTbl[] = {
+    {"MemCRCSwGet", MemCRCSwGet},
+    {"MemCRCSwGetSlice4", MemCRCSwGetSlice4},
+    {"MemCRCSwGetByte", MemCRCSwGetByte},
+};
+
+static INT8U buf[ALIGN_MAX + LEN_MAX + 8];
+static int failCnt;
+
+/* Reflected CRC a bit at a time, poly is the bit reversed polynomial */
+static INT32U refCRC(unsigned width, INT32U poly, INT32U init, INT32U xorout,
+                     const INT8U *p, size_t len){
+    INT32U mask = (width == 32u) ? 0xFFFFFFFFu : ((1u << width) - 1u);
+    INT32U crc = init;
+    int bit;
+    while(len != 0u){
+        crc ^= *p;
+        for(bit = 0; bit < 8; bit++){
+            crc = (crc & 1u) ? ((crc >> 1) ^ poly) : (crc >> 1);
+        }
+        p++;
+        len--;
+    }
+    return (crc ^ xorout) & mask;
+}
+
+/* The reference with MemCRCSw's polynomial, seed and complement */
+static INT32U swRefCRC(const INT8U *p, size_t len){
+#if MEM_CRC_SW_WIDTH == 16u
+    return refCRC(16u, 0xA001u, 0u, 0xFFFFu, p, len);
+#else
+    return refCRC(32u, 0xEDB88320u, 0u, 0xFFFFFFFFu, p, len);
+#endif
+}
+
+int main(void){
+    static INT8U check[] = "123456789";
+    INT32U ref;
+    unsigned seed = 1u;
+    size_t i;
+    int f;
+    int a;
+    int len;
+
+    CHECK(refCRC(16u, 0xA001u, 0u, 0u, check, 9u) == 0xBB3Du);
+    CHECK(refCRC(32u, 0xEDB88320u, 0xFFFFFFFFu, 0xFFFFFFFFu, check, 9u) == 0xCBF43926u);
+#if MEM_CRC_SW_WIDTH == 16u
+    CHECK(swRefCRC(check, 9u) == (0xBB3Du ^ 0xFFFFu));
+#endif
+    for(f = 0; f < (int)(sizeof(funcTbl)/sizeof(funcTbl[0])); f++){
+        CHECK(funcTbl[f].func(&check[0], &check[8]) == swRefCRC(check, 9u));
+    }
+
+    for(i = 0; i < sizeof(buf); i++){
+        seed = seed*1103515245u + 12345u;
+        buf[i] = (INT8U)(seed >> 16);
+    }
+    for(a = 0; a < ALIGN_MAX; a++){
+        for(len = 1; len <= LEN_MAX; len++){
+            ref = swRefCRC(&buf[a], (size_t)len);
+            for(f = 0; f < (int)(sizeof(funcTbl)/sizeof(funcTbl[0])); f++){
+                if(funcTbl[f].func(&buf[a], &buf[a + len - 1]) != ref){
+                    printf("FAIL %s start %d length %d\n", funcTbl[f].name, a, len);
+                    failCnt++;
+                }else{
+                }
+            }
+        }
+    }
+
+    /* Empty range, the byte below startaddr is nonzero so reading it would show */
+    for(a = 1; a <= ALIGN_MAX; a++){
+        buf[a - 1] = 0x5Au;
+        for(f = 0; f < (int)(sizeof(funcTbl)/sizeof(funcTbl[0])); f++){
+            CHECK(funcTbl[f].func(&buf[a], &buf[a - 1]) == swRefCRC(buf, 0u));
+        }
+    }
+
+    printf("CRC-%u %s (%d failures)\n", (unsigned)MEM_CRC_SW_WIDTH, (failCnt != 0) ? "FAILED" : "ok", failCnt);
+    return failCnt != 0;
+}
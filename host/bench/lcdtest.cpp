@@ -0,0 +1,357 @@
+/*****************************************************************************************
+* lcdtest - LcdLayered frames against a stubbed bus
+* LcdLayered.c runs unmodified, driving the HD44780 model in lcd/. ctl, below the LCD
+* task, keeps a copy of every layer, lets each change reach the panel and checks that:
+*   1 the panel shows the layers composed, top layer over lower ones, spaces clear
+*   2 a frame writes only the characters that changed, and only on the dirty rows
+*   3 posts inside a frame interval are coalesced into one frame, LcdStatsGet() counts
+*   4 the cursor follows the top shown layer
+*   5 viewport scrolls move the window and are clamped to the layer
+*   6 the marquee shows only its layer, wraps, and with the display shift sends each
+*     step the short way round without rewriting characters
+*   7 stopping the marquee restores the layered display
+*   8 the bus is driven the right way, and when polling the busy flag nothing is
+*     written while the panel is busy
+* Built with the application's geometry, and as lcdtest4x20 with the 4x20 panel and 24
+* column layers of lcd/4x20/app_cfg.h, lcdtestpoll polling the busy flag on the 4 bit bus
+* and lcdtest8bit polling on the 8 bit bus. lcdtest1x16 and lcdtest1x16split cover the
+* single line panel and the 1x16 addressed as 2x8, whose second half is written from
+* DD RAM 0x40. Time is virtual: the idle hook runs OSTimeTick() as the tick ISR would.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MCUType.h"
+#include "os.h"
+#include "app_cfg.h"
+#include "LcdLayered.h"
+#include "MK65F18.h"
+
+#define TICKS_MAX       200000u
+#define STK_SIZE        512u
+#define SETTLE_TICKS    (2u*APP_CFG_LCD_FRAME_TICKS + 2u)
+
+/* As in LcdLayered.c */
+#define LINES2          ((LCD_NUM_ROWS > 1u) || (LCD_1X16_SPLIT != 0u))
+#define DDRAM_LINE      (LINES2 ? 40u : 80u)
+#define MARQUEE_HW      ((LCD_NUM_ROWS <= 2u) && (LCD_1X16_SPLIT == 0u) && (LCD_LAYER_COLS <= DDRAM_LINE))
+#define MARQUEE_COLS    (MARQUEE_HW ? DDRAM_LINE : LCD_LAYER_COLS)
+#define NO_MARQUEE      (-1)
+
+#define CHECK(c)    do{ if(!(c)){ printf("FAIL step %d line %d: %s\n", step, __LINE__, #c); failCnt++; } }while(0)
+
+typedef struct{
+    char ch[LCD_LAYER_ROWS][LCD_LAYER_COLS];
+    int hidden;
+    int orgRow;
+    int orgCol;
+}SHADOW;
+
+static OS_TCB ctlTCB;
+static CPU_STK ctlStk[STK_SIZE];
+static SHADOW shadow[LCD_NUM_LAYERS];
+static int marquee = NO_MARQUEE;
+static unsigned long data0;
+static unsigned long line0[2];
+static unsigned long sets0[2];
+static unsigned long busyWrites0;
+static int failCnt;
+static int step;
+
+static void simIdle(void){
+    OSIntEnter();
+    OSTimeTick();
+    OSIntExit();
+    if(OSTickCtr > TICKS_MAX){
+        printf("FAIL step %d: no progress after %u ticks\n", step, TICKS_MAX);
+        exit(1);
+    }else{
+    }
+}
+
+/* Lets the posted changes reach the panel and starts counting writes again */
+static void settle(void){
+    OS_ERR os_err;
+    OSTimeDly(SETTLE_TICKS, OS_OPT_TIME_DLY, &os_err);
+}
+
+static void mark(void){
+    data0 = HostLcd.dataWrites;
+    line0[0] = HostLcd.lineWrites[0];
+    line0[1] = HostLcd.lineWrites[1];
+    sets0[0] = HostLcd.lineSets[0];
+    sets0[1] = HostLcd.lineSets[1];
+}
+
+static unsigned long dataWrites(void){
+    return HostLcd.dataWrites - data0;
+}
+
+static unsigned long lineWrites(int line){
+    return HostLcd.lineWrites[line] - line0[line];
+}
+
+/* Rows of the DD RAM line visited, each row written starts with its address */
+static unsigned long lineSets(int line){
+    return HostLcd.lineSets[line] - sets0[line];
+}
+
+static void put(int layer, int row, int col, const char *str){
+    int i;
+    for(i = 0; (str[i] != 0) && ((col - 1 + i) < (int)LCD_LAYER_COLS); i++){
+        shadow[layer].ch[row - 1][col - 1 + i] = str[i];
+    }
+    LcdDispString((INT8U)row, (INT8U)col, (INT8U)layer, str);
+}
+
+static int clamp(int v, int max){
+    return (v < 0) ? 0 : (v > max) ? max : v;
+}
+
+static char expected(int row, int col){
+    const SHADOW *s;
+    char ch = ' ';
+    int src;
+    int l;
+    if(marquee != NO_MARQUEE){
+        s = &shadow[marquee];
+        src = (s->orgCol + col) % (int)MARQUEE_COLS;
+        return (src < (int)LCD_LAYER_COLS) ? s->ch[s->orgRow + row][src] : ' ';
+    }else{
+    }
+    for(l = 0; l < LCD_NUM_LAYERS; l++){
+        s = &shadow[l];
+        if(!s->hidden && (s->ch[s->orgRow + row][s->orgCol + col] != ' ')){
+            ch = s->ch[s->orgRow + row][s->orgCol + col];
+        }else{
+        }
+    }
+    return ch;
+}
+
+static void checkPanel(void){
+    char want[LCD_NUM_COLS + 1];
+    char got[LCD_NUM_COLS + 1];
+    unsigned row;
+    unsigned col;
+    for(row = 0; row < LCD_NUM_ROWS; row++){
+        for(col = 0; col < LCD_NUM_COLS; col++){
+            want[col] = expected((int)row, (int)col);
+            got[col] = HostLcdChar(row, col, LCD_NUM_COLS);
+        }
+        want[LCD_NUM_COLS] = 0;
+        got[LCD_NUM_COLS] = 0;
+        if(strcmp(want, got) != 0){
+            printf("FAIL step %d row %u: panel \"%s\" expected \"%s\"\n", step, row + 1u, got, want);
+            failCnt++;
+        }else{
+        }
+    }
+}
+
+/* One marquee step of cols. With the display shift it must go the short way round the
+ * DD RAM line and write no characters. */
+static void marqueeStep(int cols){
+    unsigned long shift0 = HostLcd.shiftCmds;
+    SHADOW *s = &shadow[marquee];
+    int shifts = (cols % (int)DDRAM_LINE + (int)DDRAM_LINE) % (int)DDRAM_LINE;
+    shifts = (shifts > (int)DDRAM_LINE/2) ? ((int)DDRAM_LINE - shifts) : shifts;
+    s->orgCol = ((s->orgCol + cols) % (int)MARQUEE_COLS + (int)MARQUEE_COLS) % (int)MARQUEE_COLS;
+    mark();
+    LcdMarqueeStep((INT8S)cols);
+    settle();
+    checkPanel();
+    if(MARQUEE_HW){
+        CHECK(dataWrites() == 0u);
+        CHECK(HostLcd.shiftCmds - shift0 == (unsigned long)shifts);
+    }else{
+    }
+}
+
+static void ctlTask(void *p_arg){
+    char text[LCD_LAYER_COLS + 1];
+    LCD_STATS stats0;
+    LCD_STATS stats;
+    int l;
+    int i;
+    (void)p_arg;
+
+    memset(shadow, ' ', sizeof(shadow));
+    for(l = 0; l < LCD_NUM_LAYERS; l++){
+        shadow[l].hidden = 0;
+        shadow[l].orgRow = 0;
+        shadow[l].orgCol = 0;
+    }
+    HostLcd.split = (LCD_1X16_SPLIT != 0u);
+    LcdInit();
+    step = 1;
+    settle();
+    CHECK(HostLcd.bus8 == (APP_CFG_LCD_BUS_8BIT != 0u));
+    CHECK(HostLcd.lines2 == LINES2);
+    CHECK(HostLcd.dispOn);
+    checkPanel();
+    busyWrites0 = HostLcd.busyWrites;           /* The reset sequence is timed        */
+
+    /* Only the changed characters of the dirty row are written */
+    step = 2;
+    mark();
+    put(0, 1, 1, "Hello");
+    settle();
+    checkPanel();
+    CHECK(dataWrites() == 5u);
+    CHECK(lineWrites(1) == 0u);
+    CHECK(lineSets(1) == 0u);
+#if LCD_NUM_ROWS > 1u
+    mark();
+    put(0, 2, 3, "World");
+    settle();
+    checkPanel();
+    CHECK(dataWrites() == 5u);
+    CHECK(lineWrites(0) == 0u);
+    CHECK(lineSets(0) == 1u);                       /* The cursor, on row 1             */
+#endif
+#if LCD_1X16_SPLIT != 0u
+    mark();
+    put(0, 1, 7, "wxyz");                           /* Across the halves                */
+    settle();
+    checkPanel();
+    CHECK(dataWrites() == 4u);
+    CHECK(lineWrites(1) == 2u);
+    CHECK(lineSets(1) == 1u);
+#endif
+    mark();
+    put(0, 1, 1, "Hello");
+    settle();
+    CHECK(dataWrites() == 0u);
+
+    /* Layers, spaces are transparent */
+    mark();
+    put(1, 1, 3, "ab");
+    settle();
+    checkPanel();
+    CHECK(dataWrites() == 2u);
+    mark();
+    shadow[1].hidden = 1;
+    LcdHideLayer(1);
+    settle();
+    checkPanel();
+    CHECK(dataWrites() == 2u);
+    shadow[1].hidden = 0;
+    LcdToggleLayer(1);
+    settle();
+    checkPanel();
+
+    /* A burst of posts: the first is drawn at once, the rest in one more frame */
+    step = 3;
+    LcdStatsGet(&stats0);
+    mark();
+    for(i = 0; i < 8; i++){
+        shadow[0].ch[0][LCD_NUM_COLS - 8 + i] = (char)('A' + i);
+        LcdDispChar(1, (INT8U)(LCD_NUM_COLS - 7 + i), 0, (INT8C)('A' + i));
+    }
+    settle();
+    checkPanel();
+    CHECK(dataWrites() == 8u);
+    LcdStatsGet(&stats);
+    CHECK(stats.frames_drawn - stats0.frames_drawn == 2u);
+    CHECK(stats.frames_skipped - stats0.frames_skipped == 6u);
+    CHECK(stats.max_stale_ticks <= APP_CFG_LCD_FRAME_TICKS);
+
+    /* The cursor of the top shown layer, with no characters rewritten */
+    step = 4;
+    mark();
+    LcdCursor(LCD_NUM_ROWS, 5, 2, TRUE, FALSE);
+    settle();
+    CHECK(dataWrites() == 0u);
+    CHECK(HostLcd.cursorOn && !HostLcd.blinkOn);
+    CHECK(HostLcd.ac == (((LCD_NUM_ROWS & 1u) == 0u) ? 0x40u : 0u) + ((LCD_NUM_ROWS > 2u) ? LCD_NUM_COLS : 0u) + 4u);
+#if LCD_1X16_SPLIT != 0u
+    LcdCursor(1, 12, 2, TRUE, FALSE);
+    settle();
+    CHECK(HostLcd.ac == 0x43u);
+#endif
+    LcdCursor(1, 1, 2, FALSE, FALSE);
+    settle();
+    CHECK(!HostLcd.cursorOn);
+
+    /* Viewport, clamped to the layer */
+    step = 5;
+    for(i = 0; i < (int)LCD_LAYER_COLS; i++){
+        text[i] = (char)('a' + i % 26);
+    }
+    text[LCD_LAYER_COLS] = 0;
+    put(0, 1, 1, text);
+    settle();
+    shadow[0].orgCol = clamp(3, (int)(LCD_LAYER_COLS - LCD_NUM_COLS));
+    LcdLayerScroll(0, 0, 3);
+    settle();
+    checkPanel();
+    shadow[0].orgCol = 0;
+    LcdLayerScroll(0, 0, -10);
+    settle();
+    checkPanel();
+
+    /* Marquee of layer 2, which hides the others */
+    step = 6;
+    for(i = 0; i < (int)LCD_LAYER_COLS; i++){
+        text[i] = (i == 4) ? ' ' : (char)('0' + i % 10);
+    }
+    put(2, 1, 1, text);
+#if LCD_NUM_ROWS > 1u
+    put(2, LCD_NUM_ROWS, 1, "marquee");
+#endif
+    settle();
+    checkPanel();
+    marquee = 2;
+    LcdMarqueeStart(2);
+    settle();
+    checkPanel();
+    marqueeStep(1);
+    marqueeStep(1);
+    marqueeStep(30);
+    marqueeStep(-35);
+    marqueeStep(-1);
+    mark();
+    put(0, 1, 1, "X");
+    settle();
+    checkPanel();
+    CHECK(dataWrites() == 0u);
+    put(2, 1, 2, "#");
+    settle();
+    checkPanel();
+    CHECK(dataWrites() == 1u);
+
+    step = 7;
+    marquee = NO_MARQUEE;
+    shadow[2].orgCol = 0;
+    LcdMarqueeStop();
+    settle();
+    checkPanel();
+    CHECK(HostLcd.shift == 0);
+
+    step = 8;
+    CHECK(HostLcd.busErrors == 0u);
+    if(APP_CFG_LCD_BUSY_POLL != 0u){
+        CHECK(HostLcd.busyReads != 0u);
+        CHECK(HostLcd.busyWrites == busyWrites0);
+    }else{
+        CHECK(HostLcd.busyReads == 0u);
+    }
+
+    printf("%ux%u%s %u bit%s: %s (%d failures)\n", LCD_NUM_ROWS, LCD_NUM_COLS,
+           (LCD_1X16_SPLIT != 0u) ? " split" : "", (APP_CFG_LCD_BUS_8BIT != 0u) ? 8u : 4u, (APP_CFG_LCD_BUSY_POLL != 0u) ? " busy poll" : "",
+           (failCnt != 0) ? "FAILED" : "ok", failCnt);
+    exit(failCnt != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    HostIdleHookPtr = simIdle;
+    OSInit(&os_err);
+    OSTaskCreate(&ctlTCB, (CPU_CHAR *)"ctl", ctlTask, (void *)0, 20u, &ctlStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
@@ -0,0 +1,173 @@
+/*****************************************************************************************
+* memidx - MemIndex tree against a rebuilt reference
+* For ranges of one block up to MEM_IDX_MAX_BLOCKS, with and without a partial last
+* block:
+*   1 every leaf is the MemCRCSwGet() of its block and every node the CRC of its
+*     children, little-endian, recomputed here independently
+*   2 after random blocks are corrupted, MemIdxFind() from 0 and then from each block
+*     found lists exactly those blocks, in order
+*   3 MemIdxCheck() returns the first corrupted block in a range, clipped to the index
+*   4 MemIdxUpdate() of each restored block gives the index a full rebuild gives, and the
+*     reference root once all are restored
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "MemIndex.h"
+
+#define BUF_SIZE    (MEM_IDX_MAX_BLOCKS*MEM_IDX_BLOCK_SIZE)
+#define BAD_MAX     8
+#define GUARD       128                     /* Bytes either side, for the clipped checks */
+
+#define CHECK(c)    do{ if(!(c)){ printf("FAIL size %u line %d: %s\n", size, __LINE__, #c); failCnt++; } }while(0)
+
+static INT8U mem[GUARD + BUF_SIZE + GUARD];
+static INT8U *const buf = &mem[GUARD];
+static INT8U saved[BUF_SIZE];
+static MEM_IDX ref;
+static MEM_IDX cur;
+static MEM_IDX full;
+static int failCnt;
+static unsigned seed = 1u;
+static INT32U size;
+
+static unsigned rnd(void){
+    seed = seed*1103515245u + 12345u;
+    return seed >> 8;
+}
+
+/* Every leaf and node of idx, rebuilt from the memory */
+static void checkTree(const MEM_IDX *idx){
+    INT8U pair[2u*sizeof(MEM_CRC_SW)];
+    INT8U *end;
+    MEM_CRC_SW want;
+    INT32U i;
+    unsigned b;
+    CHECK(idx->nleaves >= idx->nblocks);
+    CHECK((idx->nleaves & (idx->nleaves - 1u)) == 0u);
+    CHECK((idx->nleaves == 1u) || (idx->nleaves < 2u*idx->nblocks));
+    for(i = 0; i < idx->nleaves; i++){
+        want = 0;
+        if(i < idx->nblocks){
+            end = idx->base + (i + 1u)*MEM_IDX_BLOCK_SIZE - 1u;
+            want = MemCRCSwGet(idx->base + i*MEM_IDX_BLOCK_SIZE, (end < idx->end) ? end : idx->end);
+        }else{
+        }
+        CHECK(idx->node[idx->nleaves + i] == want);
+    }
+    for(i = idx->nleaves - 1u; i > 0u; i--){
+        for(b = 0; b < sizeof(MEM_CRC_SW); b++){
+            pair[b] = (INT8U)(idx->node[2u*i] >> (8u*b));
+            pair[sizeof(MEM_CRC_SW) + b] = (INT8U)(idx->node[2u*i + 1u] >> (8u*b));
+        }
+        CHECK(idx->node[i] == MemCRCSwGet(&pair[0], &pair[sizeof(pair) - 1u]));
+    }
+}
+
+static void testRange(INT32U len){
+    INT32U bad[BAD_MAX];
+    INT8U *end = &buf[len - 1u];
+    INT32U nblocks = (len - 1u)/MEM_IDX_BLOCK_SIZE + 1u;
+    INT32U nbad = 0;
+    INT32U block;
+    INT32U from;
+    INT32U first;
+    INT32U last;
+    INT32U i;
+    INT32U j;
+    unsigned run;
+    size = len;
+
+    MemIdxBuild(&ref, &buf[0], end);
+    CHECK(ref.nblocks == nblocks);
+    checkTree(&ref);
+    CHECK(MemIdxCheck(&ref, &buf[0], end) == MEM_IDX_NONE);
+    MemIdxBuild(&cur, &buf[0], end);
+    CHECK(MemIdxFind(&ref, &cur, 0) == MEM_IDX_NONE);
+
+    /* Corrupt up to BAD_MAX distinct blocks, always the last byte of the range once */
+    memcpy(saved, buf, len);
+    for(run = 0; run < BAD_MAX; run++){
+        block = (run == 0) ? (nblocks - 1u) : (rnd() % nblocks);
+        for(j = 0; (j < nbad) && (bad[j] != block); j++){
+        }
+        if(j == nbad){
+            bad[nbad] = block;
+            nbad++;
+            if(run == 0){
+                *end ^= 0x01u;
+            }else{
+                buf[block*MEM_IDX_BLOCK_SIZE + rnd() % ((block == nblocks - 1u) ?
+                    (len - block*MEM_IDX_BLOCK_SIZE) : MEM_IDX_BLOCK_SIZE)] ^= (INT8U)(1u << (rnd() % 8u));
+            }
+        }else{
+        }
+    }
+    for(i = 1; i < nbad; i++){                  /* Sort, Find reports in block order */
+        for(j = i; (j > 0u) && (bad[j - 1u] > bad[j]); j--){
+            block = bad[j];
+            bad[j] = bad[j - 1u];
+            bad[j - 1u] = block;
+        }
+    }
+
+    MemIdxBuild(&cur, &buf[0], end);
+    checkTree(&cur);
+    from = 0;
+    for(i = 0; i < nbad; i++){
+        block = MemIdxFind(&ref, &cur, from);
+        if(block != bad[i]){
+            printf("FAIL size %u: MemIdxFind from %u gave %d, expected %u\n", len, from, (int)block, bad[i]);
+            failCnt++;
+        }else{
+        }
+        from = bad[i] + 1u;
+    }
+    CHECK(MemIdxFind(&ref, &cur, from) == MEM_IDX_NONE);
+    CHECK(MemIdxFind(&ref, &cur, nblocks) == MEM_IDX_NONE);
+
+    CHECK(MemIdxCheck(&ref, &buf[0], end) == bad[0]);
+    CHECK(MemIdxCheck(&ref, &buf[0] - GUARD, end + GUARD) == bad[0]);
+    for(i = 0; i < nbad; i++){
+        first = bad[i]*MEM_IDX_BLOCK_SIZE;
+        last = (i + 1u < nbad) ? (bad[i + 1u]*MEM_IDX_BLOCK_SIZE - 1u) : (len - 1u);
+        j = (bad[i] == nblocks - 1u) ? (len - first) : MEM_IDX_BLOCK_SIZE;   /* Its length     */
+        CHECK(MemIdxCheck(&ref, &buf[first + rnd() % j], &buf[last]) == bad[i]);
+        if(bad[i] > 0u){
+            CHECK(MemIdxCheck(&ref, &buf[0], &buf[first - 1u]) == ((i > 0u) ? bad[0] : MEM_IDX_NONE));
+        }else{
+        }
+    }
+    CHECK(MemIdxCheck(&ref, end + 1, end + GUARD) == MEM_IDX_NONE);
+
+    /* Restore and update one block at a time */
+    for(i = 0; i < nbad; i++){
+        first = bad[i]*MEM_IDX_BLOCK_SIZE;
+        last = (bad[i] == nblocks - 1u) ? (len - 1u) : (first + MEM_IDX_BLOCK_SIZE - 1u);
+        memcpy(&buf[first], &saved[first], last - first + 1u);
+        MemIdxUpdate(&cur, bad[i]);
+        MemIdxBuild(&full, &buf[0], end);
+        CHECK(memcmp(cur.node, full.node, 2u*cur.nleaves*sizeof(MEM_CRC_SW)) == 0);
+        CHECK(MemIdxFind(&ref, &cur, 0) == ((i + 1u < nbad) ? bad[i + 1u] : MEM_IDX_NONE));
+    }
+    CHECK(MemIdxRoot(&cur) == MemIdxRoot(&ref));
+    MemIdxUpdate(&cur, nblocks);
+    CHECK(MemIdxRoot(&cur) == MemIdxRoot(&ref));
+}
+
+int main(void){
+    static const INT32U lenTbl[] = {1u, 100u, MEM_IDX_BLOCK_SIZE, MEM_IDX_BLOCK_SIZE + 1u,
+                                    2u*MEM_IDX_BLOCK_SIZE, 3u*MEM_IDX_BLOCK_SIZE - 7u,
+                                    5u*MEM_IDX_BLOCK_SIZE, 100u*MEM_IDX_BLOCK_SIZE + 33u,
+                                    BUF_SIZE - 1u, BUF_SIZE};
+    INT32U i;
+    for(i = 0; i < BUF_SIZE; i++){
+        buf[i] = (INT8U)(rnd() >> 8);
+    }
+    for(i = 0; i < sizeof(lenTbl)/sizeof(lenTbl[0]); i++){
+        testRange(lenTbl[i]);
+    }
+    printf("%s (%d failures)\n", (failCnt != 0) ? "FAILED" : "ok", failCnt);
+    return failCnt != 0;
+}
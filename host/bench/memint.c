@@ -0,0 +1,112 @@
+/*****************************************************************************************
+* memint - MemIntegrity chunked sum against one-shot MemChkSum()
+* ctl, above the MemIntegrity task, runs the service over blocks shorter than a chunk,
+* on either side of a chunk boundary and many chunks long, at odd start alignments.
+* Pending on MemIntegrityPend(), every progress it sees must be above the last and
+* below 100 until the end, and the final checksum must equal MemChkSum() of the whole
+* block. The service runs with the application's app_cfg.h. Time is virtual: the idle
+* hook runs OSTimeTick() as the tick ISR would.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "os.h"
+#include "app_cfg.h"
+#include "MemoryTools.h"
+#include "MemIntegrity.h"
+
+#define TICKS_MAX       200000u
+#define STK_SIZE        512u
+#define CHUNK           APP_CFG_MEMINT_CHUNK_SIZE
+#define BLOCK_MAX       (2u*1024u*1024u)
+
+#define CHECK(c)    do{ if(!(c)){ printf("FAIL line %d: %s\n", __LINE__, #c); failCnt++; } }while(0)
+
+static const struct{
+    INT32U offset;
+    INT32U size;
+}blockTbl[] = {
+    {0u, 1u},
+    {3u, 100u},
+    {1u, CHUNK - 1u},
+    {0u, CHUNK},
+    {5u, CHUNK + 1u},
+    {7u, 3u*CHUNK + 17u},
+    {2u, 100u*CHUNK + 3u},
+    {6u, BLOCK_MAX - 8u},
+};
+
+static OS_TCB ctlTCB;
+static CPU_STK ctlStk[STK_SIZE];
+static INT8U buf[BLOCK_MAX];
+static int failCnt;
+
+static void simIdle(void){
+    OSIntEnter();
+    OSTimeTick();
+    OSIntExit();
+    if(OSTickCtr > TICKS_MAX){
+        printf("FAIL: no progress after %u ticks\n", TICKS_MAX);
+        exit(1);
+    }else{
+    }
+}
+
+static void ctlTask(void *p_arg){
+    OS_ERR os_err;
+    INT8U *start;
+    INT8U *end;
+    INT16U checksum;
+    INT8U progress;
+    INT8U last;
+    int updates;
+    unsigned b;
+    (void)p_arg;
+
+    for(b = 0; b < sizeof(blockTbl)/sizeof(blockTbl[0]); b++){
+        start = &buf[blockTbl[b].offset];
+        end = start + blockTbl[b].size - 1u;
+        MemIntegrityInit(start, end);
+        CHECK(MemIntegrityResultGet(&checksum) == FALSE);
+        last = 0;
+        updates = 0;
+        do{
+            progress = MemIntegrityPend(0, &os_err);
+            CHECK(os_err == OS_ERR_NONE);
+            if((progress <= last) || ((progress == 100) != (MemIntegrityResultGet(&checksum) == TRUE))){
+                printf("FAIL size %u: progress %u after %u\n", blockTbl[b].size, progress, last);
+                failCnt++;
+            }else{
+            }
+            last = progress;
+            updates++;
+        }while((progress < 100) && (os_err == OS_ERR_NONE));
+        CHECK(MemIntegrityResultGet(&checksum) == TRUE);
+        if(checksum != MemChkSum(start, end)){
+            printf("FAIL size %u: MemIntegrity %04X MemChkSum %04X\n", blockTbl[b].size,
+                   checksum, MemChkSum(start, end));
+            failCnt++;
+        }else{
+        }
+        printf("size %7u: %3d progress updates, checksum %04X\n", blockTbl[b].size, updates, checksum);
+    }
+    printf("%s (%d failures)\n", (failCnt != 0) ? "FAILED" : "ok", failCnt);
+    exit(failCnt != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    unsigned seed = 1u;
+    INT32U i;
+    for(i = 0; i < BLOCK_MAX; i++){
+        seed = seed*1103515245u + 12345u;
+        buf[i] = (INT8U)(seed >> 16);
+    }
+    HostIdleHookPtr = simIdle;
+    OSInit(&os_err);
+    OSTaskCreate(&ctlTCB, "ctl", ctlTask, (void *)0, 20u, &ctlStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
@@ -0,0 +1,153 @@
+/*****************************************************************************************
+* memsweep - MemoryTools and MemCRCSw cost over sizes and alignments
+* Times each backend on buffers of 16 B to 2 MB, at start alignments 0..7, with the
+* buffer flushed from the cache before each call (cold) and after a warm up call (warm).
+* Prints CSV, one line per point: backend,size,align,cache,cycles_per_byte. The timer
+* overhead is subtracted and the fastest of the repeats is kept.
+* Backends:
+*   bytesum    the byte at a time sum MemChkSum used before the word kernel
+*   MemChkSum  the word kernel, SWAR here, USADA8 on target
+*   crcbyte    MemCRCSwGetByte, one table lookup per byte
+*   crcslice4  MemCRCSwGetSlice4
+*   crcslice8  MemCRCSwGet
+* MemCRCGet is not timed: the host CRC0 model is bit serial. On target, build the same
+* loop with SWEEP_TS() as CPU_TS_TmrRd() (CPU_CFG_TS_32_EN, DWT cycle counter) and
+* without the cache flush.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+#include "MemoryTools.h"
+#include "MemCRCSw.h"
+
+#define SWEEP_SIZE_MAX  (2u*1024u*1024u)
+#define ALIGN_MAX       8u
+#define WARM_BYTES      (1024u*1024u)       /* Warm repeats cover at least this much    */
+#define REPS_MIN        3u
+#define LINE_BYTES      64u
+
+#define SWEEP_TS()      __rdtsc()
+
+typedef INT32U (*SWEEP_FUNC)(INT8U *startaddr, INT8U *endaddr);
+
+static INT8U *buf;
+static volatile INT32U sink;
+static unsigned long long tsOverhead;
+
+/* MemChkSum before the word kernel */
+static INT32U byteSum(INT8U *startaddr, INT8U *endaddr){
+    INT16U sum = 0;
+    while(startaddr<endaddr){
+        sum = sum + *startaddr;
+        startaddr++;
+    }
+    sum = sum + *endaddr;
+    return sum;
+}
+
+static INT32U chkSum(INT8U *startaddr, INT8U *endaddr){
+    return MemChkSum(startaddr, endaddr);
+}
+
+static INT32U crcByte(INT8U *startaddr, INT8U *endaddr){
+    return MemCRCSwGetByte(startaddr, endaddr);
+}
+
+static INT32U crcSlice4(INT8U *startaddr, INT8U *endaddr){
+    return MemCRCSwGetSlice4(startaddr, endaddr);
+}
+
+static INT32U crcSlice8(INT8U *startaddr, INT8U *endaddr){
+    return MemCRCSwGet(startaddr, endaddr);
+}
+
+static const struct{
+    const char *name;
+    SWEEP_FUNC func;
+}backendTbl[] = {
+    {"bytesum", byteSum},
+    {"MemChkSum", chkSum},
+    {"crcbyte", crcByte},
+    {"crcslice4", crcSlice4},
+    {"crcslice8", crcSlice8},
+};
+
+static void flush(INT8U *p, INT32U size){
+    INT32U i;
+    for(i = 0; i < size + LINE_BYTES; i += LINE_BYTES){
+        _mm_clflush(p + i);
+    }
+    _mm_mfence();
+}
+
+/* Fastest call of reps, in cycles, flushing the range first when cold */
+static unsigned long long timeCall(SWEEP_FUNC func, INT8U *p, INT32U size, int cold, unsigned reps){
+    unsigned long long best = ~0ull;
+    unsigned long long t0;
+    unsigned long long t;
+    unsigned i;
+    if(!cold){
+        sink = func(p, p + size - 1u);
+    }else{
+    }
+    for(i = 0; i < reps; i++){
+        if(cold){
+            flush(p, size);
+        }else{
+        }
+        t0 = SWEEP_TS();
+        sink = func(p, p + size - 1u);
+        t = SWEEP_TS() - t0;
+        if(t < best){
+            best = t;
+        }else{
+        }
+    }
+    return (best > tsOverhead) ? (best - tsOverhead) : 0u;
+}
+
+int main(void){
+    static const INT32U sizeTbl[] = {16u, 64u, 256u, 1024u, 4096u, 16384u, 65536u, 262144u,
+                                     1048576u, SWEEP_SIZE_MAX};
+    unsigned long long t0;
+    unsigned long long t;
+    unsigned seed = 1u;
+    unsigned reps;
+    INT32U size;
+    INT32U align;
+    INT32U i;
+    unsigned b;
+    unsigned s;
+    int cold;
+
+    buf = aligned_alloc(LINE_BYTES, SWEEP_SIZE_MAX + 2u*LINE_BYTES);
+    for(i = 0; i < SWEEP_SIZE_MAX + 2u*LINE_BYTES; i++){
+        seed = seed*1103515245u + 12345u;
+        buf[i] = (INT8U)(seed >> 16);
+    }
+    tsOverhead = ~0ull;
+    for(i = 0; i < 1000u; i++){
+        t0 = SWEEP_TS();
+        t = SWEEP_TS() - t0;
+        tsOverhead = (t < tsOverhead) ? t : tsOverhead;
+    }
+
+    printf("backend,size,align,cache,cycles_per_byte\n");
+    for(b = 0; b < sizeof(backendTbl)/sizeof(backendTbl[0]); b++){
+        for(s = 0; s < sizeof(sizeTbl)/sizeof(sizeTbl[0]); s++){
+            size = sizeTbl[s];
+            for(align = 0; align < ALIGN_MAX; align++){
+                for(cold = 1; cold >= 0; cold--){
+                    reps = (cold || (size >= WARM_BYTES/REPS_MIN)) ? REPS_MIN : WARM_BYTES/size;
+                    t = timeCall(backendTbl[b].func, &buf[align], size, cold, reps);
+                    printf("%s,%u,%u,%s,%.3f\n", backendTbl[b].name, size, align,
+                           cold ? "cold" : "warm", (double)t/size);
+                }
+            }
+        }
+    }
+    free(buf);
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*****************************************************************************************
+* mtxbench - Uncontended OS_MUTEX cost
+* One task takes and releases a free mutex in a loop. Prints TSC cycles and critical
+* sections per OSMutexPend()+OSMutexPost(). With OS_CFG_MUTEX_FAST_EN the mutex never
+* enters the owner's mutex group.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+#include "os.h"
+
+#define LOOPS       2000000u
+#define STK_SIZE    256u
+
+static OS_TCB mainTCB;
+static CPU_STK mainStk[STK_SIZE];
+static OS_MUTEX mutex;
+
+static void mainTask(void *p_arg){
+    OS_ERR os_err;
+    unsigned long errs = 0;
+    unsigned long cs0;
+    unsigned long long t0;
+    unsigned long long cycles;
+    unsigned pass;
+    unsigned i;
+    (void)p_arg;
+    OSMutexCreate(&mutex, "mutex", &os_err);
+    for(pass = 0; pass < 3; pass++){
+        cs0 = HostCritSectCtr;
+        t0 = __rdtsc();
+        for(i = 0; i < LOOPS; i++){
+            OSMutexPend(&mutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            errs += (os_err != OS_ERR_NONE);
+            OSMutexPost(&mutex, OS_OPT_POST_NONE, &os_err);
+            errs += (os_err != OS_ERR_NONE);
+        }
+        cycles = __rdtsc() - t0;
+        printf("mutex pend+post  cycles %6.1f  critical sections %4.2f\n",
+               (double)cycles/LOOPS, (double)(HostCritSectCtr - cs0)/LOOPS);
+    }
+    if((mutex.OwnerTCBPtr != (OS_TCB *)0) || (mainTCB.MutexGrpHeadPtr != (OS_MUTEX *)0)){
+        errs++;
+    }else{
+    }
+    printf("errors %lu\n", errs);
+    exit(errs != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    OSInit(&os_err);
+    OSTaskCreate(&mainTCB, "main", mainTask, (void *)0, 10u, &mainStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
@@ -0,0 +1,96 @@
+/*****************************************************************************************
+* mtxpi - OS_MUTEX fast path and priority inheritance
+* lo takes mtx on the fast path, then resumes hi, which blocks on it. lo must be raised
+* to hi's priority and mtx linked into lo's group. Releasing mtx hands it to hi and
+* restores lo's priority. hi then checks nesting and the error codes on the fast path.
+* Without OS_CFG_MUTEX_FAST_EN only the inheritance checks apply.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "os.h"
+
+#define STK_SIZE    256u
+#define HI_PRIO     10u
+#define LO_PRIO     20u
+
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+#define FAST(c)     (c)
+#else
+#define FAST(c)     DEF_TRUE
+#endif
+
+#define CHECK(c)    do{ if(!(c)){ printf("FAIL line %d: %s\n", __LINE__, #c); failCnt++; } }while(0)
+
+static OS_TCB hiTCB;
+static OS_TCB loTCB;
+static CPU_STK hiStk[STK_SIZE];
+static CPU_STK loStk[STK_SIZE];
+static OS_MUTEX mtx;
+static OS_MUTEX mtx2;
+static int failCnt;
+
+static void hiTask(void *p_arg){
+    OS_ERR os_err;
+    (void)p_arg;
+    for(;;){
+        OSTaskSuspend((OS_TCB *)0, &os_err);
+        CHECK(FAST(mtx.GrpLinked == DEF_FALSE) && (mtx.OwnerTCBPtr == &loTCB));
+        OSMutexPend(&mtx, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        CHECK(os_err == OS_ERR_NONE);
+        CHECK((mtx.OwnerTCBPtr == &hiTCB) && (loTCB.Prio == LO_PRIO) && FAST(mtx.GrpLinked == DEF_TRUE));
+        OSMutexPost(&mtx, OS_OPT_POST_NONE, &os_err);
+        CHECK((os_err == OS_ERR_NONE) && (mtx.OwnerTCBPtr == (OS_TCB *)0) && FAST(mtx.GrpLinked == DEF_FALSE));
+        CHECK(hiTCB.MutexGrpHeadPtr == (OS_MUTEX *)0);
+        /* Fast path again, with nesting */
+        OSMutexPend(&mtx, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        CHECK((os_err == OS_ERR_NONE) && FAST(mtx.GrpLinked == DEF_FALSE));
+        OSMutexPend(&mtx, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        CHECK((os_err == OS_ERR_MUTEX_OWNER) && (mtx.OwnerNestingCtr == 2u));
+        OSMutexPost(&mtx, OS_OPT_POST_NONE, &os_err);
+        CHECK(os_err == OS_ERR_MUTEX_NESTING);
+        OSMutexPost(&mtx, OS_OPT_POST_NONE, &os_err);
+        CHECK((os_err == OS_ERR_NONE) && (mtx.OwnerTCBPtr == (OS_TCB *)0));
+    }
+}
+
+static void loTask(void *p_arg){
+    OS_ERR os_err;
+    int i;
+    (void)p_arg;
+    for(i = 0; i < 3; i++){
+        OSMutexPend(&mtx2, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        CHECK(os_err == OS_ERR_NONE);
+        OSMutexPend(&mtx, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        CHECK((os_err == OS_ERR_NONE) && (mtx.OwnerTCBPtr == &loTCB));
+        CHECK(FAST(loTCB.MutexGrpHeadPtr == (OS_MUTEX *)0));
+        /* hi preempts, blocks on mtx and raises lo */
+        OSTaskResume(&hiTCB, &os_err);
+        CHECK((loTCB.Prio == HI_PRIO) && FAST(mtx.GrpLinked == DEF_TRUE) && FAST(loTCB.MutexGrpHeadPtr == &mtx));
+        /* Still raised by mtx */
+        OSMutexPost(&mtx2, OS_OPT_POST_NONE, &os_err);
+        CHECK((os_err == OS_ERR_NONE) && (loTCB.Prio == HI_PRIO));
+        /* Hand off to hi, which runs before lo returns */
+        OSMutexPost(&mtx, OS_OPT_POST_NONE, &os_err);
+        CHECK(os_err == OS_ERR_NONE);
+        CHECK((loTCB.Prio == LO_PRIO) && (loTCB.MutexGrpHeadPtr == (OS_MUTEX *)0) && (mtx.OwnerTCBPtr == (OS_TCB *)0));
+        OSMutexPost(&mtx, OS_OPT_POST_NONE, &os_err);
+        CHECK(os_err == OS_ERR_MUTEX_NOT_OWNER);
+    }
+    printf("%s (%d failures)\n", (failCnt != 0) ? "FAILED" : "ok", failCnt);
+    exit(failCnt != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    OSInit(&os_err);
+    OSMutexCreate(&mtx, "mtx", &os_err);
+    OSMutexCreate(&mtx2, "mtx2", &os_err);
+    OSTaskCreate(&hiTCB, "hi", hiTask, (void *)0, HI_PRIO, &hiStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&loTCB, "lo", loTask, (void *)0, LO_PRIO, &loStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
@@ -0,0 +1,101 @@
+/*****************************************************************************************
+* pcpbench - Uncontended OS_MUTEX_PCP cost against OS_MUTEX
+* One task takes and releases a free mutex of each kind in a loop, while already holding
+* 0, 1, 4 or 16 other mutexes of both kinds. Prints TSC cycles and critical sections per
+* pend+post.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+#include "os.h"
+
+#define LOOPS       2000000u
+#define HELD_MAX    16
+#define STK_SIZE    512u
+
+static OS_TCB mainTCB;
+static CPU_STK mainStk[STK_SIZE];
+static OS_MUTEX mtx;
+static OS_MUTEX heldMtx[HELD_MAX];
+static OS_MUTEX_PCP pcp;
+static OS_MUTEX_PCP heldPcp[HELD_MAX];
+static unsigned long errs;
+
+static void timeMutex(int held){
+    OS_ERR os_err;
+    unsigned long cs0 = HostCritSectCtr;
+    unsigned long long t0 = __rdtsc();
+    unsigned i;
+    for(i = 0; i < LOOPS; i++){
+        OSMutexPend(&mtx, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        errs += (os_err != OS_ERR_NONE);
+        OSMutexPost(&mtx, OS_OPT_POST_NONE, &os_err);
+        errs += (os_err != OS_ERR_NONE);
+    }
+    printf("held %2d  OS_MUTEX     pend+post  cycles %6.1f  critical sections %4.2f\n", held,
+           (double)(__rdtsc() - t0)/LOOPS, (double)(HostCritSectCtr - cs0)/LOOPS);
+}
+
+static void timePcp(int held){
+    OS_ERR os_err;
+    unsigned long cs0 = HostCritSectCtr;
+    unsigned long long t0 = __rdtsc();
+    unsigned i;
+    for(i = 0; i < LOOPS; i++){
+        OSMutexPcpPend(&pcp, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        errs += (os_err != OS_ERR_NONE);
+        OSMutexPcpPost(&pcp, OS_OPT_POST_NONE, &os_err);
+        errs += (os_err != OS_ERR_NONE);
+    }
+    printf("held %2d  OS_MUTEX_PCP pend+post  cycles %6.1f  critical sections %4.2f\n", held,
+           (double)(__rdtsc() - t0)/LOOPS, (double)(HostCritSectCtr - cs0)/LOOPS);
+}
+
+static void mainTask(void *p_arg){
+    static const int heldTbl[] = {0, 1, 4, HELD_MAX};
+    OS_ERR os_err;
+    unsigned t;
+    int held;
+    int pass;
+    int i;
+    (void)p_arg;
+    OSMutexCreate(&mtx, "mtx", &os_err);
+    OSMutexPcpCreate(&pcp, "pcp", 10u, &os_err);
+    for(i = 0; i < HELD_MAX; i++){
+        OSMutexCreate(&heldMtx[i], "held mtx", &os_err);
+        OSMutexPcpCreate(&heldPcp[i], "held pcp", 12u, &os_err);
+    }
+    for(t = 0; t < sizeof(heldTbl)/sizeof(heldTbl[0]); t++){
+        held = heldTbl[t];
+        for(i = 0; i < held; i++){
+            OSMutexPend(&heldMtx[i], 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            OSMutexPcpPend(&heldPcp[i], 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        }
+        for(pass = 0; pass < 2; pass++){
+            timeMutex(held);
+            timePcp(held);
+        }
+        for(i = held - 1; i >= 0; i--){
+            OSMutexPcpPost(&heldPcp[i], OS_OPT_POST_NONE, &os_err);
+            errs += (os_err != OS_ERR_NONE);
+            OSMutexPost(&heldMtx[i], OS_OPT_POST_NONE, &os_err);
+        }
+    }
+    if(mainTCB.Prio != 20u){
+        errs++;
+    }else{
+    }
+    printf("errors %lu\n", errs);
+    exit(errs != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    OSInit(&os_err);
+    OSTaskCreate(&mainTCB, "main", mainTask, (void *)0, 20u, &mainStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
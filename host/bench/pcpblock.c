@@ -0,0 +1,155 @@
+/*****************************************************************************************
+* pcpblock - Worst case blocking under OS_MUTEX and OS_MUTEX_PCP
+* L takes A for 3 ticks. M is released 1 tick later and takes B for 3 ticks. H is
+* released at tick 2, runs half a tick and then needs A and then B for half a tick.
+* Under OS_MUTEX, H waits for both critical sections in turn. Under OS_MUTEX_PCP, with
+* both ceilings at H's priority, M cannot start B while L holds A, so H waits for L only.
+* Time is virtual: the tasks advance it with burn(), the idle hook skips to the next tick
+* and every tick runs OSTimeTick() as the tick ISR would.
+* Run "pcpblock" for OS_MUTEX and "pcpblock 1" for OS_MUTEX_PCP.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "os.h"
+
+#define TICK_CYCLES     1000ull
+#define TICKS_MAX       50u
+#define STK_SIZE        256u
+#define H_PRIO          10u
+#define M_PRIO          15u
+#define L_PRIO          20u
+
+typedef struct{
+    OS_TCB tcb;
+    CPU_STK stk[STK_SIZE];
+    OS_TICK release;
+    unsigned long long done;
+}SIM_TASK;
+
+static unsigned long long simNow;
+static unsigned long long simNextTick = TICK_CYCLES;
+static CPU_BOOLEAN usePcp;
+static OS_MUTEX mtxA;
+static OS_MUTEX mtxB;
+static OS_MUTEX_PCP pcpA;
+static OS_MUTEX_PCP pcpB;
+static SIM_TASK taskH = {.release = 2u};
+static SIM_TASK taskM = {.release = 1u};
+static SIM_TASK taskL = {.release = 0u};
+
+static void simTick(void){
+    simNextTick += TICK_CYCLES;
+    OSIntEnter();
+    OSTimeTick();
+    OSIntExit();
+}
+
+static void simIdle(void){
+    double tick_ms = 1000.0/OS_CFG_TICK_RATE_HZ;
+    simNow = simNextTick;
+    simTick();
+    if(OSTickCtr > TICKS_MAX){
+        printf("%s: H response %.1f ms, blocked %.1f ms; M response %.1f ms; L response %.1f ms\n",
+               usePcp ? "OS_MUTEX_PCP" : "OS_MUTEX    ",
+               tick_ms*((double)taskH.done/TICK_CYCLES - taskH.release),
+               tick_ms*((double)taskH.done/TICK_CYCLES - taskH.release - 1.0),
+               tick_ms*((double)taskM.done/TICK_CYCLES - taskM.release),
+               tick_ms*((double)taskL.done/TICK_CYCLES - taskL.release));
+        exit(0);
+    }else{
+    }
+}
+
+/* Runs for n cycles of virtual time, taking the tick interrupts that fall inside */
+static void burn(unsigned long long n){
+    unsigned long long step;
+    while(n != 0u){
+        step = simNextTick - simNow;
+        if(step > n){
+            step = n;
+        }else{
+        }
+        simNow += step;
+        n -= step;
+        if(simNow == simNextTick){
+            simTick();
+        }else{
+        }
+    }
+}
+
+static void lock(CPU_BOOLEAN b){
+    OS_ERR os_err;
+    if(usePcp){
+        OSMutexPcpPend(b ? &pcpB : &pcpA, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    }else{
+        OSMutexPend(b ? &mtxB : &mtxA, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    }
+}
+
+static void unlock(CPU_BOOLEAN b){
+    OS_ERR os_err;
+    if(usePcp){
+        OSMutexPcpPost(b ? &pcpB : &pcpA, OS_OPT_POST_NONE, &os_err);
+    }else{
+        OSMutexPost(b ? &mtxB : &mtxA, OS_OPT_POST_NONE, &os_err);
+    }
+}
+
+static void lTask(void *p_arg){
+    OS_ERR os_err;
+    (void)p_arg;
+    lock(DEF_FALSE);
+    burn(3u*TICK_CYCLES);
+    unlock(DEF_FALSE);
+    burn(TICK_CYCLES);
+    taskL.done = simNow;
+    OSTaskSuspend((OS_TCB *)0, &os_err);
+}
+
+static void mTask(void *p_arg){
+    OS_ERR os_err;
+    (void)p_arg;
+    OSTimeDly(taskM.release, OS_OPT_TIME_MATCH, &os_err);
+    lock(DEF_TRUE);
+    burn(3u*TICK_CYCLES);
+    unlock(DEF_TRUE);
+    burn(TICK_CYCLES);
+    taskM.done = simNow;
+    OSTaskSuspend((OS_TCB *)0, &os_err);
+}
+
+static void hTask(void *p_arg){
+    OS_ERR os_err;
+    (void)p_arg;
+    OSTimeDly(taskH.release, OS_OPT_TIME_MATCH, &os_err);
+    burn(TICK_CYCLES/2u);
+    lock(DEF_FALSE);
+    lock(DEF_TRUE);
+    burn(TICK_CYCLES/2u);
+    unlock(DEF_TRUE);
+    unlock(DEF_FALSE);
+    taskH.done = simNow;
+    OSTaskSuspend((OS_TCB *)0, &os_err);
+}
+
+int main(int argc, char **argv){
+    OS_ERR os_err;
+    usePcp = (argc > 1) && (atoi(argv[1]) != 0);
+    HostIdleHookPtr = simIdle;
+    OSInit(&os_err);
+    OSMutexCreate(&mtxA, "A", &os_err);
+    OSMutexCreate(&mtxB, "B", &os_err);
+    OSMutexPcpCreate(&pcpA, "A", H_PRIO, &os_err);
+    OSMutexPcpCreate(&pcpB, "B", H_PRIO, &os_err);
+    OSTaskCreate(&taskH.tcb, "H", hTask, (void *)0, H_PRIO, &taskH.stk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&taskM.tcb, "M", mTask, (void *)0, M_PRIO, &taskM.stk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&taskL.tcb, "L", lTask, (void *)0, L_PRIO, &taskL.stk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
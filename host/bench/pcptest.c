@@ -0,0 +1,217 @@
+/*****************************************************************************************
+* pcptest - OS_MUTEX_PCP state test
+* ctl, the lowest priority task, steps lo, mid and hi through the cases below and checks
+* priorities, owners and error codes along the way:
+*   1 the ceiling is raised at once, so mid cannot preempt the owner
+*   2 nesting and LIFO release order
+*   3 a caller above the ceiling is refused
+*   4 a waiter is handed the mutex at the ceiling
+*   5 OS_MUTEX inheritance and a ceiling held together
+*   6 a base priority change while holding keeps the ceiling
+*   7 an owner deleted while a task waits
+*   8 delete of a held mutex
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "os.h"
+
+#define STK_SIZE        512u
+
+#define CHECK(c)        do{ if(!(c)){ printf("FAIL step %d line %d: %s\n", step, __LINE__, #c); failCnt++; } }while(0)
+#define SELF_SUSPEND()  OSTaskSuspend((OS_TCB *)0, &os_err)
+
+static OS_TCB loTCB;
+static OS_TCB midTCB;
+static OS_TCB hiTCB;
+static OS_TCB ctlTCB;
+static CPU_STK loStk[STK_SIZE];
+static CPU_STK midStk[STK_SIZE];
+static CPU_STK hiStk[STK_SIZE];
+static CPU_STK ctlStk[STK_SIZE];
+
+static OS_MUTEX_PCP p10;
+static OS_MUTEX_PCP p12;
+static OS_MUTEX_PCP pdel;
+static OS_MUTEX m;
+
+static int failCnt;
+static int step;
+static int midRan;
+
+static void midTask(void *p_arg){
+    OS_ERR os_err;
+    (void)p_arg;
+    for(;;){
+        SELF_SUSPEND();
+        midRan++;
+        if(step == 4){
+            OSMutexPcpPend(&p10, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK(os_err == OS_ERR_NONE);
+            CHECK((midTCB.Prio == 10u) && (midTCB.BasePrio == 15u) && (p10.OwnerTCBPtr == &midTCB) && (loTCB.Prio == 20u));
+            OSMutexPcpPost(&p10, OS_OPT_POST_NONE, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (midTCB.Prio == 15u));
+        }else if(step == 7){
+            OSMutexPcpPend(&pdel, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (midTCB.Prio == 12u));
+        }else{
+        }
+    }
+}
+
+static void hiTask(void *p_arg){
+    OS_ERR os_err;
+    (void)p_arg;
+    for(;;){
+        SELF_SUSPEND();
+        if(step == 3){
+            OSMutexPcpPend(&p12, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK(os_err == OS_ERR_MUTEX_CEILING);
+        }else if(step == 5){
+            OSMutexPend(&m, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (loTCB.Prio == 12u));
+            OSMutexPost(&m, OS_OPT_POST_NONE, &os_err);
+        }else{
+        }
+    }
+}
+
+static void loTask(void *p_arg){
+    OS_ERR os_err;
+    (void)p_arg;
+    for(;;){
+        SELF_SUSPEND();
+        switch(step){
+        case 1:
+            OSMutexPcpPend(&p10, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (loTCB.Prio == 10u) && (OSPrioCur == 10u));
+            OSTaskResume(&midTCB, &os_err);
+            CHECK(midRan == 0);
+            OSMutexPcpPost(&p10, OS_OPT_POST_NONE, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (midRan == 1) && (loTCB.Prio == 20u));
+            break;
+        case 2:
+            OSMutexPcpPend(&p12, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK((loTCB.Prio == 12u) && (loTCB.CeilingPrio == 12u));
+            OSMutexPcpPend(&p10, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK((loTCB.Prio == 10u) && (loTCB.MutexPcpHeadPtr == &p10));
+            OSMutexPcpPend(&p10, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK(os_err == OS_ERR_MUTEX_OWNER);
+            OSMutexPcpPost(&p12, OS_OPT_POST_NONE, &os_err);
+            CHECK((os_err == OS_ERR_MUTEX_ORDER) && (p12.OwnerTCBPtr == &loTCB));
+            OSMutexPcpPost(&p10, OS_OPT_POST_NONE, &os_err);
+            CHECK((os_err == OS_ERR_MUTEX_NESTING) && (loTCB.Prio == 10u));
+            OSMutexPcpPost(&p10, OS_OPT_POST_NONE, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (loTCB.Prio == 12u));
+            OSMutexPcpPost(&p12, OS_OPT_POST_NONE, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (loTCB.Prio == 20u) && (loTCB.CeilingPrio == OS_CFG_PRIO_MAX - 1u));
+            OSMutexPcpPost(&p12, OS_OPT_POST_NONE, &os_err);
+            CHECK(os_err == OS_ERR_MUTEX_NOT_OWNER);
+            break;
+        case 4:
+            /* Hold p10 across a suspension, mid waits for it */
+            OSMutexPcpPend(&p10, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK(os_err == OS_ERR_NONE);
+            SELF_SUSPEND();
+            OSMutexPcpPost(&p10, OS_OPT_POST_NONE, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (midRan == 2) && (loTCB.Prio == 20u));
+            break;
+        case 5:
+            OSMutexPcpPend(&p12, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            OSMutexPend(&m, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            SELF_SUSPEND();
+            CHECK(loTCB.Prio == 10u);
+            OSMutexPost(&m, OS_OPT_POST_NONE, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (loTCB.Prio == 12u));
+            OSMutexPcpPost(&p12, OS_OPT_POST_NONE, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (loTCB.Prio == 20u));
+            break;
+        case 6:
+            OSMutexPcpPend(&p12, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            OSTaskChangePrio((OS_TCB *)0, 25u, &os_err);
+            CHECK((loTCB.Prio == 12u) && (loTCB.BasePrio == 25u));
+            OSMutexPcpPost(&p12, OS_OPT_POST_NONE, &os_err);
+            CHECK(loTCB.Prio == 25u);
+            OSTaskChangePrio((OS_TCB *)0, 20u, &os_err);
+            break;
+        case 7:
+            /* Waits on pdel, gets it at the ceiling once ctl deletes mid */
+            OSMutexPcpPend(&pdel, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (loTCB.Prio == 12u));
+            OSMutexPcpPost(&pdel, OS_OPT_POST_NONE, &os_err);
+            CHECK(loTCB.Prio == 20u);
+            break;
+        case 8:
+            OSMutexPcpPend(&p12, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            OSMutexPcpPend(&p10, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            CHECK((OSMutexPcpDel(&p12, OS_OPT_DEL_ALWAYS, &os_err) == 0u) && (os_err == OS_ERR_MUTEX_ORDER));
+            OSMutexPcpDel(&p10, OS_OPT_DEL_NO_PEND, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (loTCB.Prio == 12u) && (loTCB.MutexPcpHeadPtr == &p12));
+            OSMutexPcpPost(&p12, OS_OPT_POST_NONE, &os_err);
+            CHECK((os_err == OS_ERR_NONE) && (loTCB.Prio == 20u));
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static void ctlTask(void *p_arg){
+    OS_ERR os_err;
+    (void)p_arg;
+    step = 1;
+    OSTaskResume(&loTCB, &os_err);
+    step = 2;
+    OSTaskResume(&loTCB, &os_err);
+    step = 3;
+    OSTaskResume(&hiTCB, &os_err);
+    step = 4;
+    OSTaskResume(&loTCB, &os_err);
+    CHECK((p10.OwnerTCBPtr == &loTCB) && (loTCB.Prio == 10u));
+    OSTaskResume(&midTCB, &os_err);
+    CHECK((midTCB.TaskState == OS_TASK_STATE_PEND) && (midTCB.PendOn == OS_TASK_PEND_ON_MUTEX_PCP));
+    OSTaskResume(&loTCB, &os_err);
+    CHECK(p10.OwnerTCBPtr == (OS_TCB *)0);
+    step = 5;
+    OSTaskResume(&loTCB, &os_err);
+    CHECK(loTCB.Prio == 12u);
+    OSTaskResume(&hiTCB, &os_err);
+    CHECK((loTCB.Prio == 10u) && (hiTCB.TaskState == OS_TASK_STATE_PEND));
+    OSTaskResume(&loTCB, &os_err);
+    step = 6;
+    OSTaskResume(&loTCB, &os_err);
+    CHECK(loTCB.Prio == 20u);
+    step = 7;
+    OSTaskResume(&midTCB, &os_err);
+    CHECK((pdel.OwnerTCBPtr == &midTCB) && (midTCB.Prio == 12u));
+    OSTaskResume(&loTCB, &os_err);
+    CHECK(loTCB.TaskState == OS_TASK_STATE_PEND);
+    OSTaskDel(&midTCB, &os_err);
+    CHECK((os_err == OS_ERR_NONE) && (pdel.OwnerTCBPtr == (OS_TCB *)0) && (loTCB.Prio == 20u));
+    step = 8;
+    OSTaskResume(&loTCB, &os_err);
+    printf("%s (%d failures)\n", (failCnt != 0) ? "FAILED" : "ok", failCnt);
+    exit(failCnt != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    OSInit(&os_err);
+    OSMutexPcpCreate(&p10, "p10", 10u, &os_err);
+    OSMutexPcpCreate(&p12, "p12", 12u, &os_err);
+    OSMutexPcpCreate(&pdel, "pdel", 12u, &os_err);
+    OSMutexPcpCreate(&pdel, "bad", OS_CFG_PRIO_MAX - 1u, &os_err);
+    CHECK(os_err == OS_ERR_PRIO_INVALID);
+    OSMutexCreate(&m, "m", &os_err);
+    OSTaskCreate(&hiTCB, "hi", hiTask, (void *)0, 10u, &hiStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&midTCB, "mid", midTask, (void *)0, 15u, &midStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&loTCB, "lo", loTask, (void *)0, 20u, &loStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&ctlTCB, "ctl", ctlTask, (void *)0, 30u, &ctlStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
@@ -0,0 +1,152 @@
+/*****************************************************************************************
+* ringbench - OS_RING against OS_Q with a blocked consumer
+* The main task pushes EVENTS 4-byte elements to a consumer that pends on an OS_RING or
+* an OS_Q. Consumer above the producer: every element wakes it. Consumer below: it
+* drains a burst of B and then signals the producer to continue. Prints context switches
+* and TSC cycles per element and checks that every element arrives in order.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+#include "os.h"
+
+#define EVENTS          262144u
+#define RING_CAP        64u
+#define STK_SIZE        256u
+#define MAIN_PRIO       10u
+#define HIGH_PRIO       7u
+#define LOW_PRIO        11u
+#define IDLE_PRIO_Q     12u
+#define IDLE_PRIO_RING  13u
+
+static OS_TCB mainTCB;
+static OS_TCB consTCB[2];
+static CPU_STK mainStk[STK_SIZE];
+static CPU_STK consStk[2][STK_SIZE];
+
+static OS_RING ring;
+static CPU_INT32U ringBuf[RING_CAP];
+static OS_Q q;
+
+static volatile unsigned burst;
+static unsigned long consumed;
+static unsigned long orderErrs;
+
+static void consTask(void *p_arg){
+    OS_ERR os_err;
+    OS_MSG_SIZE size;
+    CPU_INT32U val;
+    CPU_BOOLEAN isRing = (p_arg != (void *)0);
+    for(;;){
+        if(isRing){
+            OSRingPop(&ring, &val, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+        }else{
+            val = (CPU_INT32U)(long)OSQPend(&q, 0u, OS_OPT_PEND_BLOCKING, &size, (CPU_TS *)0, &os_err);
+        }
+        if(os_err != OS_ERR_NONE){
+            printf("pend error %d\n", os_err);
+            exit(1);
+        }else{
+        }
+        if(val != (CPU_INT32U)consumed + 1u){
+            orderErrs++;
+        }else{
+        }
+        consumed++;
+        if((burst != 0u) && ((consumed % burst) == 0u)){
+            (void)OSTaskSemPost(&mainTCB, OS_OPT_POST_NONE, &os_err);
+        }else{
+        }
+    }
+}
+
+static void runBench(const char *name, CPU_BOOLEAN useRing, OS_PRIO cons_prio, unsigned b){
+    OS_ERR os_err;
+    OS_TCB *p_cons = &consTCB[useRing ? 1 : 0];
+    CPU_INT32U val;
+    unsigned long sw0;
+    unsigned long long t0;
+    unsigned long long cycles;
+    unsigned long i;
+    burst = b;
+    consumed = 0;
+    OSTaskChangePrio(p_cons, cons_prio, &os_err);
+    sw0 = HostCtxSwCtr;
+    t0 = __rdtsc();
+    for(i = 0; i < EVENTS; i++){
+        val = (CPU_INT32U)i + 1u;
+        if(useRing){
+            OSRingPush(&ring, &val, OS_OPT_NONE, &os_err);
+        }else{
+            OSQPost(&q, (void *)(long)val, sizeof(val), OS_OPT_POST_FIFO, &os_err);
+        }
+        if(os_err != OS_ERR_NONE){
+            printf("post error %d\n", os_err);
+            exit(1);
+        }else{
+        }
+        if((b != 0u) && (((i + 1u) % b) == 0u)){
+            (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+        }else{
+        }
+    }
+    cycles = __rdtsc() - t0;
+    if(consumed != EVENTS){
+        printf("%s lost %lu\n", name, EVENTS - consumed);
+        exit(1);
+    }else{
+    }
+    printf("%-5s consumer %s B=%2u  ctxsw/msg %6.3f  cycles/msg %7.1f\n", name,
+           (cons_prio < MAIN_PRIO) ? "high" : "low ", b,
+           (double)(HostCtxSwCtr - sw0)/EVENTS, (double)cycles/EVENTS);
+    OSTaskChangePrio(p_cons, useRing ? IDLE_PRIO_RING : IDLE_PRIO_Q, &os_err);
+}
+
+static void mainTask(void *p_arg){
+    OS_ERR os_err;
+    unsigned pass;
+    unsigned b;
+    (void)p_arg;
+    OSRingCreate(&ring, "ring", ringBuf, RING_CAP, sizeof(CPU_INT32U), &os_err);
+    if(os_err != OS_ERR_NONE){
+        printf("OSRingCreate error %d\n", os_err);
+        exit(1);
+    }else{
+    }
+    OSQCreate(&q, "q", RING_CAP, &os_err);
+    OSTaskCreate(&consTCB[0], "q consumer", consTask, (void *)0, IDLE_PRIO_Q, &consStk[0][0],
+                 0u, STK_SIZE, 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&consTCB[1], "ring consumer", consTask, (void *)1, IDLE_PRIO_RING, &consStk[1][0],
+                 0u, STK_SIZE, 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    for(pass = 0; pass < 2; pass++){
+        runBench("q", DEF_FALSE, HIGH_PRIO, 0u);
+        runBench("ring", DEF_TRUE, HIGH_PRIO, 0u);
+        for(b = 8; b <= RING_CAP; b <<= 1){
+            runBench("q", DEF_FALSE, LOW_PRIO, b);
+            runBench("ring", DEF_TRUE, LOW_PRIO, b);
+        }
+        if(pass == 0){
+            printf("---- second pass, warm ----\n");
+        }else{
+        }
+    }
+    printf("order errors %lu\n", orderErrs);
+    exit(orderErrs != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    OSInit(&os_err);
+    if(os_err != OS_ERR_NONE){
+        printf("OSInit error %d\n", os_err);
+        return 1;
+    }else{
+    }
+    OSTaskCreate(&mainTCB, "main", mainTask, (void *)0, MAIN_PRIO, &mainStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    printf("OSStart error %d\n", os_err);
+    return 1;
+}
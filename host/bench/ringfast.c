@@ -0,0 +1,82 @@
+/*****************************************************************************************
+* ringfast - OS_RING against OS_Q without context switches
+* A single task fills an OS_RING and an OS_Q to capacity and empties them again with
+* non-blocking calls, so only the post and pend paths are timed. Prints TSC cycles and
+* critical sections per element. Build with "make HOST_UP=1" for the single core
+* barriers figure.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+#include "os.h"
+
+#define RING_CAP    64u
+#define ROUNDS      20000u
+#define STK_SIZE    256u
+#define ELEMENTS    ((double)ROUNDS*RING_CAP)
+
+static OS_TCB mainTCB;
+static CPU_STK mainStk[STK_SIZE];
+static OS_RING ring;
+static CPU_INT32U ringBuf[RING_CAP];
+static OS_Q q;
+
+static void mainTask(void *p_arg){
+    OS_ERR os_err;
+    OS_MSG_SIZE size;
+    CPU_INT32U val;
+    CPU_INT32U i;
+    unsigned long orderErrs = 0;
+    unsigned long cs0;
+    unsigned long long t0;
+    unsigned long long cycles;
+    unsigned pass;
+    unsigned r;
+    (void)p_arg;
+    OSRingCreate(&ring, "ring", ringBuf, RING_CAP, sizeof(val), &os_err);
+    OSQCreate(&q, "q", RING_CAP, &os_err);
+    for(pass = 0; pass < 2; pass++){
+        cs0 = HostCritSectCtr;
+        t0 = __rdtsc();
+        for(r = 0; r < ROUNDS; r++){
+            for(i = 0; i < RING_CAP; i++){
+                OSQPost(&q, (void *)(long)(i + 1u), sizeof(val), OS_OPT_POST_FIFO, &os_err);
+            }
+            for(i = 0; i < RING_CAP; i++){
+                val = (CPU_INT32U)(long)OSQPend(&q, 0u, OS_OPT_PEND_NON_BLOCKING, &size, (CPU_TS *)0, &os_err);
+                orderErrs += (val != i + 1u);
+            }
+        }
+        cycles = __rdtsc() - t0;
+        printf("q     post+pend  cycles/msg %6.1f  critical sections/msg %4.2f\n",
+               cycles/ELEMENTS, (HostCritSectCtr - cs0)/ELEMENTS);
+        cs0 = HostCritSectCtr;
+        t0 = __rdtsc();
+        for(r = 0; r < ROUNDS; r++){
+            for(i = 0; i < RING_CAP; i++){
+                val = i + 1u;
+                OSRingPush(&ring, &val, OS_OPT_POST_NONE, &os_err);
+            }
+            for(i = 0; i < RING_CAP; i++){
+                OSRingPop(&ring, &val, 0u, OS_OPT_PEND_NON_BLOCKING, &os_err);
+                orderErrs += (val != i + 1u);
+            }
+        }
+        cycles = __rdtsc() - t0;
+        printf("ring  push+pop   cycles/msg %6.1f  critical sections/msg %4.2f\n",
+               cycles/ELEMENTS, (HostCritSectCtr - cs0)/ELEMENTS);
+    }
+    printf("order errors %lu\n", orderErrs);
+    exit(orderErrs != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    OSInit(&os_err);
+    OSTaskCreate(&mainTCB, "main", mainTask, (void *)0, 10u, &mainStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
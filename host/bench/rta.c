@@ -0,0 +1,237 @@
+/*****************************************************************************************
+* rta - Response time analysis of the application's tasks
+* Exact fixed priority analysis: for each task, with the tasks at its own priority or
+* above as hp(i),
+*     R = C + B + sum over j in hp(i) of ceil(R/Tj)*Cj
+* iterated from R = C + B until it settles or passes the deadline. B is the priority
+* inheritance bound: a task can be blocked once per lower priority task that holds a
+* mutex also used at or above its priority, and once per such mutex, whichever is less.
+* The tick ISR is a task above every priority.
+* Priorities, periods and the LCD geometry come from app_cfg.h and os_cfg_app.h. The
+* WCETs and critical section lengths in taskTbl are declared estimates at 180 MHz.
+* Pass a file of "name wcet_us" lines, e.g. from a trace capture, to replace them.
+* For each task prints R against D. It flags a task that misses its deadline, and a task
+* that sits above one with a shorter deadline, which is more priority than its own
+* deadline asks for. Then recommends an order found with Audsley's algorithm, deadline
+* monotonic where there is a choice.
+* Exits 1 when the configured priorities are not schedulable.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "os.h"
+#include "app_cfg.h"
+
+#define TICK_US         (1000000u/OS_CFG_TICK_RATE_HZ)
+#define LCD_CHAR_US     45u             /* 41 us execution delay and the bus write       */
+#define TASKS           (int)(sizeof(taskTbl)/sizeof(taskTbl[0]))
+#define RTA_ISR_PRIO    (-1)
+
+typedef enum{RES_LCD, RES_SWCNT, RES_TIMECOUNT, RES_MEMINT, RES_NBR}RTA_RES;
+
+static const char *resName[RES_NBR] = {"lcdLayersKey", "swCntrCntrlKey", "appTimerCountKey", "memIntKey"};
+
+typedef struct{
+    const char *name;
+    int prio;
+    unsigned long period;               /* us, minimum inter-arrival for sporadic tasks  */
+    unsigned long deadline;             /* us                                            */
+    unsigned long wcet;                 /* us                                            */
+    unsigned long cs[RES_NBR];          /* Longest critical section on each mutex, us    */
+}RTA_TASK;
+
+/* appStartTask only runs at startup and the MemCRC service has no client, so neither is
+ * in the table. MemIntegrity is one 2 MB pass that should end within a second. */
+static RTA_TASK taskTbl[] = {
+    {"OS_TickISR", RTA_ISR_PRIO, TICK_US, TICK_US, 5u, {0u}},
+    {"keyTask", APP_CFG_KEY_TASK_PRIO, APP_CFG_KEY_TASK_PERIOD*TICK_US,
+     APP_CFG_KEY_TASK_DEADLINE*TICK_US, 20u, {0u}},
+    {"OS_TickTask", OS_CFG_TICK_TASK_PRIO, TICK_US, TICK_US, 10u, {0u}},
+    {"swCounterTask", APP_CFG_SWCNT_TASK_PRIO, APP_CFG_SWCNT_TASK_PERIOD*TICK_US,
+     APP_CFG_SWCNT_TASK_DEADLINE*TICK_US, 15u, {[RES_SWCNT] = 2u}},
+    {"lcdLayeredTask", APP_CFG_LCD_TASK_PRIO, (APP_CFG_LCD_FRAME_TICKS + 1u)*TICK_US,
+     (APP_CFG_LCD_FRAME_TICKS + 1u)*TICK_US,
+     (APP_CFG_LCD_ROWS*APP_CFG_LCD_COLS + APP_CFG_LCD_ROWS)*LCD_CHAR_US + 60u, {[RES_LCD] = 60u}},
+    {"appTimerDisplayTask", APP_CFG_TIMER_DISP_PRIO, APP_CFG_SWCNT_TASK_PERIOD*TICK_US,
+     APP_CFG_SWCNT_TASK_PERIOD*TICK_US, 40u, {[RES_LCD] = 15u, [RES_TIMECOUNT] = 1u}},
+    {"appTimerControlTask", APP_CFG_TIMER_CTRL_PRIO, APP_CFG_KEY_TASK_PERIOD*TICK_US,
+     50u*TICK_US, 30u, {[RES_LCD] = 15u, [RES_SWCNT] = 2u, [RES_TIMECOUNT] = 1u}},
+    {"OS_TmrTask", OS_CFG_TMR_TASK_PRIO, (OS_CFG_TICK_RATE_HZ/OS_CFG_TMR_TASK_RATE_HZ)*TICK_US,
+     (OS_CFG_TICK_RATE_HZ/OS_CFG_TMR_TASK_RATE_HZ)*TICK_US, 20u, {0u}},
+    {"memIntegrityTask", APP_CFG_MEMINT_TASK_PRIO, 1000000u, 1000000u, 12000u, {[RES_MEMINT] = 2u}},
+};
+
+/* Blocking of task i when the tasks with lower[] set are below it */
+static unsigned long rtaBlocking(const RTA_TASK *tbl, int i, const int *lower){
+    unsigned long byTask = 0u;
+    unsigned long byRes = 0u;
+    unsigned long longest;
+    unsigned long res_max[RES_NBR] = {0u};
+    int used[RES_NBR] = {0};
+    int j;
+    int r;
+    for(j = 0; j < TASKS; j++){
+        for(r = 0; r < RES_NBR; r++){
+            used[r] |= (!lower[j] && (tbl[j].cs[r] != 0u));
+        }
+    }
+    for(j = 0; j < TASKS; j++){
+        if(lower[j]){
+            longest = 0u;
+            for(r = 0; r < RES_NBR; r++){
+                if(used[r] && (tbl[j].cs[r] > longest)){
+                    longest = tbl[j].cs[r];
+                }else{
+                }
+                if(used[r] && (tbl[j].cs[r] > res_max[r])){
+                    res_max[r] = tbl[j].cs[r];
+                }else{
+                }
+            }
+            byTask += longest;
+        }else{
+        }
+    }
+    for(r = 0; r < RES_NBR; r++){
+        byRes += res_max[r];
+    }
+    return (byTask < byRes) ? byTask : byRes;
+}
+
+/* Response time of task i with the tasks with lower[] set below it and the rest, other
+ * than i, at or above it. Returns a value past the deadline when it does not settle. */
+static unsigned long rtaResponse(const RTA_TASK *tbl, int i, const int *lower, unsigned long *p_block){
+    unsigned long block = rtaBlocking(tbl, i, lower);
+    unsigned long r = tbl[i].wcet + block;
+    unsigned long next;
+    int j;
+    for(;;){
+        next = tbl[i].wcet + block;
+        for(j = 0; j < TASKS; j++){
+            if((j != i) && !lower[j]){
+                next += ((r + tbl[j].period - 1u)/tbl[j].period)*tbl[j].wcet;
+            }else{
+            }
+        }
+        if((next == r) || (next > tbl[i].deadline)){
+            break;
+        }else{
+        }
+        r = next;
+    }
+    if(p_block != (unsigned long *)0){
+        *p_block = block;
+    }else{
+    }
+    return next;
+}
+
+static void loadWcet(const char *path){
+    char name[64];
+    unsigned long wcet;
+    FILE *f = fopen(path, "r");
+    int i;
+    if(f == (FILE *)0){
+        perror(path);
+        exit(2);
+    }else{
+    }
+    while(fscanf(f, "%63s %lu", name, &wcet) == 2){
+        for(i = 0; i < TASKS; i++){
+            if(strcmp(name, taskTbl[i].name) == 0){
+                taskTbl[i].wcet = wcet;
+            }else{
+            }
+        }
+    }
+    fclose(f);
+}
+
+int main(int argc, char **argv){
+    int lower[TASKS];
+    int order[TASKS];
+    int assigned[TASKS];
+    unsigned long resp;
+    unsigned long block;
+    double util = 0.0;
+    int failCnt = 0;
+    int level;
+    int best;
+    int i;
+    int j;
+    int r;
+
+    if(argc > 1){
+        loadWcet(argv[1]);
+    }else{
+    }
+    printf("%-20s %4s %8s %8s %8s %6s %8s\n", "task", "prio", "T us", "D us", "C us", "B us", "R us");
+    for(i = 0; i < TASKS; i++){
+        for(j = 0; j < TASKS; j++){
+            lower[j] = (taskTbl[j].prio > taskTbl[i].prio);
+        }
+        resp = rtaResponse(taskTbl, i, lower, &block);
+        util += (double)taskTbl[i].wcet/taskTbl[i].period;
+        printf("%-20s %4d %8lu %8lu %8lu %6lu %8lu", taskTbl[i].name, taskTbl[i].prio,
+               taskTbl[i].period, taskTbl[i].deadline, taskTbl[i].wcet, block, resp);
+        if(resp > taskTbl[i].deadline){
+            printf("  MISSES DEADLINE");
+            failCnt++;
+        }else{
+            for(j = 0; j < TASKS; j++){
+                if((taskTbl[j].prio > taskTbl[i].prio) && (taskTbl[j].deadline < taskTbl[i].deadline)){
+                    printf("  over-provisioned, above %s", taskTbl[j].name);
+                    break;
+                }else{
+                }
+            }
+        }
+        printf("\n");
+    }
+    printf("utilization %.1f%%\n", 100.0*util);
+    for(r = 0; r < RES_NBR; r++){
+        printf("%s used by", resName[r]);
+        for(j = 0; j < TASKS; j++){
+            if(taskTbl[j].cs[r] != 0u){
+                printf(" %s", taskTbl[j].name);
+            }else{
+            }
+        }
+        printf("\n");
+    }
+
+    /* Audsley: fill each level from the lowest with a task that meets its deadline there,
+     * the one with the longest deadline when several do. The ISR stays on top. */
+    memset(assigned, 0, sizeof(assigned));
+    for(level = TASKS - 1; level >= 0; level--){
+        best = -1;
+        for(i = 0; i < TASKS; i++){
+            if(assigned[i] || ((taskTbl[i].prio == RTA_ISR_PRIO) && (level != 0))){
+                continue;
+            }else{
+            }
+            if(rtaResponse(taskTbl, i, assigned, (unsigned long *)0) <= taskTbl[i].deadline){
+                if((best < 0) || (taskTbl[i].deadline > taskTbl[best].deadline)){
+                    best = i;
+                }else{
+                }
+            }else{
+            }
+        }
+        if(best < 0){
+            printf("no schedulable priority order\n");
+            return 1;
+        }else{
+        }
+        assigned[best] = 1;
+        order[level] = best;
+    }
+    printf("recommended order, highest first:");
+    for(level = 0; level < TASKS; level++){
+        printf(" %s", taskTbl[order[level]].name);
+    }
+    printf("\n%s\n", (failCnt != 0) ? "configured priorities NOT schedulable" : "configured priorities schedulable");
+    return failCnt != 0;
+}
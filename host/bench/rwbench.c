@@ -0,0 +1,189 @@
+/*****************************************************************************************
+* rwbench - OS_RWLOCK against OS_MUTEX
+* First times uncontended pend+post for the mutex and for the lock as reader and writer.
+* Then ctl resumes one of the two lowest workers per operation. The worker takes the
+* lock to read or write a shared array, with wr% of operations writing. With preemption
+* on, 30% of the sections resume a higher worker, which contends for the same lock.
+* Prints cycles, critical sections and context switches per operation, and the share of
+* operations that found the lock held against them. Readers check that they never see
+* a torn write.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+#include "os.h"
+
+#define WORKERS     4
+#define OPS         400000u
+#define STK_SIZE    512u
+#define DATA_LEN    8
+
+/* State bits, see os_rwlock.c */
+#define RW_WR       0x80000000u
+#define RW_WAIT     0x40000000u
+
+static OS_TCB workerTCB[WORKERS];
+static OS_TCB ctlTCB;
+static CPU_STK workerStk[WORKERS][STK_SIZE];
+static CPU_STK ctlStk[STK_SIZE];
+
+static OS_RWLOCK rwLock;
+static OS_MUTEX mutex;
+static CPU_BOOLEAN useRw;
+static unsigned wrPct;
+static unsigned preemptPct;
+static volatile CPU_INT32U shared[DATA_LEN];
+static unsigned long blockedCnt;
+static unsigned long errCnt;
+static unsigned long opCnt;
+static unsigned seed = 1u;
+
+static unsigned rnd(unsigned n){
+    seed = seed*1103515245u + 12345u;
+    return (seed >> 16) % n;
+}
+
+static void checkShared(void){
+    CPU_INT32U val = shared[0];
+    int i;
+    for(i = 1; i < DATA_LEN; i++){
+        errCnt += (shared[i] != val);
+    }
+}
+
+static void doOp(unsigned level){
+    OS_ERR os_err;
+    CPU_BOOLEAN write = (rnd(100u) < wrPct);
+    CPU_INT32U val;
+    int i;
+    if(useRw){
+        if(write){
+            blockedCnt += ((rwLock.State & ~RW_WAIT) != 0u);
+            OSRWLockPendWr(&rwLock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+        }else{
+            blockedCnt += ((rwLock.State & (RW_WR | RW_WAIT)) != 0u);
+            OSRWLockPendRd(&rwLock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+        }
+    }else{
+        blockedCnt += (mutex.OwnerTCBPtr != (OS_TCB *)0);
+        OSMutexPend(&mutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    }
+    errCnt += (os_err != OS_ERR_NONE);
+    if(write){
+        val = shared[0] + 1u;
+        for(i = 0; i < DATA_LEN; i++){
+            shared[i] = val;
+        }
+    }else{
+        checkShared();
+    }
+    if((level > 0u) && (rnd(100u) < preemptPct)){
+        /* A higher priority worker preempts the holder */
+        OSTaskResume(&workerTCB[rnd(level)], &os_err);
+    }else{
+    }
+    checkShared();
+    if(useRw){
+        if(write){
+            OSRWLockPostWr(&rwLock, OS_OPT_POST_NONE, &os_err);
+        }else{
+            OSRWLockPostRd(&rwLock, OS_OPT_POST_NONE, &os_err);
+        }
+    }else{
+        OSMutexPost(&mutex, OS_OPT_POST_NONE, &os_err);
+    }
+    errCnt += (os_err != OS_ERR_NONE);
+    opCnt++;
+}
+
+static void workerTask(void *p_arg){
+    OS_ERR os_err;
+    unsigned level = (unsigned)(long)p_arg;
+    for(;;){
+        OSTaskSuspend((OS_TCB *)0, &os_err);
+        doOp(level);
+    }
+}
+
+static void timeUncontended(int kind){
+    static const char *name[] = {"mutex", "rwlock rd", "rwlock wr"};
+    OS_ERR os_err;
+    unsigned long cs0 = HostCritSectCtr;
+    unsigned long long t0 = __rdtsc();
+    unsigned i;
+    for(i = 0; i < 4u*OPS; i++){
+        if(kind == 0){
+            OSMutexPend(&mutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+            OSMutexPost(&mutex, OS_OPT_POST_NONE, &os_err);
+        }else if(kind == 1){
+            OSRWLockPendRd(&rwLock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+            OSRWLockPostRd(&rwLock, OS_OPT_POST_NONE, &os_err);
+        }else{
+            OSRWLockPendWr(&rwLock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+            OSRWLockPostWr(&rwLock, OS_OPT_POST_NONE, &os_err);
+        }
+        errCnt += (os_err != OS_ERR_NONE);
+    }
+    printf("uncontended %-10s pend+post  cycles %5.1f  critical sections %4.2f\n", name[kind],
+           (double)(__rdtsc() - t0)/(4u*OPS), (double)(HostCritSectCtr - cs0)/(4u*OPS));
+}
+
+static void ctlTask(void *p_arg){
+    static const unsigned ratioTbl[] = {0u, 5u, 10u, 25u, 50u, 100u};
+    OS_ERR os_err;
+    OS_CTX_SW_CTR sw0;
+    unsigned long cs0;
+    unsigned long long t0;
+    unsigned r;
+    unsigned i;
+    int kind;
+    int pass;
+    (void)p_arg;
+    for(kind = 0; kind < 3; kind++){
+        timeUncontended(kind);
+    }
+    printf("%-8s %5s %9s %8s %8s %9s\n", "lock", "wr%", "cyc/op", "cs/op", "blocked%", "switch/op");
+    printf("(cs/op includes 4 for the resume and self-suspend of each operation)\n");
+    for(pass = 0; pass < 2; pass++){
+        preemptPct = (pass != 0) ? 30u : 0u;
+        printf("-- preemption inside the section %u%%\n", preemptPct);
+        for(r = 0; r < sizeof(ratioTbl)/sizeof(ratioTbl[0]); r++){
+            for(useRw = DEF_FALSE; useRw <= DEF_TRUE; useRw++){
+                wrPct = ratioTbl[r];
+                seed = 1u;
+                opCnt = 0u;
+                blockedCnt = 0u;
+                sw0 = OSTaskCtxSwCtr;
+                cs0 = HostCritSectCtr;
+                t0 = __rdtsc();
+                for(i = 0; i < OPS; i++){
+                    OSTaskResume(&workerTCB[WORKERS - 1 - (int)rnd(2u)], &os_err);
+                }
+                t0 = __rdtsc() - t0;
+                printf("%-8s %5u %9.1f %8.2f %8.2f %9.2f\n", useRw ? "rwlock" : "mutex", wrPct,
+                       (double)t0/opCnt, (double)(HostCritSectCtr - cs0)/opCnt,
+                       100.0*blockedCnt/opCnt, (double)(OSTaskCtxSwCtr - sw0)/opCnt);
+            }
+        }
+    }
+    printf("errors %lu\n", errCnt);
+    exit(errCnt != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    long i;
+    OSInit(&os_err);
+    OSRWLockCreate(&rwLock, "rwLock", &os_err);
+    OSMutexCreate(&mutex, "mutex", &os_err);
+    for(i = 0; i < WORKERS; i++){
+        OSTaskCreate(&workerTCB[i], "worker", workerTask, (void *)i, (OS_PRIO)(10 + i),
+                     &workerStk[i][0], 0u, STK_SIZE, 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    }
+    OSTaskCreate(&ctlTCB, "ctl", ctlTask, (void *)0, 20u, &ctlStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
@@ -0,0 +1,206 @@
+/*****************************************************************************************
+* rwtest - OS_RWLOCK state test
+* ctl, the lowest priority task, steps readers A and B and writers W and X through the
+* cases below. Each task appends its letter to order[] while it holds the lock, so the
+* hand-off order can be checked:
+*   1 uncontended read and write paths take no critical section
+*   2 a waiting writer holds off later readers, then the prefix of readers goes at once
+*   3 a writer release readies every reader ahead of the first writer
+*   4 error codes
+*   5 a waiting writer deleted leaves a stale wait bit, which the next reader clears
+*   6 a priority change reorders the waiters
+*   7 delete with waiters
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "os.h"
+
+#define STK_SIZE    512u
+
+/* State bits, see os_rwlock.c */
+#define RW_WR       0x80000000u
+#define RW_WAIT     0x40000000u
+#define RW_RD_MASK  0x3FFFFFFFu
+
+#define CHECK(c)    do{ if(!(c)){ printf("FAIL step %d line %d: %s\n", step, __LINE__, #c); failCnt++; } }while(0)
+
+static OS_TCB rd1TCB;
+static OS_TCB rd2TCB;
+static OS_TCB wr1TCB;
+static OS_TCB wr2TCB;
+static OS_TCB ctlTCB;
+static CPU_STK rd1Stk[STK_SIZE];
+static CPU_STK rd2Stk[STK_SIZE];
+static CPU_STK wr1Stk[STK_SIZE];
+static CPU_STK wr2Stk[STK_SIZE];
+static CPU_STK ctlStk[STK_SIZE];
+
+static OS_RWLOCK lock;
+static OS_RWLOCK delLock;
+static int failCnt;
+static int step;
+static char order[16];
+static int orderCnt;
+
+static void rdTask(void *p_arg){
+    OS_ERR os_err;
+    char id = *(char *)p_arg;
+    for(;;){
+        OSTaskSuspend((OS_TCB *)0, &os_err);
+        if(step == 7){
+            OSRWLockPendRd(&delLock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+            CHECK(os_err == OS_ERR_OBJ_DEL);
+            continue;
+        }else{
+        }
+        OSRWLockPendRd(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+        CHECK((os_err == OS_ERR_NONE) && ((lock.State & RW_WR) == 0u) && ((lock.State & RW_RD_MASK) != 0u));
+        order[orderCnt++] = id;
+        OSRWLockPostRd(&lock, OS_OPT_POST_NONE, &os_err);
+        CHECK(os_err == OS_ERR_NONE);
+    }
+}
+
+static void wrTask(void *p_arg){
+    OS_ERR os_err;
+    char id = *(char *)p_arg;
+    OS_TCB *p_self = (id == 'W') ? &wr1TCB : &wr2TCB;
+    for(;;){
+        OSTaskSuspend((OS_TCB *)0, &os_err);
+        OSRWLockPendWr(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+        CHECK((os_err == OS_ERR_NONE) && ((lock.State & (RW_WR | RW_RD_MASK)) == RW_WR) && (lock.OwnerTCBPtr == p_self));
+        order[orderCnt++] = id;
+        OSRWLockPostWr(&lock, OS_OPT_POST_NONE, &os_err);
+        CHECK(os_err == OS_ERR_NONE);
+    }
+}
+
+static void ctlTask(void *p_arg){
+    OS_ERR os_err;
+    unsigned long cs0;
+    (void)p_arg;
+
+    step = 1;
+    cs0 = HostCritSectCtr;
+    OSRWLockPendRd(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    OSRWLockPendRd(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    CHECK(lock.State == 2u);
+    OSRWLockPostRd(&lock, OS_OPT_POST_NONE, &os_err);
+    OSRWLockPostRd(&lock, OS_OPT_POST_NONE, &os_err);
+    CHECK(lock.State == 0u);
+    OSRWLockPendWr(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    CHECK((lock.State == RW_WR) && (lock.OwnerTCBPtr == &ctlTCB));
+    OSRWLockPostWr(&lock, OS_OPT_POST_NONE, &os_err);
+    CHECK((os_err == OS_ERR_NONE) && (lock.State == 0u) && (lock.OwnerTCBPtr == (OS_TCB *)0));
+    CHECK(HostCritSectCtr == cs0);
+
+    step = 2;
+    OSRWLockPendRd(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    OSTaskResume(&wr1TCB, &os_err);
+    CHECK((wr1TCB.PendOn == OS_TASK_PEND_ON_RWLOCK_WR) && ((lock.State & RW_WAIT) != 0u));
+    OSTaskResume(&rd1TCB, &os_err);
+    CHECK(rd1TCB.PendOn == OS_TASK_PEND_ON_RWLOCK_RD);
+    OSTaskResume(&rd2TCB, &os_err);
+    OSTaskResume(&wr2TCB, &os_err);
+    CHECK(lock.State == (RW_WAIT | 1u));
+    OSRWLockPendRd(&lock, 0u, OS_OPT_PEND_NON_BLOCKING, &os_err);
+    CHECK(os_err == OS_ERR_PEND_WOULD_BLOCK);
+    orderCnt = 0;
+    OSRWLockPostRd(&lock, OS_OPT_POST_NONE, &os_err);
+    order[orderCnt] = '\0';
+    CHECK((os_err == OS_ERR_NONE) && (strcmp(order, "AWBX") == 0) && (lock.State == 0u) && (lock.OwnerTCBPtr == (OS_TCB *)0));
+
+    step = 3;
+    OSRWLockPendWr(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    OSTaskResume(&rd2TCB, &os_err);
+    OSTaskResume(&rd1TCB, &os_err);
+    OSTaskResume(&wr2TCB, &os_err);
+    CHECK(lock.PendList.HeadPtr == &rd1TCB);
+    orderCnt = 0;
+    OSRWLockPostWr(&lock, OS_OPT_POST_NO_SCHED, &os_err);
+    CHECK(os_err == OS_ERR_NONE);
+    CHECK((lock.State == (RW_WAIT | 2u)) && (orderCnt == 0));
+    OSSched();
+    order[orderCnt] = '\0';
+    CHECK((strcmp(order, "ABX") == 0) && (lock.State == 0u));
+
+    step = 4;
+    OSRWLockPostRd(&lock, OS_OPT_POST_NONE, &os_err);
+    CHECK(os_err == OS_ERR_MUTEX_NOT_OWNER);
+    OSRWLockPostWr(&lock, OS_OPT_POST_NONE, &os_err);
+    CHECK(os_err == OS_ERR_MUTEX_NOT_OWNER);
+    OSRWLockPendWr(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    OSRWLockPendWr(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    CHECK(os_err == OS_ERR_MUTEX_OWNER);
+    OSRWLockPendRd(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    CHECK(os_err == OS_ERR_MUTEX_OWNER);
+    OSRWLockPostRd(&lock, OS_OPT_POST_NONE, &os_err);
+    CHECK(os_err == OS_ERR_MUTEX_NOT_OWNER);
+    OSRWLockPostWr(&lock, OS_OPT_POST_NONE, &os_err);
+    CHECK((os_err == OS_ERR_NONE) && (lock.State == 0u));
+    OSRWLockPendRd(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    OSRWLockPendWr(&lock, 0u, OS_OPT_PEND_NON_BLOCKING, &os_err);
+    CHECK((os_err == OS_ERR_PEND_WOULD_BLOCK) && (lock.State == 1u));
+    OSRWLockPostRd(&lock, OS_OPT_POST_NONE, &os_err);
+
+    step = 5;
+    OSRWLockPendRd(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    OSTaskResume(&wr1TCB, &os_err);
+    CHECK(lock.State == (RW_WAIT | 1u));
+    OSTaskDel(&wr1TCB, &os_err);
+    CHECK((os_err == OS_ERR_NONE) && (lock.PendList.HeadPtr == (OS_TCB *)0));
+    cs0 = HostCritSectCtr;
+    OSRWLockPendRd(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    CHECK((os_err == OS_ERR_NONE) && (lock.State == 2u) && (HostCritSectCtr > cs0));
+    OSRWLockPostRd(&lock, OS_OPT_POST_NONE, &os_err);
+    OSRWLockPostRd(&lock, OS_OPT_POST_NONE, &os_err);
+    CHECK(lock.State == 0u);
+
+    step = 6;
+    OSRWLockPendWr(&lock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    OSTaskResume(&rd2TCB, &os_err);
+    OSTaskResume(&wr2TCB, &os_err);
+    OSTaskChangePrio(&wr2TCB, 11u, &os_err);
+    CHECK(lock.PendList.HeadPtr == &wr2TCB);
+    orderCnt = 0;
+    OSRWLockPostWr(&lock, OS_OPT_POST_NONE, &os_err);
+    order[orderCnt] = '\0';
+    CHECK((strcmp(order, "XB") == 0) && (lock.State == 0u));
+
+    step = 7;
+    OSRWLockPendWr(&delLock, 0u, OS_OPT_PEND_BLOCKING, &os_err);
+    OSTaskResume(&rd1TCB, &os_err);
+    OSTaskResume(&rd2TCB, &os_err);
+    OSRWLockDel(&delLock, OS_OPT_DEL_NO_PEND, &os_err);
+    CHECK(os_err == OS_ERR_TASK_WAITING);
+    CHECK((OSRWLockDel(&delLock, OS_OPT_DEL_ALWAYS, &os_err) == 2u) && (os_err == OS_ERR_NONE));
+
+    printf("%s (%d failures)\n", (failCnt != 0) ? "FAILED" : "ok", failCnt);
+    exit(failCnt != 0);
+}
+
+int main(void){
+    static char idA = 'A';
+    static char idB = 'B';
+    static char idW = 'W';
+    static char idX = 'X';
+    OS_ERR os_err;
+    OSInit(&os_err);
+    OSRWLockCreate(&lock, "lock", &os_err);
+    OSRWLockCreate(&delLock, "delLock", &os_err);
+    OSTaskCreate(&rd1TCB, "A", rdTask, &idA, 10u, &rd1Stk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&wr1TCB, "W", wrTask, &idW, 11u, &wr1Stk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&rd2TCB, "B", rdTask, &idB, 12u, &rd2Stk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&wr2TCB, "X", wrTask, &idX, 14u, &wr2Stk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSTaskCreate(&ctlTCB, "ctl", ctlTask, (void *)0, 30u, &ctlStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
@@ -0,0 +1,231 @@
+/*****************************************************************************************
+* tmrtest - Delay, timeout and timer expiry test
+* ctl, the lowest application task, checks that every wake up lands on the exact tick:
+*   1 OSTimeDly() for delays below, at and past the wheel sizes
+*   2 periodic and match delays
+*   3 sleepers whose deadlines fall on the same tick wheel spoke
+*   4 pend timeouts, and a post that removes a pending timeout
+*   5 OSTimeDlyResume()
+*   6 one-shot and periodic timers, OSTmrRemainGet() and OSTmrStop(), against the timer
+*     tick each expiry is due on
+* Time is virtual: the idle hook runs OSTimeTick() as the tick ISR would, so the test
+* takes no wall clock time. Built both with the sorted lists and, from "make wheel", with
+* OS_CFG_TICK_WHEEL_EN and OS_CFG_TMR_WHEEL_EN.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "os.h"
+
+#define TICKS_MAX       200000u
+#define STK_SIZE        512u
+#define SLEEPERS        4
+#define TMRS            6
+#define TMR_RUN         200u
+#define FIRE_MAX        256
+
+#define CHECK(c)    do{ if(!(c)){ printf("FAIL step %d line %d: %s\n", step, __LINE__, #c); failCnt++; } }while(0)
+
+typedef struct{
+    OS_TCB tcb;
+    CPU_STK stk[STK_SIZE];
+    OS_SEM *semPtr;
+    OS_TICK dly;
+    OS_TICK elapsed;
+    OS_ERR err;
+}SLEEPER;
+
+typedef struct{
+    OS_TMR tmr;
+    OS_TICK dly;
+    OS_TICK period;
+    OS_TICK fire[FIRE_MAX];
+    int fireCnt;
+}TEST_TMR;
+
+static OS_TCB ctlTCB;
+static CPU_STK ctlStk[STK_SIZE];
+static SLEEPER sleeper[SLEEPERS];
+static OS_SEM semA;
+static OS_SEM semB;
+static int failCnt;
+static int step;
+
+/* Spans the tick wheel (32 spokes), the timer wheel (64) and both, with the stopped timer last */
+static TEST_TMR testTmr[TMRS] = {
+    {.dly = 3u,  .period = 0u},
+    {.dly = 64u, .period = 0u},
+    {.dly = 65u, .period = 0u},
+    {.dly = 0u,  .period = 3u},
+    {.dly = 5u,  .period = 64u},
+    {.dly = 0u,  .period = 7u},
+};
+
+static void simIdle(void){
+    OSIntEnter();
+    OSTimeTick();
+    OSIntExit();
+    if(OSTickCtr > TICKS_MAX){
+        printf("FAIL step %d: no progress after %u ticks\n", step, TICKS_MAX);
+        exit(1);
+    }else{
+    }
+}
+
+static void sleeperTask(void *p_arg){
+    SLEEPER *p_s = (SLEEPER *)p_arg;
+    OS_ERR os_err;
+    OS_TICK t0;
+    for(;;){
+        OSTaskSuspend((OS_TCB *)0, &os_err);
+        t0 = OSTimeGet(&os_err);
+        if(p_s->semPtr != (OS_SEM *)0){
+            OSSemPend(p_s->semPtr, p_s->dly, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &p_s->err);
+        }else{
+            OSTimeDly(p_s->dly, OS_OPT_TIME_DLY, &p_s->err);
+        }
+        p_s->elapsed = OSTimeGet(&os_err) - t0;
+    }
+}
+
+static void tmrCallback(void *p_tmr, void *p_arg){
+    TEST_TMR *p_t = (TEST_TMR *)p_arg;
+    (void)p_tmr;
+    if(p_t->fireCnt < FIRE_MAX){
+        p_t->fire[p_t->fireCnt] = OSTmrTickCtr;
+    }else{
+    }
+    p_t->fireCnt++;
+}
+
+/* Checks that timer t fired on exactly the timer ticks in (base, end] it was due on */
+static void checkFires(int t, OS_TICK base, OS_TICK end){
+    TEST_TMR *p_t = &testTmr[t];
+    OS_TICK due = base + ((p_t->dly != 0u) ? p_t->dly : p_t->period);
+    int n = 0;
+    while((OS_TICK)(due - base) <= (OS_TICK)(end - base)){
+        CHECK((n < p_t->fireCnt) && (p_t->fire[n] == due));
+        n++;
+        if(p_t->period == 0u){
+            break;
+        }else{
+        }
+        due += p_t->period;
+    }
+    CHECK(p_t->fireCnt == n);
+}
+
+static void ctlTask(void *p_arg){
+    static const OS_TICK dlyTbl[] = {1u, 2u, 5u, 31u, 32u, 33u, 63u, 64u, 65u, 100u, 1000u};
+    OS_ERR os_err;
+    OS_TICK t0;
+    OS_TICK t1;
+    OS_TICK base;
+    OS_TICK stopAt = 0u;
+    unsigned i;
+    int t;
+    (void)p_arg;
+
+    step = 1;
+    for(i = 0; i < sizeof(dlyTbl)/sizeof(dlyTbl[0]); i++){
+        t0 = OSTimeGet(&os_err);
+        OSTimeDly(dlyTbl[i], OS_OPT_TIME_DLY, &os_err);
+        CHECK((os_err == OS_ERR_NONE) && (OSTimeGet(&os_err) - t0 == dlyTbl[i]));
+    }
+
+    step = 2;
+    OSTimeDly(45u, OS_OPT_TIME_PERIODIC, &os_err);
+    t0 = OSTimeGet(&os_err);
+    for(i = 1; i <= 6u; i++){
+        OSTimeDly(45u, OS_OPT_TIME_PERIODIC, &os_err);
+        CHECK(OSTimeGet(&os_err) == t0 + 45u*i);
+    }
+    t0 = OSTimeGet(&os_err) + 77u;
+    OSTimeDly(t0, OS_OPT_TIME_MATCH, &os_err);
+    CHECK((os_err == OS_ERR_NONE) && (OSTimeGet(&os_err) == t0));
+
+    step = 3;
+    for(i = 0; i < SLEEPERS; i++){
+        sleeper[i].semPtr = (OS_SEM *)0;
+        sleeper[i].dly = 3u + 32u*(SLEEPERS - 1u - i);
+        OSTaskResume(&sleeper[i].tcb, &os_err);
+    }
+    OSTimeDly(200u, OS_OPT_TIME_DLY, &os_err);
+    for(i = 0; i < SLEEPERS; i++){
+        CHECK((sleeper[i].err == OS_ERR_NONE) && (sleeper[i].elapsed == sleeper[i].dly));
+    }
+
+    step = 4;
+    sleeper[0].semPtr = &semA;
+    sleeper[0].dly = 40u;
+    sleeper[1].semPtr = &semB;
+    sleeper[1].dly = 72u;
+    OSTaskResume(&sleeper[0].tcb, &os_err);
+    OSTaskResume(&sleeper[1].tcb, &os_err);
+    OSTimeDly(20u, OS_OPT_TIME_DLY, &os_err);
+    OSSemPost(&semB, OS_OPT_POST_1, &os_err);
+    CHECK((sleeper[1].err == OS_ERR_NONE) && (sleeper[1].elapsed == 20u));
+    OSTimeDly(100u, OS_OPT_TIME_DLY, &os_err);
+    CHECK((sleeper[0].err == OS_ERR_TIMEOUT) && (sleeper[0].elapsed == 40u));
+    CHECK(sleeper[1].elapsed == 20u);
+
+    step = 5;
+    sleeper[0].semPtr = (OS_SEM *)0;
+    sleeper[0].dly = 500u;
+    OSTaskResume(&sleeper[0].tcb, &os_err);
+    OSTimeDly(7u, OS_OPT_TIME_DLY, &os_err);
+    OSTimeDlyResume(&sleeper[0].tcb, &os_err);
+    CHECK((os_err == OS_ERR_NONE) && (sleeper[0].elapsed == 7u));
+    OSTimeDlyResume(&sleeper[0].tcb, &os_err);
+    CHECK(os_err == OS_ERR_TASK_NOT_DLY);
+
+    step = 6;
+    for(t = 0; t < TMRS; t++){
+        OSTmrCreate(&testTmr[t].tmr, "test", testTmr[t].dly, testTmr[t].period,
+                    (testTmr[t].period != 0u) ? OS_OPT_TMR_PERIODIC : OS_OPT_TMR_ONE_SHOT,
+                    tmrCallback, &testTmr[t], &os_err);
+        CHECK(os_err == OS_ERR_NONE);
+    }
+    base = OSTmrTickCtr;
+    for(t = 0; t < TMRS; t++){
+        OSTmrStart(&testTmr[t].tmr, &os_err);
+        CHECK(os_err == OS_ERR_NONE);
+    }
+    /* Wakes once per timer tick, so every value of OSTmrTickCtr is seen */
+    while((OS_TICK)(OSTmrTickCtr - base) < TMR_RUN){
+        OSTimeDly(OS_CFG_TICK_RATE_HZ/OS_CFG_TMR_TASK_RATE_HZ, OS_OPT_TIME_DLY, &os_err);
+        if((OS_TICK)(OSTmrTickCtr - base) == TMR_RUN/2u){
+            CHECK(OSTmrRemainGet(&testTmr[4].tmr, &os_err) == 5u + 2u*64u - TMR_RUN/2u);
+            OSTmrStop(&testTmr[TMRS - 1].tmr, OS_OPT_TMR_NONE, (void *)0, &os_err);
+            CHECK(os_err == OS_ERR_NONE);
+            stopAt = OSTmrTickCtr;
+        }else{
+        }
+    }
+    t1 = OSTmrTickCtr;
+    for(t = 0; t < TMRS; t++){
+        OSTmrStop(&testTmr[t].tmr, OS_OPT_TMR_NONE, (void *)0, &os_err);
+        checkFires(t, base, (t == TMRS - 1) ? stopAt : t1);
+    }
+
+    printf("%s (%d failures)\n", (failCnt != 0) ? "FAILED" : "ok", failCnt);
+    exit(failCnt != 0);
+}
+
+int main(void){
+    OS_ERR os_err;
+    long i;
+    HostIdleHookPtr = simIdle;
+    OSInit(&os_err);
+    OSSemCreate(&semA, "A", 0u, &os_err);
+    OSSemCreate(&semB, "B", 0u, &os_err);
+    for(i = 0; i < SLEEPERS; i++){
+        OSTaskCreate(&sleeper[i].tcb, "sleeper", sleeperTask, &sleeper[i], (OS_PRIO)(10 + i),
+                     &sleeper[i].stk[0], 0u, STK_SIZE, 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    }
+    OSTaskCreate(&ctlTCB, "ctl", ctlTask, (void *)0, 20u, &ctlStk[0], 0u, STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_NONE, &os_err);
+    OSStart(&os_err);
+    return 1;
+}
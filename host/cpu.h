@@ -0,0 +1,28 @@
+/*****************************************************************************************
+* cpu.h - Host port
+* Uses the target's CPU definitions and replaces only the memory barriers, which are the
+* Cortex-M DSB instruction there.
+* By default CPU_MB() is a full fence. Build with HOST_CPU_UP defined to make every
+* barrier a compiler barrier only, which is what a single core Cortex-M needs between a
+* task and an ISR.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_CPU_H
+#define HOST_CPU_H
+
+#include "../uCOS/uC-CPU/cpu.h"
+
+#undef CPU_MB
+#undef CPU_RMB
+#undef CPU_WMB
+
+#ifdef HOST_CPU_UP
+#define CPU_MB()        __asm__ __volatile__ ("" : : : "memory")
+#else
+#define CPU_MB()        __sync_synchronize()
+#endif
+#define CPU_RMB()       __asm__ __volatile__ ("" : : : "memory")
+#define CPU_WMB()       __asm__ __volatile__ ("" : : : "memory")
+
+#endif
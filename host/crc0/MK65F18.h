@@ -0,0 +1,89 @@
+/*****************************************************************************************
+* MK65F18.h - Host CRC0 model
+* The device header with CRC0 and SIM replaced by host models, so the CRC code in
+* MemoryTools.c runs unmodified. A store can not be caught in C, so the model is C++:
+* every CRC0 register is a proxy whose assignment and read go to HostCRC0, and the
+* programs that use it build MemoryTools.c as C++. Only the registers MemoryTools.c and
+* MemCRCService.c touch are modelled, SIM is plain memory.
+*
+* Writes to the data register are transposed as CTRL[TOT] says and shifted into the
+* engine most significant bit first, one byte for an 8 bit write to any lane, four for
+* a 32 bit write. With CTRL[WAS] set the transposed write loads the seed instead. Reads
+* complement (FXOR) and transpose (TOTR) the result within the CRC width, 16 bits for
+* TCRC=0, which is how MemCRCGet() and MemCRCSw read it.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_CRC0_MK65F18_H
+#define HOST_CRC0_MK65F18_H
+
+#include "../../device/MK65F18.h"
+
+#ifdef __cplusplus
+
+typedef struct{
+    uint32_t ctrl;
+    uint32_t gpoly;
+    uint32_t crc;                       /* Engine register, before FXOR and TOTR        */
+    unsigned long writeCtr[5];          /* Data register writes by width in bytes       */
+}HOST_CRC0;
+
+extern HOST_CRC0 HostCRC0;
+
+void HostCRC0Write(unsigned lane, unsigned bytes, uint32_t value);
+uint32_t HostCRC0Read(void);
+
+/* Data register, BYTES wide at byte LANE */
+template<unsigned LANE, unsigned BYTES> struct HostCRC0Data{
+    HostCRC0Data &operator=(uint32_t value){
+        HostCRC0Write(LANE, BYTES, value);
+        return *this;
+    }
+    operator uint32_t() const{
+        return (HostCRC0Read() >> (8u*LANE)) & (0xFFFFFFFFu >> (32u - 8u*BYTES));
+    }
+};
+
+/* Plain register REG of HostCRC0, BYTES wide at byte LANE */
+template<uint32_t HOST_CRC0::*REG, unsigned LANE, unsigned BYTES> struct HostCRC0Reg{
+    HostCRC0Reg &operator=(uint32_t value){
+        uint32_t mask = (0xFFFFFFFFu >> (32u - 8u*BYTES)) << (8u*LANE);
+        HostCRC0.*REG = (HostCRC0.*REG & ~mask) | ((value << (8u*LANE)) & mask);
+        return *this;
+    }
+    operator uint32_t() const{
+        return (HostCRC0.*REG >> (8u*LANE)) & (0xFFFFFFFFu >> (32u - 8u*BYTES));
+    }
+};
+
+typedef struct{
+    HostCRC0Data<0u, 4u> DATA;
+    struct{
+        HostCRC0Data<0u, 2u> DATAL;
+        HostCRC0Data<2u, 2u> DATAH;
+    }ACCESS16BIT;
+    struct{
+        HostCRC0Data<0u, 1u> DATALL;
+        HostCRC0Data<1u, 1u> DATALU;
+        HostCRC0Data<2u, 1u> DATAHL;
+        HostCRC0Data<3u, 1u> DATAHU;
+    }ACCESS8BIT;
+    HostCRC0Reg<&HOST_CRC0::gpoly, 0u, 4u> GPOLY;
+    struct{
+        HostCRC0Reg<&HOST_CRC0::gpoly, 0u, 2u> GPOLYL;
+        HostCRC0Reg<&HOST_CRC0::gpoly, 2u, 2u> GPOLYH;
+    }GPOLY_ACCESS16BIT;
+    HostCRC0Reg<&HOST_CRC0::ctrl, 0u, 4u> CTRL;
+}HOST_CRC0_REGS;
+
+extern HOST_CRC0_REGS HostCRC0Regs;
+extern SIM_Type HostSIM;
+
+#undef CRC0
+#define CRC0    (&HostCRC0Regs)
+#undef SIM
+#define SIM     (&HostSIM)
+
+#endif
+
+#endif
@@ -0,0 +1,20 @@
+/*****************************************************************************************
+* cpu.h - Host CRC0 model
+* The host port's cpu.h with a pointer sized CPU_ADDR. C++ does not allow a pointer to
+* be cast to the target's 32 bit CPU_ADDR, which MemoryTools.c does for its alignment
+* tests.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_CRC0_CPU_H
+#define HOST_CRC0_CPU_H
+
+#include <stdint.h>
+
+#define CPU_ADDR        HOST_CPU_ADDR_TARGET
+#include "../cpu.h"
+#undef CPU_ADDR
+
+typedef uintptr_t CPU_ADDR;
+
+#endif
@@ -0,0 +1,72 @@
+/*****************************************************************************************
+* crc0.cpp - Host CRC0 model, see MK65F18.h here
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include "MK65F18.h"
+
+HOST_CRC0 HostCRC0;
+HOST_CRC0_REGS HostCRC0Regs;
+SIM_Type HostSIM;
+
+/* Reverses the bits of each byte and/or the byte order of a bytes wide value */
+static uint32_t hostCRC0Transpose(uint32_t value, unsigned bytes, uint32_t tot){
+    uint32_t out = 0u;
+    uint32_t byte;
+    uint32_t rev;
+    unsigned i;
+    unsigned bit;
+    for(i = 0; i < bytes; i++){
+        byte = (value >> (8u*i)) & 0xFFu;
+        if((tot == 1u) || (tot == 2u)){
+            rev = 0u;
+            for(bit = 0; bit < 8u; bit++){
+                rev |= ((byte >> bit) & 1u) << (7u - bit);
+            }
+            byte = rev;
+        }else{
+        }
+        out |= byte << (8u*((tot >= 2u) ? (bytes - 1u - i) : i));
+    }
+    return out;
+}
+
+static unsigned hostCRC0Width(void){
+    return ((HostCRC0.ctrl & CRC_CTRL_TCRC_MASK) != 0u) ? 32u : 16u;
+}
+
+void HostCRC0Write(unsigned lane, unsigned bytes, uint32_t value){
+    uint32_t tot = (HostCRC0.ctrl & CRC_CTRL_TOT_MASK) >> CRC_CTRL_TOT_SHIFT;
+    unsigned width = hostCRC0Width();
+    uint32_t mask = 0xFFFFFFFFu >> (32u - width);
+    uint32_t poly = HostCRC0.gpoly & mask;
+    uint32_t lanes;
+    uint32_t top;
+    int bit;
+    value = hostCRC0Transpose(value & (0xFFFFFFFFu >> (32u - 8u*bytes)), bytes, tot);
+    if((HostCRC0.ctrl & CRC_CTRL_WAS_MASK) != 0u){
+        lanes = (0xFFFFFFFFu >> (32u - 8u*bytes)) << (8u*lane);
+        HostCRC0.crc = (HostCRC0.crc & ~lanes) | (value << (8u*lane));
+    }else{
+        HostCRC0.writeCtr[bytes]++;
+        for(bit = (int)(8u*bytes) - 1; bit >= 0; bit--){
+            top = ((HostCRC0.crc >> (width - 1u)) ^ (value >> bit)) & 1u;
+            HostCRC0.crc = (HostCRC0.crc << 1) & mask;
+            if(top != 0u){
+                HostCRC0.crc ^= poly;
+            }else{
+            }
+        }
+    }
+}
+
+uint32_t HostCRC0Read(void){
+    uint32_t totr = (HostCRC0.ctrl & CRC_CTRL_TOTR_MASK) >> CRC_CTRL_TOTR_SHIFT;
+    unsigned width = hostCRC0Width();
+    uint32_t crc = HostCRC0.crc & (0xFFFFFFFFu >> (32u - width));
+    if((HostCRC0.ctrl & CRC_CTRL_FXOR_MASK) != 0u){
+        crc ^= 0xFFFFFFFFu >> (32u - width);
+    }else{
+    }
+    return hostCRC0Transpose(crc, width/8u, totr);
+}
@@ -0,0 +1,19 @@
+/*****************************************************************************************
+* app_cfg.h - lcdtest1x16
+* The application's configuration with a true single line 1x16 panel, one DD RAM line
+* of 80 characters in one line mode.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_LCD_1X16_APP_CFG_H
+#define HOST_LCD_1X16_APP_CFG_H
+
+#include "../../../uCOS/uC-CFG/app_cfg.h"
+
+#undef APP_CFG_LCD_ROWS
+#undef APP_CFG_LCD_COLS
+
+#define APP_CFG_LCD_ROWS                 1u
+#define APP_CFG_LCD_COLS                 16u
+
+#endif
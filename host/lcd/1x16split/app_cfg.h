@@ -0,0 +1,22 @@
+/*****************************************************************************************
+* app_cfg.h - lcdtest1x16split
+* The application's configuration with a 1x16 panel addressed as 2x8, columns 9-16 at
+* DD RAM 0x40, so the test covers the jump between the halves and the marquee without
+* the display shift.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_LCD_1X16SPLIT_APP_CFG_H
+#define HOST_LCD_1X16SPLIT_APP_CFG_H
+
+#include "../../../uCOS/uC-CFG/app_cfg.h"
+
+#undef APP_CFG_LCD_ROWS
+#undef APP_CFG_LCD_COLS
+#undef APP_CFG_LCD_1X16_SPLIT
+
+#define APP_CFG_LCD_ROWS                 1u
+#define APP_CFG_LCD_COLS                 16u
+#define APP_CFG_LCD_1X16_SPLIT           1u
+
+#endif
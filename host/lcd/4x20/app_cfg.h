@@ -0,0 +1,20 @@
+/*****************************************************************************************
+* app_cfg.h - lcdtest4x20
+* The application's configuration with a 4x20 panel and layers wider than it, so the
+* test covers rows 3 and 4, the viewport and the marquee without the display shift.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_LCD_4X20_APP_CFG_H
+#define HOST_LCD_4X20_APP_CFG_H
+
+#include "../../../uCOS/uC-CFG/app_cfg.h"
+
+#undef APP_CFG_LCD_ROWS
+#undef APP_CFG_LCD_COLS
+
+#define APP_CFG_LCD_ROWS                 4u
+#define APP_CFG_LCD_COLS                 20u
+#define APP_CFG_LCD_LAYER_COLS           24u
+
+#endif
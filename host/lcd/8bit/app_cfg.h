@@ -0,0 +1,18 @@
+/*****************************************************************************************
+* app_cfg.h - lcdtest8bit
+* The application's configuration with the 8 bit bus and the busy flag polled.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_LCD_8BIT_APP_CFG_H
+#define HOST_LCD_8BIT_APP_CFG_H
+
+#include "../../../uCOS/uC-CFG/app_cfg.h"
+
+#undef APP_CFG_LCD_BUS_8BIT
+#undef APP_CFG_LCD_BUSY_POLL
+
+#define APP_CFG_LCD_BUS_8BIT             1u
+#define APP_CFG_LCD_BUSY_POLL            1u
+
+#endif
@@ -0,0 +1,135 @@
+/*****************************************************************************************
+* MK65F18.h - Host LCD model
+* The device header with GPIOD, the LCD bus, replaced by a model of an HD44780 panel, so
+* LcdLayered.c runs unmodified. As for the CRC0 model in ../crc0, a store can not be
+* caught in C, so GPIOD is a C++ proxy and the programs that use it build LcdLayered.c
+* as C++. The other ports it touches and SIM are plain memory.
+*
+* The panel latches DB4-DB7 (PTD3-PTD6), and DB0-DB3 (PTD7-PTD10) in 8 bit mode, with RS
+* (PTD1) on each falling edge of E (PTD2). It starts in 8 bit mode, function set
+* switches the width. It keeps the DD RAM, the address counter and the display shift,
+* executes the commands LcdLayered.c sends and counts the writes.
+* With R/W (PTD0) high a strobe is a read, of two nibbles in 4 bit mode. After each
+* instruction the busy flag, DB7 of the first nibble read, stays set for
+* HOST_LCD_BUSY_READS reads. A write before a read has seen it clear is counted in
+* busyWrites, which only means something when the driver polls. A write with DB4-DB7
+* not outputs, or a read with DB7 driven, is counted in busErrors.
+* A program testing a 1x16 panel wired as 2x8 sets split, the right half of the panel
+* then shows the start of the second DD RAM line.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_LCD_MK65F18_H
+#define HOST_LCD_MK65F18_H
+
+#include "../../device/MK65F18.h"
+
+#ifdef __cplusplus
+
+#define HOST_LCD_DDRAM      0x80u
+#define HOST_LCD_LINE2      0x40u
+#define HOST_LCD_BUSY_READS 2u
+
+typedef struct{
+    uint32_t pdor;
+    uint32_t pddr;
+    unsigned char ddram[HOST_LCD_DDRAM];
+    unsigned ac;                        /* Address counter                              */
+    int shift;                          /* Display shift, +1 per shift left             */
+    int bus8;                           /* Interface width from the last function set   */
+    int lines2;                         /* N bit of the last function set               */
+    int nibble;                         /* High nibble latched, waiting for the low one */
+    unsigned char high;
+    int dispOn;
+    int cursorOn;
+    int blinkOn;
+    unsigned long dataWrites;           /* Data writes to DD RAM                        */
+    unsigned long lineWrites[2];        /* Data writes to each DD RAM line              */
+    unsigned long lineSets[2];          /* DD RAM addresses set in each line            */
+    unsigned long cmdWrites;            /* Commands, other than the reset sequence      */
+    unsigned long shiftCmds;            /* Display shifts                               */
+    unsigned busy;                      /* Reads left with the busy flag set            */
+    unsigned long busyReads;            /* Busy flag reads                              */
+    unsigned long busyWrites;           /* Writes while busy                            */
+    unsigned long busErrors;            /* Strobes with the data bus the wrong way      */
+    int split;                          /* Set for a 1x16 panel wired as 2x8            */
+}HOST_LCD;
+
+extern HOST_LCD HostLcd;
+
+void HostLcdPort(uint32_t pdor);
+uint32_t HostLcdPdir(void);
+char HostLcdChar(unsigned row, unsigned col, unsigned cols);
+
+/* Port data output, PDOR written whole, PSOR and PCOR as set and clear masks */
+template<int OP> struct HostLcdPortReg{
+    HostLcdPortReg &operator=(uint32_t value){
+        HostLcdPort((OP == 0) ? value : (OP > 0) ? (HostLcd.pdor | value) : (HostLcd.pdor & ~value));
+        return *this;
+    }
+    operator uint32_t() const{
+        return HostLcd.pdor;
+    }
+};
+
+/* Port data input, DB7 is the busy flag during a read */
+struct HostLcdPdirReg{
+    operator uint32_t() const{
+        return HostLcdPdir();
+    }
+};
+
+/* Plain register, for PDDR */
+struct HostLcdReg{
+    uint32_t *reg;
+    HostLcdReg &operator=(uint32_t value){
+        *reg = value;
+        return *this;
+    }
+    HostLcdReg &operator|=(uint32_t value){
+        *reg |= value;
+        return *this;
+    }
+    HostLcdReg &operator&=(uint32_t value){
+        *reg &= value;
+        return *this;
+    }
+    operator uint32_t() const{
+        return *reg;
+    }
+};
+
+typedef struct{
+    HostLcdPortReg<0> PDOR;
+    HostLcdPortReg<1> PSOR;
+    HostLcdPortReg<-1> PCOR;
+    HostLcdPdirReg PDIR;
+    HostLcdReg PDDR;
+}HOST_LCD_GPIO;
+
+extern HOST_LCD_GPIO HostGPIOD;
+extern GPIO_Type HostGPIOA;
+extern GPIO_Type HostGPIOB;
+extern GPIO_Type HostGPIOC;
+extern PORT_Type HostPORTA;
+extern PORT_Type HostPORTD;
+extern SIM_Type HostSIM;
+
+#undef GPIOA
+#define GPIOA   (&HostGPIOA)
+#undef GPIOB
+#define GPIOB   (&HostGPIOB)
+#undef GPIOC
+#define GPIOC   (&HostGPIOC)
+#undef GPIOD
+#define GPIOD   (&HostGPIOD)
+#undef PORTA
+#define PORTA   (&HostPORTA)
+#undef PORTD
+#define PORTD   (&HostPORTD)
+#undef SIM
+#define SIM     (&HostSIM)
+
+#endif
+
+#endif
@@ -0,0 +1,156 @@
+/*****************************************************************************************
+* lcd.cpp - Host LCD model, see MK65F18.h here
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <string.h>
+#include "MK65F18.h"
+
+#define HOST_LCD_RW         0x1u
+#define HOST_LCD_RS         0x2u
+#define HOST_LCD_E          0x4u
+#define HOST_LCD_LINE       40u                 /* DD RAM line in two line mode         */
+#define HOST_LCD_DB4_7      0x78u
+#define HOST_LCD_DB7        0x40u
+
+HOST_LCD HostLcd = {0u, 0u, {0u}, 0u, 0, 1};     /* Powers up in 8 bit mode      */
+HOST_LCD_GPIO HostGPIOD = {{}, {}, {}, {}, {&HostLcd.pddr}};
+GPIO_Type HostGPIOA;
+GPIO_Type HostGPIOB;
+GPIO_Type HostGPIOC;
+PORT_Type HostPORTA;
+PORT_Type HostPORTD;
+SIM_Type HostSIM;
+
+static void hostLcdAdvance(void){
+    if(HostLcd.lines2 == 0){
+        HostLcd.ac = (HostLcd.ac + 1u) % (2u*HOST_LCD_LINE);
+    }else if(HostLcd.ac == (HOST_LCD_LINE - 1u)){
+        HostLcd.ac = HOST_LCD_LINE2;
+    }else if(HostLcd.ac == (HOST_LCD_LINE2 + HOST_LCD_LINE - 1u)){
+        HostLcd.ac = 0u;
+    }else{
+        HostLcd.ac++;
+    }
+}
+
+static void hostLcdExec(int rs, unsigned char byte){
+    if(HostLcd.busy != 0u){
+        HostLcd.busyWrites++;
+    }else{
+    }
+    HostLcd.busy = HOST_LCD_BUSY_READS;
+    if(rs){
+        HostLcd.ddram[HostLcd.ac] = byte;
+        HostLcd.dataWrites++;
+        HostLcd.lineWrites[(HostLcd.ac >= HOST_LCD_LINE2) ? 1 : 0]++;
+        hostLcdAdvance();
+        return;
+    }else{
+    }
+    HostLcd.cmdWrites++;
+    if((byte & 0x80u) != 0u){                   /* Set DD RAM address                   */
+        HostLcd.ac = byte & 0x7Fu;
+        HostLcd.lineSets[(HostLcd.ac >= HOST_LCD_LINE2) ? 1 : 0]++;
+    }else if((byte & 0x40u) != 0u){             /* Set CG RAM address, not modelled     */
+    }else if((byte & 0x20u) != 0u){             /* Function set                         */
+        HostLcd.bus8 = ((byte & 0x10u) != 0u);
+        HostLcd.lines2 = ((byte & 0x08u) != 0u);
+        HostLcd.nibble = 0;
+    }else if((byte & 0x10u) != 0u){             /* Cursor or display shift              */
+        if((byte & 0x08u) != 0u){
+            HostLcd.shift += ((byte & 0x04u) != 0u) ? -1 : 1;
+            HostLcd.shiftCmds++;
+        }else{
+            HostLcd.ac = (HostLcd.ac + (((byte & 0x04u) != 0u) ? 1u : 0x7Fu)) & 0x7Fu;
+        }
+    }else if((byte & 0x08u) != 0u){             /* Display on/off control               */
+        HostLcd.dispOn = ((byte & 0x04u) != 0u);
+        HostLcd.cursorOn = ((byte & 0x02u) != 0u);
+        HostLcd.blinkOn = ((byte & 0x01u) != 0u);
+    }else if((byte & 0x04u) != 0u){             /* Entry mode, increment assumed        */
+    }else if((byte & 0x02u) != 0u){             /* Return home                          */
+        HostLcd.ac = 0u;
+        HostLcd.shift = 0;
+    }else if((byte & 0x01u) != 0u){             /* Clear display                        */
+        memset(HostLcd.ddram, ' ', sizeof(HostLcd.ddram));
+        HostLcd.ac = 0u;
+        HostLcd.shift = 0;
+    }else{
+    }
+}
+
+void HostLcdPort(uint32_t pdor){
+    uint32_t old = HostLcd.pdor;
+    unsigned char high = (unsigned char)((pdor >> 3) & 0xFu);
+    unsigned char low = (unsigned char)((pdor >> 7) & 0xFu);
+    int rs = ((pdor & HOST_LCD_RS) != 0u);
+    HostLcd.pdor = pdor;
+    if(((old & HOST_LCD_E) == 0u) || ((pdor & HOST_LCD_E) != 0u)){
+        return;                                 /* Not a falling edge of E              */
+    }else{
+    }
+    if((pdor & HOST_LCD_RW) != 0u){             /* Read, busy flag and address          */
+        if((HostLcd.pddr & HOST_LCD_DB7) != 0u){
+            HostLcd.busErrors++;
+        }else{
+        }
+        if((HostLcd.bus8 == 0) && (HostLcd.nibble == 0)){
+            HostLcd.nibble = 1;
+            return;
+        }else{
+        }
+        HostLcd.nibble = 0;
+        HostLcd.busyReads++;
+        if(HostLcd.busy != 0u){
+            HostLcd.busy--;
+        }else{
+        }
+        return;
+    }else{
+    }
+    if((HostLcd.pddr & HOST_LCD_DB4_7) != HOST_LCD_DB4_7){
+        HostLcd.busErrors++;
+    }else{
+    }
+    if(HostLcd.bus8){
+        hostLcdExec(rs, (unsigned char)((high << 4) | low));
+    }else if(HostLcd.nibble == 0){
+        HostLcd.high = high;
+        HostLcd.nibble = 1;
+    }else{
+        HostLcd.nibble = 0;
+        hostLcdExec(rs, (unsigned char)((HostLcd.high << 4) | high));
+    }
+}
+
+/* DB7 reads the busy flag while E is high on the first nibble of a read */
+uint32_t HostLcdPdir(void){
+    if(((HostLcd.pdor & (HOST_LCD_RW | HOST_LCD_E)) == (HOST_LCD_RW | HOST_LCD_E)) &&
+       (HostLcd.nibble == 0) && (HostLcd.busy != 0u)){
+        return HOST_LCD_DB7;
+    }else{
+        return 0u;
+    }
+}
+
+/* The character shown at panel row and col, from 0, of a panel cols wide. Rows 3 and 4
+ * continue the DD RAM lines of rows 1 and 2. A split panel shows line 2 on its right
+ * half. */
+char HostLcdChar(unsigned row, unsigned col, unsigned cols){
+    int pos;
+    if((HostLcd.split != 0) && (col >= cols/2u)){
+        row = 1u;
+        col = col - cols/2u;
+    }else{
+    }
+    if(HostLcd.lines2 == 0){
+        pos = ((int)col + HostLcd.shift) % (int)(2u*HOST_LCD_LINE);
+        pos = (pos < 0) ? (pos + (int)(2u*HOST_LCD_LINE)) : pos;
+        return (char)HostLcd.ddram[pos];
+    }else{
+    }
+    pos = ((int)(col + ((row >= 2u) ? cols : 0u)) + HostLcd.shift) % (int)HOST_LCD_LINE;
+    pos = (pos < 0) ? (pos + (int)HOST_LCD_LINE) : pos;
+    return (char)HostLcd.ddram[(((row & 1u) != 0u) ? HOST_LCD_LINE2 : 0u) + (unsigned)pos];
+}
@@ -0,0 +1,16 @@
+/*****************************************************************************************
+* app_cfg.h - lcdtestpoll
+* The application's configuration with the busy flag polled on the 4 bit bus.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_LCD_POLL_APP_CFG_H
+#define HOST_LCD_POLL_APP_CFG_H
+
+#include "../../../uCOS/uC-CFG/app_cfg.h"
+
+#undef APP_CFG_LCD_BUSY_POLL
+
+#define APP_CFG_LCD_BUSY_POLL            1u
+
+#endif
@@ -0,0 +1,37 @@
+/*****************************************************************************************
+* os_cfg.h - Host port
+* Uses the application's kernel configuration and turns on the optional kernel features
+* that the firmware ships disabled, so the host programs build and exercise them.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_OS_CFG_H
+#define HOST_OS_CFG_H
+
+#include "../uCOS/uC-CFG/os_cfg.h"
+
+#undef OS_CFG_ISR_POST_DEFERRED_EN
+#undef OS_CFG_SCHED_EDF_EN
+#undef OS_CFG_MUTEX_FAST_EN
+#undef OS_CFG_MUTEX_PCP_EN
+#undef OS_CFG_Q_BATCH_EN
+#undef OS_CFG_SEM_BATCH_EN
+#undef OS_CFG_TASK_Q_BATCH_EN
+#undef OS_CFG_RING_EN
+#undef OS_CFG_RING_DEL_EN
+#undef OS_CFG_RWLOCK_EN
+#undef OS_CFG_RWLOCK_DEL_EN
+
+#define OS_CFG_ISR_POST_DEFERRED_EN     DEF_ENABLED
+#define OS_CFG_SCHED_EDF_EN             DEF_ENABLED
+#define OS_CFG_MUTEX_FAST_EN            DEF_ENABLED
+#define OS_CFG_MUTEX_PCP_EN             DEF_ENABLED
+#define OS_CFG_Q_BATCH_EN               DEF_ENABLED
+#define OS_CFG_SEM_BATCH_EN             DEF_ENABLED
+#define OS_CFG_TASK_Q_BATCH_EN          DEF_ENABLED
+#define OS_CFG_RING_EN                  DEF_ENABLED
+#define OS_CFG_RING_DEL_EN              DEF_ENABLED
+#define OS_CFG_RWLOCK_EN                DEF_ENABLED
+#define OS_CFG_RWLOCK_DEL_EN            DEF_ENABLED
+
+#endif
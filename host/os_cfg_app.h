@@ -0,0 +1,16 @@
+/*****************************************************************************************
+* os_cfg_app.h - Host port
+* Uses the target's application configuration with a larger message pool, so the batch
+* and ring benchmarks can queue a full burst on several queues at once.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_OS_CFG_APP_H
+#define HOST_OS_CFG_APP_H
+
+#include "../uCOS/uC-CFG/os_cfg_app.h"
+
+#undef OS_CFG_MSG_POOL_SIZE
+#define OS_CFG_MSG_POOL_SIZE    512u
+
+#endif
@@ -0,0 +1,66 @@
+/*****************************************************************************************
+* os_cpu.h - Host port
+* Runs the unmodified uC/OS-III sources as a single Linux process so the kernel objects
+* can be tested and benchmarked without the K65 board. Tasks run on ucontext stacks and
+* switch with swapcontext(). There are no interrupts, so a critical section is only
+* counted, see os_cpu_c.c.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef OS_CPU_H
+#define OS_CPU_H
+
+#define OS_TASK_SW()            OSCtxSw()
+
+#define OS_TASK_SW_SYNC()       __sync_synchronize()
+
+/*****************************************************************************************
+* Atomic compare and swap, used by the deferred ISR post queue and OS_RWLOCK.
+*****************************************************************************************/
+#define OS_CPU_CAS32(p_val, old_val, new_val)  __sync_bool_compare_and_swap((p_val), (old_val), (new_val))
+
+/*****************************************************************************************
+* Exclusive load and store, used by the OS_MUTEX fast path.
+* A task is only switched out inside OSSched(), never between the load and the store, so
+* a plain load and a compare before the store behave like LDREX/STREX here. Both are
+* plain accesses, which is also what they cost on the Cortex-M4.
+*****************************************************************************************/
+static __thread void *hostExclPtr;
+
+static __inline void *OS_CPU_LdrexPtr(void *volatile *pp_val){
+    hostExclPtr = *pp_val;
+    __asm__ __volatile__ ("" : : : "memory");
+    return hostExclPtr;
+}
+
+static __inline CPU_INT32U OS_CPU_StrexPtr(void *volatile *pp_val, void *p_new){
+    if(*pp_val != hostExclPtr){
+        return 0u;
+    }
+    *pp_val = p_new;
+    return 1u;
+}
+
+#define OS_CPU_LDREX_PTR(pp_val)         OS_CPU_LdrexPtr((void *volatile *)(pp_val))
+#define OS_CPU_STREX_PTR(pp_val, p_new)  OS_CPU_StrexPtr((void *volatile *)(pp_val), (void *)(p_new))
+#define OS_CPU_CLREX()                   __asm__ __volatile__ ("" : : : "memory")
+
+#if OS_CFG_TS_EN == 1u
+#define OS_TS_GET()             (CPU_TS)CPU_TS_TmrRd()
+#else
+#define OS_TS_GET()             (CPU_TS)0u
+#endif
+
+/*****************************************************************************************
+* Counters for the benchmarks: context switches and critical sections entered.
+* HostIdleHookPtr, when set, is called from the idle task instead of exiting.
+*****************************************************************************************/
+extern void (*HostIdleHookPtr)(void);
+extern unsigned long HostCtxSwCtr;
+extern unsigned long HostCritSectCtr;
+
+void OSCtxSw(void);
+void OSIntCtxSw(void);
+void OSStartHighRdy(void);
+
+#endif
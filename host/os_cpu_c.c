@@ -0,0 +1,186 @@
+/*****************************************************************************************
+* os_cpu_c.c - Host port
+* Each task gets a ucontext with its own malloc'd stack; the CPU_STK array passed to
+* OSTaskCreate() is only used by the kernel for its stack checks. A task created again
+* on the TCB of a deleted one takes over its context and stack. OSCtxSw() and
+* OSIntCtxSw() swap to OSTCBHighRdyPtr. Nothing preempts a task, so CPU_SR_Save() and
+* CPU_SR_Restore() only count critical sections.
+* Reaching the idle task means every task blocked. A program that keeps virtual time sets
+* HostIdleHookPtr to advance it, otherwise the idle hook exits with status 4.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+#include "os.h"
+
+#define HOST_TASKS_MAX      32
+#define HOST_STK_BYTES      (256*1024)
+
+typedef struct{
+    OS_TCB *tcb;
+    ucontext_t ctx;
+    OS_TASK_PTR task;
+    void *arg;
+}HOST_TASK;
+
+static HOST_TASK hostTaskTbl[HOST_TASKS_MAX];
+static int hostTaskCnt;
+static OS_TASK_PTR hostNewTask;
+static void *hostNewArg;
+static ucontext_t hostMainCtx;
+
+void (*HostIdleHookPtr)(void);
+unsigned long HostCtxSwCtr;
+unsigned long HostCritSectCtr;
+
+static ucontext_t *hostCtx(OS_TCB *p_tcb);
+static void hostTaskEntry(int idx);
+
+/*****************************************************************************************
+* CPU and context switch functions, see cpu_a.asm and os_cpu_a.asm on the target.
+*****************************************************************************************/
+CPU_SR CPU_SR_Save(void){
+    HostCritSectCtr++;
+    return 0u;
+}
+
+void CPU_SR_Restore(CPU_SR cpu_sr){
+    (void)cpu_sr;
+}
+
+CPU_DATA CPU_CntLeadZeros(CPU_DATA val){
+    return (val != 0u) ? (CPU_DATA)__builtin_clz(val) : 32u;
+}
+
+CPU_DATA CPU_CntTrailZeros(CPU_DATA val){
+    return (val != 0u) ? (CPU_DATA)__builtin_ctz(val) : 32u;
+}
+
+void OSCtxSw(void){
+    OS_TCB *from = OSTCBCurPtr;
+    OSTCBCurPtr = OSTCBHighRdyPtr;
+    OSPrioCur = OSPrioHighRdy;
+    HostCtxSwCtr++;
+    (void)swapcontext(hostCtx(from), hostCtx(OSTCBCurPtr));
+}
+
+void OSIntCtxSw(void){
+    OSCtxSw();
+}
+
+void OSStartHighRdy(void){
+    OSTCBCurPtr = OSTCBHighRdyPtr;
+    OSPrioCur = OSPrioHighRdy;
+    (void)swapcontext(&hostMainCtx, hostCtx(OSTCBCurPtr));
+}
+
+/*****************************************************************************************
+* OSTaskStkInit
+* Records the task and argument for OSTaskCreateHook(), which runs once the TCB is set up.
+*****************************************************************************************/
+CPU_STK *OSTaskStkInit(OS_TASK_PTR p_task, void *p_arg, CPU_STK *p_stk_base,
+                       CPU_STK *p_stk_limit, CPU_STK_SIZE stk_size, OS_OPT opt){
+    (void)p_stk_limit;
+    (void)opt;
+    hostNewTask = p_task;
+    hostNewArg = p_arg;
+    return &p_stk_base[stk_size - 1u];
+}
+
+/*****************************************************************************************
+* Hooks
+*****************************************************************************************/
+void OSTaskCreateHook(OS_TCB *p_tcb){
+    HOST_TASK *p_task;
+    void *stk = (void *)0;
+    int idx;
+    for(idx = 0; (idx < hostTaskCnt) && (hostTaskTbl[idx].tcb != p_tcb); idx++){
+    }
+    if(idx < hostTaskCnt){
+        stk = hostTaskTbl[idx].ctx.uc_stack.ss_sp;      /* A deleted task's TCB reused  */
+    }else if(hostTaskCnt >= HOST_TASKS_MAX){
+        fprintf(stderr, "host: too many tasks\n");
+        exit(2);
+    }else{
+        stk = malloc(HOST_STK_BYTES);
+        hostTaskCnt++;
+    }
+    p_task = &hostTaskTbl[idx];
+    p_task->tcb = p_tcb;
+    p_task->task = hostNewTask;
+    p_task->arg = hostNewArg;
+    (void)getcontext(&p_task->ctx);
+    p_task->ctx.uc_stack.ss_sp = stk;
+    p_task->ctx.uc_stack.ss_size = HOST_STK_BYTES;
+    p_task->ctx.uc_link = (ucontext_t *)0;
+    makecontext(&p_task->ctx, (void (*)(void))hostTaskEntry, 1, idx);
+}
+
+void OSIdleTaskHook(void){
+    if(HostIdleHookPtr != (void (*)(void))0){
+        HostIdleHookPtr();
+        return;
+    }else{
+    }
+    fprintf(stderr, "host: idle reached\n");
+    exit(4);
+}
+
+void OSInitHook(void){
+}
+
+void OSRedzoneHitHook(OS_TCB *p_tcb){
+    (void)p_tcb;
+}
+
+void OSStatTaskHook(void){
+}
+
+void OSTaskDelHook(OS_TCB *p_tcb){
+    (void)p_tcb;
+}
+
+void OSTaskReturnHook(OS_TCB *p_tcb){
+    (void)p_tcb;
+}
+
+void OSTaskSwHook(void){
+}
+
+void OSTimeTickHook(void){
+}
+
+/*****************************************************************************************
+* Tick source for OS_CFG_DYN_TICK_EN builds. There is no timer, so the tick only advances
+* when a test calls OSTimeTick().
+*****************************************************************************************/
+OS_TICK BSP_OS_TickGet(void){
+    return OSTickCtr;
+}
+
+OS_TICK BSP_OS_TickNextSet(OS_TICK ticks){
+    return ticks;
+}
+
+/*****************************************************************************************
+* Private functions
+*****************************************************************************************/
+static ucontext_t *hostCtx(OS_TCB *p_tcb){
+    int idx;
+    for(idx = 0; idx < hostTaskCnt; idx++){
+        if(hostTaskTbl[idx].tcb == p_tcb){
+            return &hostTaskTbl[idx].ctx;
+        }else{
+        }
+    }
+    fprintf(stderr, "host: unknown TCB\n");
+    exit(2);
+}
+
+static void hostTaskEntry(int idx){
+    hostTaskTbl[idx].task(hostTaskTbl[idx].arg);
+    fprintf(stderr, "host: task returned\n");
+    exit(3);
+}
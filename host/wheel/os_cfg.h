@@ -0,0 +1,19 @@
+/*****************************************************************************************
+* os_cfg.h - Host port, wheel configuration
+* The host configuration with the tick and timer wheels in place of the sorted tick and
+* timer lists. Used by "make wheel".
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#ifndef HOST_WHEEL_OS_CFG_H
+#define HOST_WHEEL_OS_CFG_H
+
+#include "../os_cfg.h"
+
+#undef OS_CFG_TICK_WHEEL_EN
+#undef OS_CFG_TMR_WHEEL_EN
+
+#define OS_CFG_TICK_WHEEL_EN            DEF_ENABLED
+#define OS_CFG_TMR_WHEEL_EN             DEF_ENABLED
+
+#endif
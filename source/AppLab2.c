@@ -10,10 +10,11 @@
 #include "MCUType.h"
 #include "K65TWR_ClkCfg.h"
 #include "K65TWR_GPIO.h"
-#include "MemoryTools.h"
+#include "K65TWR_OSTick.h"
 #include "uCOSKey.h"
 #include "LcdLayered.h"
 #include "SWCounter.h"
+#include "MemIntegrity.h"
 
 #define START_ADDR 0x00000000
 #define END_ADDR 0x001FFFFF
@@ -24,6 +25,13 @@
 #define TMS_CONV 10
 #define ASCII_OFFSET 48
 #define MAX_TIME 359999
+#if LCD_NUM_ROWS >= 2u                      //checksum and lap below the timer
+#define INFO_ROW LCD_ROW_2
+#define INFO_COL LCD_COL_1
+#else                                       //single row panel, right half
+#define INFO_ROW LCD_ROW_1
+#define INFO_COL LCD_COL_9
+#endif
 /*****************************************************************************************
 * Allocate task control blocks
 *****************************************************************************************/
@@ -87,13 +95,19 @@ void main(void) {
 /*****************************************************************************************
 * STARTUP TASK
 * This task runs once and is the deleted. Initializes modules, creates tasks and displays
-* initial checksum
+* initial checksum. The checksum is computed by the MemIntegrity task, this task shows
+* its progress until it completes.
 *****************************************************************************************/
 static void appStartTask(void *p_arg) {
     OS_ERR os_err;
     INT16U checksum;
+    INT8U progress;
     (void)p_arg;
+#if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    BSP_OS_TickInit();                      //tickless, LPTMR interrupts at deadlines only
+#else
     OS_CPU_SysTickInitFreq(SYSTEM_CLOCK);
+#endif
     GpioDBugBitsInit();
     OSMutexCreate(&appTimerCountKey,
                   "Timer Count Mutex",
@@ -127,9 +141,15 @@ static void appStartTask(void *p_arg) {
     SWCounterInit();
     KeyInit();
     LcdInit();
-    checksum = MemChkSum((INT8U *)START_ADDR, (INT8U *)END_ADDR);
-    LcdDispHexWord(LCD_ROW_2,LCD_COL_1,LCD_LAYER_STARTUP,(const INT32U)checksum, LCD_BYTE);
     appTimeState = CLEAR;
+    MemIntegrityInit((INT8U *)START_ADDR, (INT8U *)END_ADDR);
+    LcdDispChar(INFO_ROW,INFO_COL+3,LCD_LAYER_STARTUP,'%');
+    do{
+        progress = MemIntegrityPend(0,&os_err);
+        LcdDispDecWord(INFO_ROW,INFO_COL,LCD_LAYER_STARTUP,progress,3,LCD_DEC_MODE_AR);
+    }while(MemIntegrityResultGet(&checksum) == FALSE);
+    LcdDispClrLine(INFO_ROW,LCD_LAYER_STARTUP);
+    LcdDispHexWord(INFO_ROW,INFO_COL,LCD_LAYER_STARTUP,(const INT32U)checksum, LCD_BYTE);
     OSTaskDel((OS_TCB *)0, &os_err);
 }
 
@@ -172,7 +192,7 @@ static void appTimerControlTask(void *p_arg){
                 break;
             case '#':
                 current = appGetTimerCount();
-                LcdDispString(LCD_ROW_2,LCD_COL_1,LCD_LAYER_TIMER,(INT8C *const)current);
+                LcdDispString(INFO_ROW,INFO_COL,LCD_LAYER_TIMER,(INT8C *const)current);
                 break;
             default:
                 break;
@@ -0,0 +1,208 @@
+/*****************************************************************************************
+* MemCRCService
+* Owns the CRC0 module and runs CRC requests for any number of tasks. Each client keeps
+* its own context (polynomial and partial CRC), so a long CRC can be split over several
+* requests and interleaved with other clients. Once MemCRCServiceInit() is called CRC0
+* must only be used through this service.
+* Requests are queued to the service task's message queue. The task takes every request
+* that is waiting as one batch and only reloads the polynomial when it changes between
+* requests. Before each request the client's partial CRC is written back as the seed,
+* after it the raw CRC register is saved to the context.
+* With MEM_CRC_OPT_SW_OK a client computes the CRC itself, bit by bit, when the service
+* is busy, giving the same result as CRC0.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include "MemCRCService.h"
+#include "MCUType.h"
+#include "os.h"
+#include "app_cfg.h"
+#include "MemoryTools.h"
+/*****************************************************************************************
+* CRC0 control settings, same as MemCRCConfig(). Context switches write the seed and
+* read the raw CRC with no transpose or complement so the saved value goes back in as is.
+*****************************************************************************************/
+#define MEM_CRC_CTRL_RUN  (CRC_CTRL_TCRC(0) | CRC_CTRL_TOTR(2) | CRC_CTRL_TOT(2) | CRC_CTRL_FXOR(1))
+#define MEM_CRC_CTRL_SEED (CRC_CTRL_TCRC(0) | CRC_CTRL_WAS(1))
+#define MEM_CRC_CTRL_RAW  (CRC_CTRL_TCRC(0))
+#define MEM_CRC_MSB       0x8000u
+/*****************************************************************************************
+* Allocate task control blocks
+*****************************************************************************************/
+static OS_TCB memCRCTaskTCB;
+/*****************************************************************************************
+* Allocate task stack
+*****************************************************************************************/
+static CPU_STK memCRCTaskStk[APP_CFG_MEMCRC_TASK_STK_SIZE];
+/*****************************************************************************************
+* A request lives on the client's stack until the client's task semaphore is posted
+*****************************************************************************************/
+typedef struct{
+    MEM_CRC_CTX *ctx;
+    INT8U *start;
+    INT8U *end;
+    INT16U result;
+    OS_TCB *client;
+}MEM_CRC_REQ;
+/*****************************************************************************************
+* Service state. busy is only written by the service task.
+*****************************************************************************************/
+static INT16U memCRCPoly;
+static volatile INT8U memCRCBusy;
+/*****************************************************************************************
+* Private function prototypes
+*****************************************************************************************/
+static void memCRCTask(void *p_arg);
+static void memCRCRunHw(MEM_CRC_REQ *req);
+static INT16U memCRCRunSw(MEM_CRC_CTX *ctx, INT8U *startaddr, INT8U *endaddr);
+static INT16U memCRCOut(INT16U crc);
+static INT16U memCRCReflect(INT16U value, INT8U bits);
+/*****************************************************************************************
+* MemCRCServiceInit
+* Configures CRC0 with MemCRCConfig() and creates the service task.
+*****************************************************************************************/
+void MemCRCServiceInit(void){
+    OS_ERR os_err;
+    MemCRCConfig();
+    memCRCPoly = CRC0->GPOLY_ACCESS16BIT.GPOLYL;
+    memCRCBusy = FALSE;
+    OSTaskCreate(&memCRCTaskTCB,
+                 "memCRCTask",
+                 memCRCTask,
+                 (void *)0,
+                 APP_CFG_MEMCRC_TASK_PRIO,
+                 &memCRCTaskStk[0],
+                 APP_CFG_MEMCRC_TASK_STK_SIZE/10,
+                 APP_CFG_MEMCRC_TASK_STK_SIZE,
+                 APP_CFG_MEMCRC_Q_SIZE,
+                 0,
+                 (void *)0,
+                 OS_OPT_TASK_NONE,
+                 &os_err);
+    while(os_err != OS_ERR_NONE){
+    }
+}
+/*****************************************************************************************
+* MemCRCCtxInit
+* Starts a new CRC in ctx with polynomial poly and seed seed. The transpose and
+* complement options are the ones set by MemCRCConfig().
+*****************************************************************************************/
+void MemCRCCtxInit(MEM_CRC_CTX *ctx, INT16U poly, INT16U seed){
+    ctx->poly = poly;
+    ctx->crc = seed;
+}
+/*****************************************************************************************
+* MemCRCServiceRun
+* Adds the block startaddr to endaddr, inclusive, to the CRC in ctx. Blocks until done
+* and returns the CRC of everything added to ctx so far. Must be called from a task, the
+* calling task's semaphore is posted when the service is done. Passes pointer to error,
+* OS_ERR_Q_MAX when the service queue is full and nothing was added to ctx.
+*****************************************************************************************/
+INT16U MemCRCServiceRun(MEM_CRC_CTX *ctx, INT8U *startaddr, INT8U *endaddr, INT8U opt,
+                        OS_ERR *os_err){
+    MEM_CRC_REQ req;
+    *os_err = OS_ERR_NONE;
+    if((startaddr > endaddr) ||
+       (((opt & MEM_CRC_OPT_SW_OK) != 0) && (memCRCBusy == TRUE))){
+        req.result = memCRCRunSw(ctx, startaddr, endaddr);
+    }
+    else{
+        req.ctx = ctx;
+        req.start = startaddr;
+        req.end = endaddr;
+        req.client = OSTCBCurPtr;
+        OSTaskQPost(&memCRCTaskTCB, (void *)&req, sizeof(req), OS_OPT_POST_FIFO, os_err);
+        if(*os_err == OS_ERR_NONE){
+            (void)OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, os_err);
+        }
+        else{                                          //Queue full, ctx is unchanged
+            req.result = memCRCOut(ctx->crc);
+        }
+    }
+    return req.result;
+}
+/*****************************************************************************************
+* memCRCTask
+* Pends for a request, then serves every request already queued before pending again.
+*****************************************************************************************/
+static void memCRCTask(void *p_arg){
+    OS_ERR os_err;
+    OS_MSG_SIZE msg_size;
+    MEM_CRC_REQ *req;
+    (void)p_arg;
+    while(1){
+        req = (MEM_CRC_REQ *)OSTaskQPend(0, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &os_err);
+        memCRCBusy = TRUE;
+        while(os_err == OS_ERR_NONE){
+            memCRCRunHw(req);
+            (void)OSTaskSemPost(req->client, OS_OPT_POST_NONE, &os_err);
+            req = (MEM_CRC_REQ *)OSTaskQPend(0, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &os_err);
+        }
+        memCRCBusy = FALSE;
+    }
+}
+/*****************************************************************************************
+* memCRCRunHw
+* Loads the client context into CRC0, feeds the block and saves the context back
+*****************************************************************************************/
+static void memCRCRunHw(MEM_CRC_REQ *req){
+    if(req->ctx->poly != memCRCPoly){
+        CRC0->GPOLY_ACCESS16BIT.GPOLYL = CRC_GPOLY_LOW(req->ctx->poly);
+        memCRCPoly = req->ctx->poly;
+    }
+    else{}
+    CRC0->CTRL = MEM_CRC_CTRL_SEED;
+    CRC0->ACCESS16BIT.DATAL = req->ctx->crc;
+    CRC0->CTRL = MEM_CRC_CTRL_RUN;
+    req->result = MemCRCGet(req->start, req->end);
+    CRC0->CTRL = MEM_CRC_CTRL_RAW;
+    req->ctx->crc = CRC0->ACCESS16BIT.DATAL;
+    CRC0->CTRL = MEM_CRC_CTRL_RUN;
+}
+/*****************************************************************************************
+* memCRCRunSw
+* Software version of memCRCRunHw(). CRC0 with TOT=2 shifts each byte in bit reversed,
+* most significant bit first, and TOTR=2 with FXOR=1 reverses and complements the result.
+* A block with startaddr above endaddr adds nothing.
+*****************************************************************************************/
+static INT16U memCRCRunSw(MEM_CRC_CTX *ctx, INT8U *startaddr, INT8U *endaddr){
+    INT16U crc = ctx->crc;
+    INT8U bit;
+    INT8U done;
+    done = (startaddr > endaddr) ? TRUE : FALSE;
+    while(done == FALSE){
+        done = (startaddr == endaddr) ? TRUE : FALSE;  //endaddr is included
+        crc = crc ^ (INT16U)(memCRCReflect(*startaddr, 8) << 8);
+        for(bit = 0; bit < 8; bit++){
+            if((crc & MEM_CRC_MSB) != 0){
+                crc = (INT16U)((crc << 1) ^ ctx->poly);
+            }
+            else{
+                crc = (INT16U)(crc << 1);
+            }
+        }
+        startaddr++;
+    }
+    ctx->crc = crc;
+    return memCRCOut(crc);
+}
+/*****************************************************************************************
+* memCRCOut
+* Returns the CRC0 output for the raw CRC register crc, reversed and complemented
+*****************************************************************************************/
+static INT16U memCRCOut(INT16U crc){
+    return (INT16U)~memCRCReflect(crc, 16);
+}
+/*****************************************************************************************
+* memCRCReflect
+* Returns the low bits of value in reverse order
+*****************************************************************************************/
+static INT16U memCRCReflect(INT16U value, INT8U bits){
+    INT16U out = 0;
+    INT8U i;
+    for(i = 0; i < bits; i++){
+        out = (INT16U)((out << 1) | (value & 1u));
+        value = value >> 1;
+    }
+    return out;
+}
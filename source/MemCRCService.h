@@ -0,0 +1,56 @@
+/*****************************************************************************************
+* MemCRCService
+* Owns the CRC0 module and runs CRC requests for any number of tasks. Each client keeps
+* its own context (polynomial and partial CRC), so a long CRC can be split over several
+* requests and interleaved with other clients. Once MemCRCServiceInit() is called CRC0
+* must only be used through this service.
+*
+* Requires the following be defined in app_cfg.h:
+*                   APP_CFG_MEMCRC_TASK_PRIO
+*                   APP_CFG_MEMCRC_TASK_STK_SIZE
+*                   APP_CFG_MEMCRC_Q_SIZE
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include "MCUType.h"
+#include "os.h"
+
+#ifndef MEMCRC_DEF
+#define MEMCRC_DEF
+/*****************************************************************************************
+* Client context. crc is the running CRC register, before output transpose and
+* complement. Set up with MemCRCCtxInit(), do not change while a request is running.
+*****************************************************************************************/
+typedef struct{
+    INT16U poly;
+    INT16U crc;
+}MEM_CRC_CTX;
+/*****************************************************************************************
+* Options for MemCRCServiceRun()
+*   MEM_CRC_OPT_NONE  - Always use CRC0, waits behind queued requests
+*   MEM_CRC_OPT_SW_OK - Compute in the calling task when CRC0 is busy
+*****************************************************************************************/
+#define MEM_CRC_OPT_NONE  0u
+#define MEM_CRC_OPT_SW_OK 1u
+/*****************************************************************************************
+* MemCRCServiceInit
+* Configures CRC0 with MemCRCConfig() and creates the service task.
+*****************************************************************************************/
+void MemCRCServiceInit(void);
+/*****************************************************************************************
+* MemCRCCtxInit
+* Starts a new CRC in ctx with polynomial poly and seed seed. The transpose and
+* complement options are the ones set by MemCRCConfig().
+*****************************************************************************************/
+void MemCRCCtxInit(MEM_CRC_CTX *ctx, INT16U poly, INT16U seed);
+/*****************************************************************************************
+* MemCRCServiceRun
+* Adds the block startaddr to endaddr, inclusive, to the CRC in ctx. Blocks until done
+* and returns the CRC of everything added to ctx so far. Must be called from a task, the
+* calling task's semaphore is posted when the service is done. Passes pointer to error,
+* OS_ERR_Q_MAX when the service queue is full and nothing was added to ctx.
+*****************************************************************************************/
+INT16U MemCRCServiceRun(MEM_CRC_CTX *ctx, INT8U *startaddr, INT8U *endaddr, INT8U opt,
+                        OS_ERR *os_err);
+
+#endif
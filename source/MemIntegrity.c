@@ -0,0 +1,174 @@
+/*****************************************************************************************
+* MemIntegrity
+* A low priority service that computes the memory checksum in chunks so it does not
+* block startup. Publishes progress and the final checksum.
+* The block is summed APP_CFG_MEMINT_CHUNK_SIZE bytes at a time with MemChkSum(). A
+* smaller chunk updates progress more often, a larger chunk finishes sooner. Higher
+* priority tasks preempt the service at any point, APP_CFG_MEMINT_YIELD_TICKS also
+* lets lower priority tasks run between chunks.
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include "MemIntegrity.h"
+#include "MCUType.h"
+#include "os.h"
+#include "app_cfg.h"
+#include "MemoryTools.h"
+/*****************************************************************************************
+* Allocate task control blocks
+*****************************************************************************************/
+static OS_TCB memIntTaskTCB;
+/*****************************************************************************************
+* Allocate task stack
+*****************************************************************************************/
+static CPU_STK memIntTaskStk[APP_CFG_MEMINT_TASK_STK_SIZE];
+/*****************************************************************************************
+* Allocate Mutex
+*****************************************************************************************/
+static OS_MUTEX memIntKey;
+/*****************************************************************************************
+* Checksum state, guarded by memIntKey. flag is posted when progress changes.
+*****************************************************************************************/
+typedef struct{
+    INT8U *start;
+    INT8U *end;
+    INT8U progress;
+    INT8U complete;
+    INT16U checksum;
+    OS_SEM flag;
+}MEMINT_STATE;
+static MEMINT_STATE memIntState;
+/*****************************************************************************************
+* Private function prototypes
+*****************************************************************************************/
+static void memIntTask(void *p_arg);
+static void memIntPublish(INT8U progress, INT16U checksum);
+/*****************************************************************************************
+* MemIntegrityInit
+* Creates the checksum task for the block startaddr to endaddr, inclusive.
+*****************************************************************************************/
+void MemIntegrityInit(INT8U *startaddr, INT8U *endaddr){
+    OS_ERR os_err;
+    memIntState.start = startaddr;
+    memIntState.end = endaddr;
+    memIntState.progress = 0;
+    memIntState.complete = FALSE;
+    memIntState.checksum = 0;
+    OSSemCreate(&(memIntState.flag),"MemInt flag", 0, &os_err);
+    while(os_err != OS_ERR_NONE){
+    }
+    OSMutexCreate(&memIntKey,"MemInt mutex", &os_err);
+    while(os_err != OS_ERR_NONE){
+    }
+    OSTaskCreate(&memIntTaskTCB,
+                 "memIntTask",
+                 memIntTask,
+                 (void *)0,
+                 APP_CFG_MEMINT_TASK_PRIO,
+                 &memIntTaskStk[0],
+                 APP_CFG_MEMINT_TASK_STK_SIZE/10,
+                 APP_CFG_MEMINT_TASK_STK_SIZE,
+                 0,
+                 0,
+                 (void *)0,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &os_err);
+    while(os_err != OS_ERR_NONE){
+    }
+}
+
+/*****************************************************************************************
+* memIntTask
+* Sums the block one chunk at a time, publishing progress whenever the percentage
+* changes. Chunk sums add up to the MemChkSum() of the whole block since the sum wraps
+* at 16 bits. Deletes itself when done.
+*****************************************************************************************/
+static void memIntTask(void *p_arg){
+    OS_ERR os_err;
+    INT8U *chunk;
+    INT8U *chunk_end;
+    INT32U total;
+    INT32U done;
+    INT8U progress;
+    INT8U last_progress = 0;
+    INT16U sum = 0;
+    (void)p_arg;
+    chunk = memIntState.start;
+    total = (INT32U)(memIntState.end - memIntState.start) + 1;
+    done = 0;
+    while(done < total){
+        if((total - done) > APP_CFG_MEMINT_CHUNK_SIZE){
+            chunk_end = chunk + (APP_CFG_MEMINT_CHUNK_SIZE - 1);
+        }
+        else{
+            chunk_end = memIntState.end;
+        }
+        sum = sum + MemChkSum(chunk, chunk_end);
+        done = done + (INT32U)(chunk_end - chunk) + 1;
+        chunk = chunk_end + 1;
+        progress = (INT8U)(((INT64U)done * 100u) / total);
+        if((progress != last_progress) && (progress < 100)){
+            memIntPublish(progress, 0);
+            last_progress = progress;
+        }
+        else{}
+#if APP_CFG_MEMINT_YIELD_TICKS > 0
+        OSTimeDly(APP_CFG_MEMINT_YIELD_TICKS, OS_OPT_TIME_DLY, &os_err);
+#endif
+    }
+    memIntPublish(100, sum);
+    OSTaskDel((OS_TCB *)0, &os_err);
+}
+/*****************************************************************************************
+* memIntPublish
+* Stores progress, and the checksum when progress is 100, then signals pending tasks
+*****************************************************************************************/
+static void memIntPublish(INT8U progress, INT16U checksum){
+    OS_ERR os_err;
+    OSMutexPend(&memIntKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    memIntState.progress = progress;
+    if(progress == 100){
+        memIntState.checksum = checksum;
+        memIntState.complete = TRUE;
+    }
+    else{}
+    OSMutexPost(&memIntKey, OS_OPT_POST_NONE, &os_err);
+    OSSemPost(&(memIntState.flag), OS_OPT_POST_ALL, &os_err);
+}
+/*****************************************************************************************
+* MemIntegrityPend
+* Pends until the progress changes and returns it in percent. 100 means the checksum
+* is complete. Can use tout as timeout for pending. Passes pointer to error
+*****************************************************************************************/
+INT8U MemIntegrityPend(INT16U tout, OS_ERR *os_err){
+    OSSemPend(&(memIntState.flag), tout, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, os_err);
+    return MemIntegrityProgressGet();
+}
+/*****************************************************************************************
+* MemIntegrityProgressGet
+* Returns the progress in percent without pending
+*****************************************************************************************/
+INT8U MemIntegrityProgressGet(void){
+    OS_ERR os_err;
+    INT8U progress;
+    OSMutexPend(&memIntKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    progress = memIntState.progress;
+    OSMutexPost(&memIntKey, OS_OPT_POST_NONE, &os_err);
+    return progress;
+}
+/*****************************************************************************************
+* MemIntegrityResultGet
+* Returns TRUE and writes the checksum to *checksum when complete, FALSE otherwise
+*****************************************************************************************/
+INT8U MemIntegrityResultGet(INT16U *checksum){
+    OS_ERR os_err;
+    INT8U complete;
+    OSMutexPend(&memIntKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
+    complete = memIntState.complete;
+    if(complete == TRUE){
+        *checksum = memIntState.checksum;
+    }
+    else{}
+    OSMutexPost(&memIntKey, OS_OPT_POST_NONE, &os_err);
+    return complete;
+}
@@ -0,0 +1,41 @@
+/*****************************************************************************************
+* MemIntegrity
+* A low priority service that computes the memory checksum in chunks so it does not
+* block startup. Publishes progress and the final checksum.
+*
+* Requires the following be defined in app_cfg.h:
+*                   APP_CFG_MEMINT_TASK_PRIO
+*                   APP_CFG_MEMINT_TASK_STK_SIZE
+*                   APP_CFG_MEMINT_CHUNK_SIZE
+*                   APP_CFG_MEMINT_YIELD_TICKS
+*
+* Last edit 10/18/2026
+*****************************************************************************************/
+#include "MCUType.h"
+#include "os.h"
+
+#ifndef MEMINT_DEF
+#define MEMINT_DEF
+/*****************************************************************************************
+* MemIntegrityInit
+* Creates the checksum task for the block startaddr to endaddr, inclusive.
+*****************************************************************************************/
+void MemIntegrityInit(INT8U *startaddr, INT8U *endaddr);
+/*****************************************************************************************
+* MemIntegrityPend
+* Pends until the progress changes and returns it in percent. 100 means the checksum
+* is complete. Can use tout as timeout for pending. Passes pointer to error
+*****************************************************************************************/
+INT8U MemIntegrityPend(INT16U tout, OS_ERR *os_err);
+/*****************************************************************************************
+* MemIntegrityProgressGet
+* Returns the progress in percent without pending
+*****************************************************************************************/
+INT8U MemIntegrityProgressGet(void);
+/*****************************************************************************************
+* MemIntegrityResultGet
+* Returns TRUE and writes the checksum to *checksum when complete, FALSE otherwise
+*****************************************************************************************/
+INT8U MemIntegrityResultGet(INT16U *checksum);
+
+#endif
@@ -77,9 +77,16 @@ static void swCounterTask(void *p_arg){
     CNTRL_STATES cntrl;
     CNTRL_STATES last_state;
     (void)p_arg;
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    OSTaskEdfSet((OS_TCB *)0, APP_CFG_SWCNT_TASK_PERIOD, APP_CFG_SWCNT_TASK_DEADLINE, &os_err);
+#endif
     while(1){
         DB2_TURN_OFF();
-        OSTimeDly(10,OS_OPT_TIME_PERIODIC,&os_err);
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+        OSTaskEdfWait(&os_err);
+#else
+        OSTimeDly(APP_CFG_SWCNT_TASK_PERIOD,OS_OPT_TIME_PERIODIC,&os_err);
+#endif
         DB2_TURN_ON();
         cntrl = swCntrCntrlGet();
         if(cntrl==COUNT){
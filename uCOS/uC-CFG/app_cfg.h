@@ -52,6 +52,22 @@
 #define APP_CFG_LCD_TASK_PRIO       7u
 #define APP_CFG_KEY_TASK_PRIO       4u
 #define APP_CFG_SWCNT_TASK_PRIO     6u
+#define APP_CFG_MEMCRC_TASK_PRIO    27u
+#define APP_CFG_MEMINT_TASK_PRIO    28u
+
+/*
+*********************************************************************************************************
+*                                      PERIODIC TASK TIMING (ticks)
+*              With OS_CFG_SCHED_EDF_EN these tasks run as EDF tasks at OS_CFG_SCHED_EDF_PRIO
+*              (4, os_cfg_app.h). That is keyTask's own priority, so the keypad stays above
+*              the tick task (5). swCounterTask moves up from 6 into the same band.
+*********************************************************************************************************
+*/
+
+#define APP_CFG_KEY_TASK_PERIOD          8u
+#define APP_CFG_KEY_TASK_DEADLINE        8u
+#define APP_CFG_SWCNT_TASK_PERIOD       10u
+#define APP_CFG_SWCNT_TASK_DEADLINE     10u
 
 /*
 *********************************************************************************************************
@@ -65,5 +81,33 @@
 #define APP_CFG_LCD_TASK_STK_SIZE        128u
 #define APP_CFG_KEY_TASK_STK_SIZE        128u
 #define APP_CFG_SWCNT_TASK_STK_SIZE      128u
+#define APP_CFG_MEMCRC_TASK_STK_SIZE     128u
+#define APP_CFG_MEMINT_TASK_STK_SIZE     128u
+
+/*
+*********************************************************************************************************
+*                                        MEMORY INTEGRITY CHECK
+*********************************************************************************************************
+*/
+
+#define APP_CFG_MEMINT_CHUNK_SIZE        4096u   /* Bytes summed between progress updates            */
+#define APP_CFG_MEMINT_YIELD_TICKS       0u      /* Ticks to sleep between chunks, 0 for none        */
+
+#define APP_CFG_MEMCRC_Q_SIZE            8u      /* CRC service requests that can wait at once       */
+
+/*
+*********************************************************************************************************
+*                                            LCD GEOMETRY
+*                      Supported panels (rows x cols): 1x16, 2x16, 2x20, 4x20, 2x40
+*********************************************************************************************************
+*/
+
+#define APP_CFG_LCD_ROWS                 2u
+#define APP_CFG_LCD_COLS                 16u
+#define APP_CFG_LCD_1X16_SPLIT           0u      /* 1 for a 1x16 addressed as 2x8, cols 9-16 at 0x40 */
+
+#define APP_CFG_LCD_BUS_8BIT             0u      /* 1 for 8-bit data bus, DB0-DB3 on PTD7-PTD10      */
+#define APP_CFG_LCD_BUSY_POLL            0u      /* 1 to poll the busy flag, R/W on PTD0             */
+#define APP_CFG_LCD_FRAME_TICKS          40u     /* Min ticks between LCD frames, 0 for no limit     */
 
 #endif
@@ -42,13 +42,16 @@
 #define OS_CFG_DBG_EN                   DEF_DISABLED       /* Enable (DEF_ENABLED) debug code/variables                             */
 #define OS_CFG_DYN_TICK_EN              DEF_DISABLED       /* Enable (DEF_ENABLED) the Dynamic Tick                                 */
 #define OS_CFG_INVALID_OS_CALLS_CHK_EN  DEF_DISABLED        /* Enable (DEF_ENABLED) checks for invalid kernel calls                  */
+#define OS_CFG_ISR_POST_DEFERRED_EN     DEF_DISABLED       /* Enable (DEF_ENABLED) posts from ISRs deferred to the ISR handler task */
 #define OS_CFG_OBJ_TYPE_CHK_EN          DEF_DISABLED        /* Enable (DEF_ENABLED) object type checking                             */
 #define OS_CFG_TS_EN                    DEF_DISABLED       /* Enable (DEF_ENABLED) time stamping                                    */
 
 #define OS_CFG_PRIO_MAX                 32u                /* Defines the maximum number of task priorities (see OS_PRIO data type) */
+#define OS_CFG_PEND_LIST_BITMAP_EN      DEF_DISABLED       /* Enable (DEF_ENABLED) O(1) priority bitmap index on pend lists         */
 
 #define OS_CFG_SCHED_LOCK_TIME_MEAS_EN  DEF_DISABLED       /* Include (DEF_ENABLED) code to measure scheduler lock time             */
 #define OS_CFG_SCHED_ROUND_ROBIN_EN     DEF_ENABLED        /* Include (DEF_ENABLED) code for Round-Robin scheduling                 */
+#define OS_CFG_SCHED_EDF_EN             DEF_DISABLED       /* Include (DEF_ENABLED) code for earliest deadline first scheduling     */
 
 #define OS_CFG_STK_SIZE_MIN             64u                /* Minimum allowable task stack size                                     */
 
@@ -68,6 +71,8 @@
 #define OS_CFG_MUTEX_EN                 DEF_ENABLED        /* Enable (DEF_ENABLED) code generation for MUTEX                        */
 #define OS_CFG_MUTEX_DEL_EN             DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSMutexDel()                       */
 #define OS_CFG_MUTEX_PEND_ABORT_EN      DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSMutexPendAbort()                 */
+#define OS_CFG_MUTEX_FAST_EN            DEF_DISABLED       /*     Include (DEF_ENABLED) lock-free path for uncontended mutexes      */
+#define OS_CFG_MUTEX_PCP_EN             DEF_DISABLED       /*     Include (DEF_ENABLED) code for priority ceiling mutexes           */
 
 
                                                            /* -------------------------- MESSAGE QUEUES --------------------------  */
@@ -75,6 +80,7 @@
 #define OS_CFG_Q_DEL_EN                 DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSQDel()                           */
 #define OS_CFG_Q_FLUSH_EN               DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSQFlush()                         */
 #define OS_CFG_Q_PEND_ABORT_EN          DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSQPendAbort()                     */
+#define OS_CFG_Q_BATCH_EN               DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSQPostN() and OSQPendN()          */
 
 
                                                            /* ---------------------------- SEMAPHORES ----------------------------- */
@@ -82,6 +88,17 @@
 #define OS_CFG_SEM_DEL_EN               DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSSemDel()                         */
 #define OS_CFG_SEM_PEND_ABORT_EN        DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSSemPendAbort()                   */
 #define OS_CFG_SEM_SET_EN               DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSSemSet()                         */
+#define OS_CFG_SEM_BATCH_EN             DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSSemPostN()                       */
+
+
+                                                           /* ------------------------------- RINGS ------------------------------- */
+#define OS_CFG_RING_EN                  DEF_DISABLED       /* Enable (DEF_ENABLED) code generation for SPSC RINGS                   */
+#define OS_CFG_RING_DEL_EN              DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSRingDel()                        */
+
+
+                                                           /* ------------------------ READER-WRITER LOCKS ------------------------ */
+#define OS_CFG_RWLOCK_EN                DEF_DISABLED       /* Enable (DEF_ENABLED) code generation for READER-WRITER LOCKS          */
+#define OS_CFG_RWLOCK_DEL_EN            DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSRWLockDel()                      */
 
 
                                                            /* ----------------------------- MONITORS ------------------------------ */
@@ -98,6 +115,7 @@
 #define OS_CFG_TASK_PROFILE_EN          DEF_ENABLED       /* Include (DEF_ENABLED) variables in OS_TCB for profiling               */
 #define OS_CFG_TASK_Q_EN                DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskQXXXX()                          */
 #define OS_CFG_TASK_Q_PEND_ABORT_EN     DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskQPendAbort()                     */
+#define OS_CFG_TASK_Q_BATCH_EN          DEF_DISABLED       /* Include (DEF_ENABLED) code for OSTaskQPostN() and OSTaskQPendN()      */
 #define OS_CFG_TASK_REG_TBL_SIZE        1u                 /* Number of task specific registers                                     */
 #define OS_CFG_TASK_STK_REDZONE_EN      DEF_DISABLED       /* Enable (DEF_ENABLED) stack redzone                                    */
 #define OS_CFG_TASK_STK_REDZONE_DEPTH   8u                 /*     Depth of the stack redzone                                        */
@@ -111,15 +129,18 @@
                                                            /* ------------------------- TIME MANAGEMENT --------------------------  */
 #define OS_CFG_TIME_DLY_HMSM_EN         DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTimeDlyHMSM()                        */
 #define OS_CFG_TIME_DLY_RESUME_EN       DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTimeDlyResume()                      */
+#define OS_CFG_TICK_WHEEL_EN            DEF_DISABLED       /* Enable (DEF_ENABLED) O(1) timer wheel for delay and timeout lists     */
+#define OS_CFG_TICK_WHEEL_SIZE          32u                /*     Number of spokes in the wheel, power of 2                         */
 
                                                            /* ------------------------- TIMER MANAGEMENT -------------------------- */
 #define OS_CFG_TMR_EN                   DEF_ENABLED        /* Enable (DEF_ENABLED) code generation for TIMERS                       */
 #define OS_CFG_TMR_DEL_EN               DEF_ENABLED        /* Enable (DEF_ENABLED) code generation for OSTmrDel()                   */
+#define OS_CFG_TMR_WHEEL_EN             DEF_DISABLED       /* Enable (DEF_ENABLED) timer wheel, only expiring timers are visited    */
+#define OS_CFG_TMR_WHEEL_SIZE           64u                /*     Number of spokes in the wheel, power of 2                         */
 
                                                            /* ------------------------- TRACE RECORDER ---------------------------- */
 #define OS_CFG_TRACE_EN                 DEF_DISABLED       /* Enable (DEF_ENABLED) uC/OS-III Trace instrumentation                  */
 #define OS_CFG_TRACE_API_ENTER_EN       DEF_DISABLED       /* Enable (DEF_ENABLED) uC/OS-III Trace API enter instrumentation        */
 #define OS_CFG_TRACE_API_EXIT_EN        DEF_DISABLED       /* Enable (DEF_ENABLED) uC/OS-III Trace API exit  instrumentation        */
 
-#define OS_CFG_ISR_POST_DEFERRED_EN     DEF_DISABLED
 #endif
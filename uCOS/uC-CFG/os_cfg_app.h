@@ -52,6 +52,16 @@
 #define  OS_CFG_IDLE_TASK_STK_SIZE                    64u       /* Stack size (number of CPU_STK elements)              */
 
 
+                                                                /* ----------------- ISR HANDLER TASK ----------------- */
+#define  OS_CFG_INT_Q_SIZE                            16u       /* Deferred ISR posts queued, power of 2                */
+#define  OS_CFG_INT_Q_TASK_PRIO                        0u       /* Priority, above every task the ISRs post to          */
+#define  OS_CFG_INT_Q_TASK_STK_SIZE                  100u       /* Stack size (number of CPU_STK elements)              */
+
+
+                                                                /* --------------- EDF SCHEDULING CLASS --------------- */
+#define  OS_CFG_SCHED_EDF_PRIO                         4u       /* Priority shared by the EDF tasks, above tick task    */
+
+
                                                                 /* ------------------ STATISTIC TASK ------------------ */
 #define  OS_CFG_STAT_TASK_PRIO  ((OS_PRIO)(OS_CFG_PRIO_MAX-2u)) /* Priority                                             */
 #define  OS_CFG_STAT_TASK_RATE_HZ                     10u       /* Rate of execution (1 to 10 Hz)                       */
@@ -39,6 +39,17 @@
 const  CPU_CHAR  *os_core__c = "$Id: $";
 #endif
 
+#if (OS_CFG_PEND_LIST_BITMAP_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_TCB  *OS_PendListPrioPrev (OS_PEND_LIST  *p_pend_list,
+                                      OS_PRIO        prio);
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                    INITIALIZATION
@@ -184,6 +195,30 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)                        /* Initialize the Priority Ceiling Mutex Manager module */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OSMutexPcpDbgListPtr = (OS_MUTEX_PCP *)0;
+    OSMutexPcpQty        =                 0u;
+#endif
+#endif
+
+
+#if (OS_CFG_RING_EN == DEF_ENABLED)                             /* Initialize the Ring Manager module                   */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OSRingDbgListPtr = (OS_RING *)0;
+    OSRingQty        =            0u;
+#endif
+#endif
+
+
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)                           /* Initialize the Reader-Writer Lock Manager module     */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OSRWLockDbgListPtr = (OS_RWLOCK *)0;
+    OSRWLockQty        =              0u;
+#endif
+#endif
+
+
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
     OS_TLS_Init(p_err);                                         /* Initialize Task Local Storage, before creating tasks */
     if (*p_err != OS_ERR_NONE) {
@@ -214,6 +249,14 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    OS_IntQTaskInit(p_err);                                     /* Initialize the ISR Handler Task                      */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+
 #if (OS_CFG_STAT_TASK_EN == DEF_ENABLED)                        /* Initialize the Statistic Task                        */
     OS_StatTaskInit(p_err);
     if (*p_err != OS_ERR_NONE) {
@@ -715,7 +758,8 @@ void  OSSchedRoundRobinCfg (CPU_BOOLEAN   en,
 * Argument(s): p_err      is a pointer to a variable that will contain an error code returned by this function.
 *
 *                             OS_ERR_NONE                   The call was successful
-*                             OS_ERR_ROUND_ROBIN_1          Only 1 task at this priority, nothing to yield to
+*                             OS_ERR_ROUND_ROBIN_1          Only 1 task at this priority, nothing to yield to, or
+*                                                           the task is an EDF task (OS_CFG_SCHED_EDF_PRIO)
 *                             OS_ERR_ROUND_ROBIN_DISABLED   Round Robin is not enabled
 *                             OS_ERR_SCHED_LOCKED           The scheduler has been locked
 *                             OS_ERR_YIELD_ISR              Can't be called from an ISR
@@ -766,6 +810,13 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
        *p_err = OS_ERR_ROUND_ROBIN_1;
         return;
     }
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (OSPrioCur == OS_CFG_SCHED_EDF_PRIO) {                   /* EDF tasks run in deadline order, not round-robin     */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_ROUND_ROBIN_1;
+        return;
+    }
+#endif
 
     OS_RdyListMoveHeadToTail(p_rdy_list);                       /* Move current OS_TCB to the end of the list           */
     p_tcb = p_rdy_list->HeadPtr;                                /* Point to new OS_TCB at head of the list              */
@@ -996,7 +1047,10 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
 *                                 OS_TASK_PEND_ON_FLAG
 *                                 OS_TASK_PEND_ON_TASK_Q     <- No object (pending for a message sent to the task)
 *                                 OS_TASK_PEND_ON_MUTEX
+*                                 OS_TASK_PEND_ON_MUTEX_PCP
 *                                 OS_TASK_PEND_ON_Q
+*                                 OS_TASK_PEND_ON_RWLOCK_RD
+*                                 OS_TASK_PEND_ON_RWLOCK_WR
 *                                 OS_TASK_PEND_ON_SEM
 *                                 OS_TASK_PEND_ON_TASK_SEM   <- No object (pending on a signal sent to the task)
 *
@@ -1207,6 +1261,8 @@ void  OS_PendDbgNameRemove (OS_PEND_OBJ  *p_obj,
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
 *
 *              2) It's assumed that the TCB contains the NEW priority in its .Prio field.
+*
+*              3) With OS_CFG_PEND_LIST_BITMAP_EN the removal and the re-insertion are both O(1), so is this function.
 ************************************************************************************************************************
 */
 
@@ -1218,12 +1274,19 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
     p_obj       =  p_tcb->PendObjPtr;                           /* Get pointer to pend list                             */
     p_pend_list = &p_obj->PendList;
 
+#if (OS_CFG_PEND_LIST_BITMAP_EN == DEF_ENABLED)
+    OS_PendListRemove(p_tcb);                                   /* Always move, the priority index must follow the task */
+    p_tcb->PendObjPtr = p_obj;
+    OS_PendListInsertPrio(p_pend_list,
+                          p_tcb);
+#else
     if (p_pend_list->HeadPtr->PendNextPtr != (OS_TCB *)0) {     /* Only move if multiple entries in the list            */
             OS_PendListRemove(p_tcb);                           /* Remove entry from current position                   */
             p_tcb->PendObjPtr = p_obj;
             OS_PendListInsertPrio(p_pend_list,                  /* INSERT it back in the list                           */
                                   p_tcb);
     }
+#endif
 }
 
 
@@ -1244,6 +1307,14 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
 
 void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 {
+#if (OS_CFG_PEND_LIST_BITMAP_EN == DEF_ENABLED)
+    CPU_DATA  i;
+
+
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {                   /* No priority has a waiting task                       */
+        p_pend_list->PrioTbl[i] = 0u;                           /* ... PrioTailPtr[] is only read when its bit is set   */
+    }
+#endif
     p_pend_list->HeadPtr    = (OS_TCB *)0;
     p_pend_list->TailPtr    = (OS_TCB *)0;
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -1312,9 +1383,69 @@ void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_PEND_LIST_BITMAP_EN the list is not walked.  .PrioTbl[] records which priorities have
+*                 waiting tasks and .PrioTailPtr[] the last of them, so the new OS_TCB goes right after the tail of
+*                 its own priority (FIFO among equals) or of the nearest higher priority.  The list itself keeps the
+*                 same order as without the option, so .HeadPtr is still the highest priority waiter.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_PEND_LIST_BITMAP_EN == DEF_ENABLED)
+void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
+                             OS_TCB        *p_tcb)
+{
+    OS_PRIO   prio;
+    OS_PRIO   ix;
+    CPU_DATA  bit;
+    CPU_DATA  bit_nbr;
+    OS_TCB   *p_prev;
+
+
+    prio    = p_tcb->Prio;                                      /* Obtain the priority of the task to insert            */
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    ix      = prio / (OS_PRIO)DEF_INT_CPU_NBR_BITS;
+    bit_nbr = (CPU_DATA)prio & (DEF_INT_CPU_NBR_BITS - 1u);
+#else
+    ix      = 0u;
+    bit_nbr = prio;
+#endif
+    bit     = 1u;
+    bit   <<= (DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr;
+
+    if ((p_pend_list->PrioTbl[ix] & bit) != 0u) {               /* Tasks of the same priority already waiting?          */
+        p_prev = p_pend_list->PrioTailPtr[prio];                /* Yes, insert after the last of them                   */
+    } else {
+        p_prev = OS_PendListPrioPrev(p_pend_list, prio);        /* No,  insert after the nearest higher priority        */
+        p_pend_list->PrioTbl[ix] |= bit;
+    }
+    p_pend_list->PrioTailPtr[prio] = p_tcb;
+    p_tcb->PendPrio                = prio;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_pend_list->NbrEntries++;                                  /* One more OS_TCB in the list                          */
+#endif
+
+    if (p_prev == (OS_TCB *)0) {                                /* New TCB is highest priority, insert at the head      */
+        p_tcb->PendPrevPtr = (OS_TCB *)0;
+        p_tcb->PendNextPtr =  p_pend_list->HeadPtr;
+        if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+            p_pend_list->TailPtr = p_tcb;                       /* This is the first entry                              */
+        } else {
+            p_pend_list->HeadPtr->PendPrevPtr = p_tcb;
+        }
+        p_pend_list->HeadPtr = p_tcb;
+    } else {                                                    /* Insert after 'p_prev'                                */
+        p_tcb->PendPrevPtr = p_prev;
+        p_tcb->PendNextPtr = p_prev->PendNextPtr;
+        if (p_prev->PendNextPtr == (OS_TCB *)0) {
+            p_pend_list->TailPtr = p_tcb;                       /* New TCB is lowest in priority                        */
+        } else {
+            p_prev->PendNextPtr->PendPrevPtr = p_tcb;
+        }
+        p_prev->PendNextPtr = p_tcb;
+    }
+}
+#else
 void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
                              OS_TCB        *p_tcb)
 {
@@ -1364,6 +1495,61 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
         }
     }
 }
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                  FIND WHERE TO INSERT A PRIORITY WITH NO WAITING TASK
+*
+* Description: This function is called by OS_PendListInsertPrio() when no task of priority 'prio' is waiting.  It
+*              looks up .PrioTbl[] for the nearest higher priority (lower number) that has waiting tasks.
+*
+* Arguments  : p_pend_list    is a pointer to the OS_PEND_LIST
+*              -----------
+*
+*              prio           is the priority of the task to insert
+*
+* Returns    : The last OS_TCB of the nearest higher priority, or a NULL pointer if 'prio' goes at the head.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Priorities are stored MSB first, as in OSPrioTbl[], so the higher priorities of an entry are the bits
+*                 above 'prio' and the nearest of them is the lowest bit set.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN == DEF_ENABLED)
+static  OS_TCB  *OS_PendListPrioPrev (OS_PEND_LIST  *p_pend_list,
+                                      OS_PRIO        prio)
+{
+    OS_PRIO   ix;
+    CPU_DATA  bit_nbr;
+    CPU_DATA  bits;
+
+
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    ix      = prio / (OS_PRIO)DEF_INT_CPU_NBR_BITS;
+    bit_nbr = (CPU_DATA)prio & (DEF_INT_CPU_NBR_BITS - 1u);
+#else
+    ix      = 0u;
+    bit_nbr = prio;
+#endif
+    bits    = p_pend_list->PrioTbl[ix] & ~(DEF_INT_CPU_U_MAX_VAL >> bit_nbr);
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    while ((bits == 0u) && (ix > 0u)) {                         /* Nothing above in this entry, try the previous ones   */
+        ix--;
+        bits = p_pend_list->PrioTbl[ix];
+    }
+#endif
+    if (bits == 0u) {
+        return ((OS_TCB *)0);                                   /* No higher priority task is waiting                   */
+    }
+    prio = (OS_PRIO)(ix * (OS_PRIO)DEF_INT_CPU_NBR_BITS)
+         + (OS_PRIO)((DEF_INT_CPU_NBR_BITS - 1u) - CPU_CntTrailZeros(bits));
+    return (p_pend_list->PrioTailPtr[prio]);
+}
+#endif
 
 
 /*
@@ -1419,11 +1605,36 @@ void  OS_PendListRemove (OS_TCB  *p_tcb)
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_next;
     OS_TCB        *p_prev;
+#if (OS_CFG_PEND_LIST_BITMAP_EN == DEF_ENABLED)
+    OS_PRIO        prio;
+    CPU_DATA       bit;
+    OS_PRIO        ix;
+#endif
 
 
     if (p_tcb->PendObjPtr != (OS_PEND_OBJ *)0) {                /* Only remove if object has a pend list.               */
         p_pend_list = &p_tcb->PendObjPtr->PendList;             /* Get pointer to pend list                             */
 
+#if (OS_CFG_PEND_LIST_BITMAP_EN == DEF_ENABLED)
+        prio = p_tcb->PendPrio;                                 /* .Prio may already hold a new priority                */
+        if (p_pend_list->PrioTailPtr[prio] == p_tcb) {          /* Update the index if TCB is last of its priority      */
+            p_prev = p_tcb->PendPrevPtr;
+            if ((p_prev != (OS_TCB *)0) && (p_prev->PendPrio == prio)) {
+                p_pend_list->PrioTailPtr[prio] = p_prev;
+            } else {                                            /* No other task of this priority is waiting            */
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+                ix   = prio / (OS_PRIO)DEF_INT_CPU_NBR_BITS;
+                bit  = 1u;
+                bit <<= (DEF_INT_CPU_NBR_BITS - 1u) - ((CPU_DATA)prio & (DEF_INT_CPU_NBR_BITS - 1u));
+#else
+                ix   = 0u;
+                bit  = 1u;
+                bit <<= (DEF_INT_CPU_NBR_BITS - 1u) - (CPU_DATA)prio;
+#endif
+                p_pend_list->PrioTbl[ix] &= ~bit;
+            }
+        }
+#endif
                                                                 /* Remove TCB from the pend list.                       */
         if (p_pend_list->HeadPtr->PendNextPtr == (OS_TCB *)0) {
             p_pend_list->HeadPtr = (OS_TCB *)0;                 /* Only one entry in the pend list                      */
@@ -1714,6 +1925,13 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* EDF tasks are kept in deadline order                 */
+        OS_RdyListInsertEdf(p_tcb);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->HeadPtr == (OS_TCB *)0) {                   /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -1799,6 +2017,13 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* EDF tasks are kept in deadline order                 */
+        OS_RdyListInsertEdf(p_tcb);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->HeadPtr == (OS_TCB *)0) {                   /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -1821,6 +2046,67 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                                         INSERT TCB IN DEADLINE ORDER IN A LIST
+*
+* Description: This function is called to place an EDF task in the ready list at OS_CFG_SCHED_EDF_PRIO.  The list is
+*              kept sorted by absolute deadline, earliest first, so the head of the list is the task the scheduler
+*              runs.  A task with the same deadline as others is placed after them.
+*
+* Arguments  : p_tcb     is the OS_TCB to insert in the list
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A task at OS_CFG_SCHED_EDF_PRIO that is not an EDF task, a mutex owner that inherited the priority
+*                 for instance, has no deadline.  It is placed at the head of the list, ahead of every EDF task.
+*
+*              3) The list is searched from the tail since a job that has just been released usually has the latest
+*                 deadline.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+void  OS_RdyListInsertEdf (OS_TCB  *p_tcb)
+{
+    OS_RDY_LIST  *p_rdy_list;
+    OS_TCB       *p_tcb2;
+
+
+
+    p_rdy_list = &OSRdyList[p_tcb->Prio];
+    p_tcb2     = (OS_TCB *)0;
+    if (p_tcb->EdfPeriod != 0u) {                               /* No deadline goes to the head         See Note #2     */
+        p_tcb2 = p_rdy_list->TailPtr;                           /* Find the last OS_TCB due no later    See Note #3     */
+        while ((p_tcb2 != (OS_TCB *)0) &&
+               (p_tcb2->EdfPeriod != 0u) &&
+               (OS_TICK_BEFORE(p_tcb->EdfDeadline, p_tcb2->EdfDeadline) == DEF_TRUE)) {
+            p_tcb2 = p_tcb2->PrevPtr;
+        }
+    }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_rdy_list->NbrEntries++;                                   /* One more OS_TCB in the list                          */
+#endif
+    p_tcb->PrevPtr = p_tcb2;                                    /* Insert AFTER 'p_tcb2', at the head if none           */
+    if (p_tcb2 == (OS_TCB *)0) {
+        p_tcb->NextPtr      = p_rdy_list->HeadPtr;
+        p_rdy_list->HeadPtr = p_tcb;
+    } else {
+        p_tcb->NextPtr      = p_tcb2->NextPtr;
+        p_tcb2->NextPtr     = p_tcb;
+    }
+    if (p_tcb->NextPtr == (OS_TCB *)0) {
+        p_rdy_list->TailPtr = p_tcb;
+    } else {
+        p_tcb->NextPtr->PrevPtr = p_tcb;
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                MOVE TCB AT HEAD TO TAIL
@@ -2104,6 +2390,13 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
         return;
     }
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (p_rdy_list == &OSRdyList[OS_CFG_SCHED_EDF_PRIO]) {      /* EDF tasks are not time sliced, keep deadline order   */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#endif
+
     if (OSSchedLockNestingCtr > 0u) {                           /* Can't round-robin if the scheduler is locked         */
         CPU_CRITICAL_EXIT();
         return;
@@ -91,6 +91,62 @@ extern  "C" {                                    /* See Note #1.
 #define  OS_TASK_SW_SYNC()          __asm__ __volatile__ ("isb" : : : "memory")
 
 
+/*
+*********************************************************************************************************
+*                                       ATOMIC COMPARE AND SWAP
+*
+* Note(s) : (1) OS_CPU_CAS32() stores 'new_val' in '*p_val' only if it still holds 'old_val' and returns
+*               non-zero when it did.  GCC emits an LDREX/STREX loop, an exception taken between the two
+*               clears the exclusive monitor so the STREX fails instead of overwriting a nested update.
+*
+*           (2) Used by the deferred ISR post queue without disabling interrupts, see OS_IntQPost(), and by
+*               the reader-writer lock to count readers outside the kernel, see OSRWLockPendRd().
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_CAS32(p_val, old_val, new_val)  __sync_bool_compare_and_swap((p_val), (old_val), (new_val))
+
+
+/*
+*********************************************************************************************************
+*                                     EXCLUSIVE LOAD AND STORE OF A POINTER
+*
+* Note(s) : (1) OS_CPU_LDREX_PTR() reads '*pp_val' and arms the exclusive monitor, OS_CPU_STREX_PTR() then
+*               stores 'p_new' only if the monitor is still armed and returns non-zero when it did.
+*               OS_CPU_CLREX() disarms the monitor when the store is abandoned.
+*
+*           (2) The Cortex-M clears the monitor on exception entry and return, and every context switch goes
+*               through PendSV.  A store that succeeds therefore proves that no ISR and no other task ran
+*               since the load, so kernel state read between the two is still current.  Unlike a compare
+*               and swap, this lets a fast path check several variables without a critical section.
+*
+*           (3) Used by the uncontended mutex fast path, see OS_MutexFastPend().
+*********************************************************************************************************
+*/
+
+static  __inline  void  *OS_CPU_LdrexPtr (void  *volatile  *pp_val)
+{
+    void  *p_val;
+
+
+    __asm__ __volatile__ ("ldrex %0, [%1]" : "=r" (p_val) : "r" (pp_val) : "memory");
+    return (p_val);
+}
+
+static  __inline  CPU_INT32U  OS_CPU_StrexPtr (void  *volatile  *pp_val, void  *p_new)
+{
+    CPU_INT32U  fail;
+
+
+    __asm__ __volatile__ ("strex %0, %2, [%1]" : "=&r" (fail) : "r" (pp_val), "r" (p_new) : "memory");
+    return (fail == 0u);
+}
+
+#define  OS_CPU_LDREX_PTR(pp_val)         OS_CPU_LdrexPtr((void *volatile *)(pp_val))
+#define  OS_CPU_STREX_PTR(pp_val, p_new)  OS_CPU_StrexPtr((void *volatile *)(pp_val), (void *)(p_new))
+#define  OS_CPU_CLREX()                   __asm__ __volatile__ ("clrex" : : : "memory")
+
+
 /*
 *********************************************************************************************************
 *                                       TIMESTAMP CONFIGURATION
@@ -87,6 +87,62 @@ extern "C" {
 #define  OS_CFG_TASK_IDLE_EN             DEF_ENABLED
 #endif
 
+#ifndef OS_CFG_TICK_WHEEL_EN
+#define  OS_CFG_TICK_WHEEL_EN            DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_TMR_WHEEL_EN
+#define  OS_CFG_TMR_WHEEL_EN             DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_PEND_LIST_BITMAP_EN
+#define  OS_CFG_PEND_LIST_BITMAP_EN      DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_ISR_POST_DEFERRED_EN
+#define  OS_CFG_ISR_POST_DEFERRED_EN     DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_Q_BATCH_EN
+#define  OS_CFG_Q_BATCH_EN               DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_SEM_BATCH_EN
+#define  OS_CFG_SEM_BATCH_EN             DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_TASK_Q_BATCH_EN
+#define  OS_CFG_TASK_Q_BATCH_EN          DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_RING_EN
+#define  OS_CFG_RING_EN                  DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_RING_DEL_EN
+#define  OS_CFG_RING_DEL_EN              DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_RWLOCK_EN
+#define  OS_CFG_RWLOCK_EN                DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_RWLOCK_DEL_EN
+#define  OS_CFG_RWLOCK_DEL_EN            DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_SCHED_EDF_EN
+#define  OS_CFG_SCHED_EDF_EN             DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MUTEX_FAST_EN
+#define  OS_CFG_MUTEX_FAST_EN            DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MUTEX_PCP_EN
+#define  OS_CFG_MUTEX_PCP_EN             DEF_DISABLED
+#endif
+
 #ifndef OS_CFG_TASK_STK_REDZONE_EN
 #define  OS_CFG_TASK_STK_REDZONE_EN      DEF_DISABLED
 #endif
@@ -188,6 +244,10 @@ extern "C" {
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
 #define  OS_TASK_PEND_ON_COND_VAR             (OS_STATE)(  8u)  /* Pending on condition variable                      */
+#define  OS_TASK_PEND_ON_RING                 (OS_STATE)(  9u)  /* Pending on an empty ring                           */
+#define  OS_TASK_PEND_ON_MUTEX_PCP            (OS_STATE)( 10u)  /* Pending on priority ceiling mutex                  */
+#define  OS_TASK_PEND_ON_RWLOCK_RD            (OS_STATE)( 11u)  /* Pending on reader-writer lock, to read             */
+#define  OS_TASK_PEND_ON_RWLOCK_WR            (OS_STATE)( 12u)  /* Pending on reader-writer lock, to write            */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -215,6 +275,7 @@ extern "C" {
 #define  OS_OBJ_TYPE_FLAG                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('F', 'L', 'A', 'G')
 #define  OS_OBJ_TYPE_MEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'E', 'M', ' ')
 #define  OS_OBJ_TYPE_MUTEX                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'U', 'T', 'X')
+#define  OS_OBJ_TYPE_MUTEX_PCP               (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'P', 'C', 'P')
 #define  OS_OBJ_TYPE_Q                       (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'U', 'E', 'U')
 #define  OS_OBJ_TYPE_SEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'M', 'A')
 #define  OS_OBJ_TYPE_MON                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'O', 'N', ' ')
@@ -224,6 +285,8 @@ extern "C" {
 #define  OS_OBJ_TYPE_TASK_SUSPEND            (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'S', 'U', 'S')
 #define  OS_OBJ_TYPE_TICK                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'I', 'C', 'K')
 #define  OS_OBJ_TYPE_TMR                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'R', ' ')
+#define  OS_OBJ_TYPE_RING                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'I', 'N', 'G')
+#define  OS_OBJ_TYPE_RWLOCK                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'W', 'L', 'K')
 
 /*
 ========================================================================================================================
@@ -377,6 +440,9 @@ extern "C" {
 #define  OS_TICK_TH_RDY                     (OS_TICK)(DEF_BIT_FIELD(((sizeof(OS_TICK) * DEF_OCTET_NBR_BITS) / 2u), \
                                                                     ((sizeof(OS_TICK) * DEF_OCTET_NBR_BITS) / 2u)))
 
+                                                                    /* Tick 'a' comes before tick 'b', across wraps   */
+#define  OS_TICK_BEFORE(a, b)               ((OS_TICK)((OS_TICK)(a) - (OS_TICK)(b)) >= OS_TICK_TH_INIT)
+
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -433,6 +499,9 @@ typedef  enum  os_err {
     OS_ERR_DEL_ISR                   = 13001u,
 
     OS_ERR_E                         = 14000u,
+    OS_ERR_EDF_DEADLINE_INVALID      = 14001u,
+    OS_ERR_EDF_PERIOD_INVALID        = 14002u,
+    OS_ERR_EDF_TASK_INVALID          = 14003u,
 
     OS_ERR_F                         = 15000u,
     OS_ERR_FATAL_RETURN              = 15001u,
@@ -449,11 +518,11 @@ typedef  enum  os_err {
     OS_ERR_I                         = 18000u,
     OS_ERR_ILLEGAL_CREATE_RUN_TIME   = 18001u,
 
-    OS_ERR_INT_Q                     = 18002u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_FULL                = 18003u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_SIZE                = 18004u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_STK_INVALID         = 18005u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_STK_SIZE_INVALID    = 18006u,                  /* OBSOLETE ERR CODE                                    */
+    OS_ERR_INT_Q                     = 18002u,                  /* No ISR queue storage, OS_CFG_ISR_POST_DEFERRED_EN    */
+    OS_ERR_INT_Q_FULL                = 18003u,                  /* ISR queue full, the post from the ISR was lost       */
+    OS_ERR_INT_Q_SIZE                = 18004u,                  /* ISR queue size is not a power of 2 of at least 2     */
+    OS_ERR_INT_Q_STK_INVALID         = 18005u,                  /* No stack for the ISR handler task                    */
+    OS_ERR_INT_Q_STK_SIZE_INVALID    = 18006u,                  /* ISR handler task stack smaller than the minimum      */
 
     OS_ERR_ILLEGAL_DEL_RUN_TIME      = 18007u,
 
@@ -484,6 +553,8 @@ typedef  enum  os_err {
     OS_ERR_MUTEX_OWNER               = 22402u,
     OS_ERR_MUTEX_NESTING             = 22403u,
     OS_ERR_MUTEX_OVF                 = 22404u,
+    OS_ERR_MUTEX_CEILING             = 22405u,
+    OS_ERR_MUTEX_ORDER               = 22406u,
 
     OS_ERR_N                         = 23000u,
     OS_ERR_NAME                      = 23001u,
@@ -651,6 +722,7 @@ typedef  struct  os_msg_pool         OS_MSG_POOL;
 typedef  struct  os_msg_q            OS_MSG_Q;
 
 typedef  struct  os_mutex            OS_MUTEX;
+typedef  struct  os_mutex_pcp        OS_MUTEX_PCP;
 
 typedef  struct  os_q                OS_Q;
 
@@ -658,6 +730,10 @@ typedef  struct  os_mon              OS_MON;
 typedef  struct  os_mon_data         OS_MON_DATA;
 typedef  struct  os_mon_ctx          OS_MON_CTX;
 
+typedef  struct  os_ring             OS_RING;
+
+typedef  struct  os_rwlock           OS_RWLOCK;
+
 typedef  struct  os_sem              OS_SEM;
 
 typedef  void                      (*OS_TASK_PTR)(void *p_arg);
@@ -687,6 +763,10 @@ typedef  struct  os_tmr              OS_TMR;
 typedef  struct  os_pend_list        OS_PEND_LIST;
 typedef  struct  os_pend_obj         OS_PEND_OBJ;
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+typedef  struct  os_int_q            OS_INT_Q;
+#endif
+
 #if (OS_CFG_APP_HOOKS_EN == DEF_ENABLED)
 typedef  void                      (*OS_APP_HOOK_VOID)(void);
 typedef  void                      (*OS_APP_HOOK_TCB)(OS_TCB *p_tcb);
@@ -728,6 +808,10 @@ struct  os_pend_list {
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_OBJ_QTY           NbrEntries;
 #endif
+#if (OS_CFG_PEND_LIST_BITMAP_EN == DEF_ENABLED)
+    CPU_DATA             PrioTbl[OS_PRIO_TBL_SIZE];         /* Bit set for each priority that has a waiting task      */
+    OS_TCB              *PrioTailPtr[OS_CFG_PRIO_MAX];      /* Last waiting task of each priority in PrioTbl[]        */
+#endif
 };
 
 
@@ -894,6 +978,9 @@ struct  os_mutex {                                          /* Mutual Exclusion
     OS_MUTEX            *MutexGrpNextPtr;
     OS_TCB              *OwnerTCBPtr;
     OS_NESTING_CTR       OwnerNestingCtr;                   /* Mutex is available when the counter is 0               */
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    CPU_BOOLEAN          GrpLinked;                         /* In the owner's mutex group, not taken on the fast path */
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     CPU_TS               TS;
 #endif
@@ -903,6 +990,44 @@ struct  os_mutex {                                          /* Mutual Exclusion
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                             PRIORITY CEILING MUTEXES
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) The owner runs at 'Ceiling' or higher while it holds the mutex (immediate priority ceiling protocol).
+*               The mutexes a task holds form a stack through 'StkNextPtr', the last one taken at the head.
+*               'CeilingPrev' is the owner's OS_TCB.CeilingPrio before it took the mutex and is restored on release.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_mutex_pcp {                                      /* Priority Ceiling Mutual Exclusion Semaphore            */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_MUTEX_PCP                 */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Mutex Name (NUL terminated ASCII)           */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on mutex                         */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_MUTEX_PCP        *DbgPrevPtr;
+    OS_MUTEX_PCP        *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_MUTEX_PCP        *StkNextPtr;                        /* Mutex the owner took before this one   See Note #2     */
+    OS_TCB              *OwnerTCBPtr;
+    OS_NESTING_CTR       OwnerNestingCtr;                   /* Mutex is available when the counter is 0               */
+    OS_PRIO              Ceiling;                           /* Priority of the highest task that takes the mutex      */
+    OS_PRIO              CeilingPrev;                       /* Owner's ceiling before it took the mutex  See Note #2  */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS               TS;
+#endif
+};
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                    MESSAGE QUEUES
@@ -930,6 +1055,72 @@ struct  os_q {                                              /* Message Queue
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                           SINGLE PRODUCER, SINGLE CONSUMER RINGS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) 'In' is only written by the producer and 'Out' only by the consumer.  Both count elements and are free
+*               running, the slot of an element is its count masked by 'Mask', the capacity less one.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_ring {                                           /* Ring                                                   */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_RING                      */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Ring Name (NUL terminated ASCII)            */
+#endif
+    OS_PEND_LIST         PendList;                          /* Consumer, when blocked on the empty ring               */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_RING             *DbgPrevPtr;
+    OS_RING             *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    CPU_INT08U          *StoragePtr;                        /* Element storage                                        */
+    CPU_INT32U           Mask;                              /* Capacity - 1, capacity is a power of 2                 */
+    OS_MSG_SIZE          ElemSize;                          /* Element size in bytes                                  */
+    volatile CPU_INT32U  In;                                /* Elements pushed                        See Note #2     */
+    volatile CPU_INT32U  Out;                               /* Elements popped                        See Note #2     */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 READER-WRITER LOCKS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) 'State' holds the number of readers, a bit set while a writer holds the lock and a bit set while tasks
+*               may be waiting.  Readers take and release the lock by updating it with OS_CPU_CAS32() while neither
+*               bit is set.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_rwlock {                                         /* Reader-Writer Lock                                     */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_RWLOCK                    */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Lock Name (NUL terminated ASCII)            */
+#endif
+    OS_PEND_LIST         PendList;                          /* Readers and writers waiting, by priority               */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_RWLOCK           *DbgPrevPtr;
+    OS_RWLOCK           *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    volatile CPU_INT32U  State;                             /* Readers and flags                      See Note #2     */
+    OS_TCB              *OwnerTCBPtr;                       /* Writer holding the lock                                */
+};
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                      SEMAPHORES
@@ -1040,6 +1231,9 @@ struct os_tcb {
     OS_TCB              *PendNextPtr;                       /* Pointer to next     TCB in pend list.                  */
     OS_TCB              *PendPrevPtr;                       /* Pointer to previous TCB in pend list.                  */
     OS_PEND_OBJ         *PendObjPtr;                        /* Pointer to object pended on.                           */
+#if (OS_CFG_PEND_LIST_BITMAP_EN == DEF_ENABLED)
+    OS_PRIO              PendPrio;                          /* Priority the task was inserted in the pend list with   */
+#endif
     OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
     OS_STATUS            PendStatus;                        /* Pend status                                            */
 
@@ -1049,6 +1243,10 @@ struct os_tcb {
     OS_PRIO              BasePrio;                          /* Base priority (Not inherited)                          */
     OS_MUTEX            *MutexGrpHeadPtr;                   /* Owned mutex group head pointer                         */
 #endif
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)
+    OS_MUTEX_PCP        *MutexPcpHeadPtr;                   /* Priority ceiling mutex taken last                      */
+    OS_PRIO              CeilingPrio;                       /* Highest ceiling of the mutexes held, else PRIO_MAX-1   */
+#endif
 
 #if ((OS_CFG_DBG_EN == DEF_ENABLED) || (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED) || (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED))
     CPU_STK_SIZE         StkSize;                           /* Size of task stack (in number of stack elements)       */
@@ -1067,6 +1265,9 @@ struct os_tcb {
 #if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
     OS_TICK              TickRemain;                        /* Number of ticks remaining (updated by OS_TickTask()    */
     OS_TICK              TickCtrPrev;                       /* Used by OSTimeDlyXX() in PERIODIC mode                 */
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
+    OS_TICK              TickMatch;                         /* Value of OSTickWheelCtr when the delay expires         */
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
@@ -1074,6 +1275,14 @@ struct os_tcb {
     OS_TICK              TimeQuantaCtr;
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)                    /* EARLIEST DEADLINE FIRST                                */
+    OS_TICK              EdfPeriod;                         /* Period in ticks, 0 when not an EDF task                */
+    OS_TICK              EdfDeadlineRel;                    /* Deadline in ticks, relative to the release of a job    */
+    OS_TICK              EdfRelease;                        /* Tick at which the current job was released             */
+    OS_TICK              EdfDeadline;                       /* Tick by which the current job must complete            */
+    OS_CTR               EdfMissCtr;                        /* Number of jobs that missed their deadline              */
+#endif
+
 #if (OS_MSG_EN == DEF_ENABLED)
     void                *MsgPtr;                            /* Message received                                       */
     OS_MSG_SIZE          MsgSize;
@@ -1148,7 +1357,11 @@ struct os_tcb {
 */
 
 struct  os_tick_list {
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
+    OS_TCB              *WheelTbl[OS_CFG_TICK_WHEEL_SIZE];  /* Unsorted lists of tasks hashed by expiry tick         */
+#else
     OS_TCB              *TCB_Ptr;                           /* Pointer to list of tasks in tick list                 */
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_OBJ_QTY           NbrEntries;                        /* Current number of entries in the tick list            */
     OS_OBJ_QTY           NbrUpdated;                        /* Number of entries updated                             */
@@ -1156,6 +1369,24 @@ struct  os_tick_list {
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                            DEFERRED ISR POST QUEUE DATA TYPE
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+struct  os_int_q {
+    OS_OBJ_TYPE          Type;                              /* Type of object the post is destined to                 */
+    void                *ObjPtr;                            /* Pointer to the object or task posted to                */
+    void                *MsgPtr;                            /* Message posted to a queue or to a task                 */
+    OS_MSG_SIZE          MsgSize;                           /* Size of the message                                    */
+    OS_FLAGS             Flags;                             /* Flags posted to a flag group, or OSSemPostN() count  */
+    OS_OPT               Opt;                               /* Post options                                           */
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                   TIMER DATA TYPES
@@ -1178,6 +1409,11 @@ struct  os_tmr {
     OS_TICK              Period;                            /* Period to repeat timer                                 */
     OS_OPT               Opt;                               /* Options (see OS_OPT_TMR_xxx)                           */
     OS_STATE             State;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+    OS_TICK              Match;                             /* Value of OSTmrTickCtr when the timer expires           */
+    OS_TMR              *FireNextPtr;                       /* Link in the timer task's batch of callbacks            */
+    CPU_BOOLEAN          FirePend;                          /* Callback due in the current batch                      */
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_TMR              *DbgPrevPtr;
     OS_TMR              *DbgNextPtr;
@@ -1254,12 +1490,22 @@ OS_EXT            OS_MSG_POOL               OSMsgPool;                  /* Pool
 OS_EXT            OS_MUTEX                 *OSMutexDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSMutexQty;                 /* Number of mutexes created                  */
 #endif
+#endif
+
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+OS_EXT            OS_MUTEX_PCP             *OSMutexPcpDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSMutexPcpQty;              /* Number of priority ceiling mutexes created */
+#endif
 #endif
 
                                                                         /* PRIORITIES ------------------------------- */
 OS_EXT            OS_PRIO                   OSPrioCur;                  /* Priority of current task                   */
 OS_EXT            OS_PRIO                   OSPrioHighRdy;              /* Priority of highest priority task          */
 extern            CPU_DATA                  OSPrioTbl[OS_PRIO_TBL_SIZE];
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+extern            CPU_DATA                  OSPrioGrp;                  /* One bit per non-empty OSPrioTbl[] entry    */
+#endif
 
                                                                         /* QUEUES ----------------------------------- */
 #if (OS_CFG_Q_EN == DEF_ENABLED)
@@ -1304,6 +1550,22 @@ OS_EXT            OS_OBJ_QTY                OSSemQty;                   /* Numbe
 OS_EXT            OS_MON                   *OSMonDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSMonQty;                   /* Number of monitors created                 */
 #endif
+#endif
+
+                                                                        /* RINGS ------------------------------------ */
+#if (OS_CFG_RING_EN == DEF_ENABLED)
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+OS_EXT            OS_RING                  *OSRingDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSRingQty;                  /* Number of rings created                    */
+#endif
+#endif
+
+                                                                        /* READER-WRITER LOCKS ---------------------- */
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+OS_EXT            OS_RWLOCK                *OSRWLockDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSRWLockQty;                /* Number of reader-writer locks created      */
+#endif
 #endif
 
                                                                         /* STATISTICS ------------------------------- */
@@ -1348,6 +1610,19 @@ OS_EXT            CPU_TS                    OSTickTaskTimeMax;
 #endif
 OS_EXT            OS_TICK_LIST              OSTickListDly;
 OS_EXT            OS_TICK_LIST              OSTickListTimeout;
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
+OS_EXT            OS_TICK                   OSTickWheelCtr;             /* Cnts ticks for the wheel, not set by OSTimeSet()*/
+#endif
+#endif
+
+                                                                        /* DEFERRED ISR POSTS ----------------------- */
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+OS_EXT            CPU_INT32U                OSIntQInCtr;                /* Nbr of entries claimed by ISRs             */
+OS_EXT            CPU_INT32U                OSIntQOutCtr;               /* Nbr of entries re-posted by the task       */
+OS_EXT            CPU_BOOLEAN               OSIntQSignalPend;           /* Handler task signaled and not yet draining */
+OS_EXT            OS_OBJ_QTY                OSIntQNbrEntriesMax;        /* Peak number of entries in the queue        */
+OS_EXT            OS_OBJ_QTY                OSIntQOvfCtr;               /* Nbr of ISR posts lost to a full queue      */
+OS_EXT            OS_TCB                    OSIntQTaskTCB;
 #endif
 
 
@@ -1358,6 +1633,9 @@ OS_EXT            OS_TMR                   *OSTmrDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSTmrListEntries;           /* Doubly-linked list of timers               */
 #endif
 OS_EXT            OS_TMR                   *OSTmrListPtr;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+OS_EXT            OS_TMR                   *OSTmrWheelTbl[OS_CFG_TMR_WHEEL_SIZE]; /* Running timers by expiry     */
+#endif
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)                                    /* Use a Mutex (if available) to protect tmrs */
 OS_EXT            OS_MUTEX                  OSTmrMutex;
 #endif
@@ -1425,6 +1703,16 @@ extern  CPU_STK_SIZE  const OSCfg_TmrTaskStkLimit;
 extern  CPU_STK_SIZE  const OSCfg_TmrTaskStkSize;
 extern  CPU_INT32U    const OSCfg_TmrTaskStkSizeRAM;
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+extern  OS_INT_Q    * const OSCfg_IntQBasePtr;
+extern  OS_OBJ_QTY    const OSCfg_IntQSize;
+extern  OS_PRIO       const OSCfg_IntQTaskPrio;
+extern  CPU_STK     * const OSCfg_IntQTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkSize;
+extern  CPU_INT32U    const OSCfg_IntQTaskStkSizeRAM;
+#endif
+
 extern  CPU_INT32U    const OSCfg_DataSizeRAM;
 
 #if (OS_CFG_TASK_IDLE_EN == DEF_ENABLED)
@@ -1451,6 +1739,11 @@ extern  CPU_STK        OSCfg_TickTaskStk[OS_CFG_TICK_TASK_STK_SIZE];
 extern  CPU_STK        OSCfg_TmrTaskStk[OS_CFG_TMR_TASK_STK_SIZE];
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+extern  OS_INT_Q       OSCfg_IntQ[OS_CFG_INT_Q_SIZE];
+extern  CPU_STK        OSCfg_IntQTaskStk[OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
+
 /*
 ************************************************************************************************************************
 ************************************************************************************************************************
@@ -1628,6 +1921,12 @@ void          OS_MutexDbgListAdd        (OS_MUTEX              *p_mutex);
 void          OS_MutexDbgListRemove     (OS_MUTEX              *p_mutex);
 #endif
 
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+CPU_BOOLEAN   OS_MutexFastPend          (OS_MUTEX              *p_mutex);
+
+CPU_BOOLEAN   OS_MutexFastPost          (OS_MUTEX              *p_mutex);
+#endif
+
 void          OS_MutexGrpAdd            (OS_TCB                *p_tcb,
                                          OS_MUTEX              *p_mutex);
 
@@ -1640,6 +1939,48 @@ void          OS_MutexGrpPostAll        (OS_TCB                *p_tcb);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                              PRIORITY CEILING MUTEXES                                              */
+/* ================================================================================================================== */
+
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)
+
+void          OSMutexPcpCreate          (OS_MUTEX_PCP          *p_mutex,
+                                         CPU_CHAR              *p_name,
+                                         OS_PRIO                ceiling,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_MUTEX_DEL_EN == DEF_ENABLED)
+OS_OBJ_QTY    OSMutexPcpDel             (OS_MUTEX_PCP          *p_mutex,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSMutexPcpPend            (OS_MUTEX_PCP          *p_mutex,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSMutexPcpPost            (OS_MUTEX_PCP          *p_mutex,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_MutexPcpClr            (OS_MUTEX_PCP          *p_mutex);
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void          OS_MutexPcpDbgListAdd     (OS_MUTEX_PCP          *p_mutex);
+
+void          OS_MutexPcpDbgListRemove  (OS_MUTEX_PCP          *p_mutex);
+#endif
+
+void          OS_MutexPcpPostAll        (OS_TCB                *p_tcb);
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                   MESSAGE QUEUES                                                   */
 /* ================================================================================================================== */
@@ -1675,12 +2016,31 @@ OS_OBJ_QTY    OSQPendAbort              (OS_Q                  *p_q,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY    OSQPendN                  (OS_Q                  *p_q,
+                                         void                 **p_msg_tbl,
+                                         OS_MSG_SIZE           *p_size_tbl,
+                                         OS_MSG_QTY             n_max,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 void          OSQPost                   (OS_Q                  *p_q,
                                          void                  *p_void,
                                          OS_MSG_SIZE            msg_size,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY    OSQPostN                  (OS_Q                  *p_q,
+                                         void           *const *p_msg_tbl,
+                                         OS_MSG_SIZE           *p_size_tbl,
+                                         OS_MSG_QTY             n,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_QClr                   (OS_Q                  *p_q);
@@ -1694,6 +2054,97 @@ void          OS_QDbgListRemove         (OS_Q                  *p_q);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                                       RINGS                                                        */
+/* ================================================================================================================== */
+
+#if (OS_CFG_RING_EN == DEF_ENABLED)
+void          OSRingCreate              (OS_RING               *p_ring,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_storage,
+                                         OS_MSG_QTY             nbr_elem,
+                                         OS_MSG_SIZE            elem_size,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_RING_DEL_EN == DEF_ENABLED)
+OS_OBJ_QTY    OSRingDel                 (OS_RING               *p_ring,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSRingPop                 (OS_RING               *p_ring,
+                                         void                  *p_elem,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSRingPush                (OS_RING               *p_ring,
+                                         void                  *p_elem,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_RingClr                (OS_RING               *p_ring);
+
+void          OS_RingPost               (OS_RING               *p_ring,
+                                         OS_OPT                 opt);
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void          OS_RingDbgListAdd         (OS_RING               *p_ring);
+
+void          OS_RingDbgListRemove      (OS_RING               *p_ring);
+#endif
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                 READER-WRITER LOCKS                                                */
+/* ================================================================================================================== */
+
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+void          OSRWLockCreate            (OS_RWLOCK             *p_lock,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_RWLOCK_DEL_EN == DEF_ENABLED)
+OS_OBJ_QTY    OSRWLockDel               (OS_RWLOCK             *p_lock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSRWLockPendRd            (OS_RWLOCK             *p_lock,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSRWLockPostRd            (OS_RWLOCK             *p_lock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSRWLockPendWr            (OS_RWLOCK             *p_lock,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSRWLockPostWr            (OS_RWLOCK             *p_lock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_RWLockClr              (OS_RWLOCK             *p_lock);
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void          OS_RWLockDbgListAdd       (OS_RWLOCK             *p_lock);
+
+void          OS_RWLockDbgListRemove    (OS_RWLOCK             *p_lock);
+#endif
+
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                     SEMAPHORES                                                     */
 /* ================================================================================================================== */
@@ -1727,6 +2178,13 @@ OS_SEM_CTR    OSSemPost                 (OS_SEM                *p_sem,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+OS_SEM_CTR    OSSemPostN                (OS_SEM                *p_sem,
+                                         OS_SEM_CTR             cnt,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_SEM_SET_EN == DEF_ENABLED)
 void          OSSemSet                  (OS_SEM                *p_sem,
                                          OS_SEM_CTR             cnt,
@@ -1775,6 +2233,15 @@ void          OSTaskDel                 (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+void          OSTaskEdfSet              (OS_TCB                *p_tcb,
+                                         OS_TICK                period,
+                                         OS_TICK                deadline,
+                                         OS_ERR                *p_err);
+
+void          OSTaskEdfWait             (OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
 OS_MSG_QTY    OSTaskQFlush              (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
@@ -1795,6 +2262,22 @@ void          OSTaskQPost               (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_TASK_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY    OSTaskQPendN              (void                 **p_msg_tbl,
+                                         OS_MSG_SIZE           *p_size_tbl,
+                                         OS_MSG_QTY             n_max,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+OS_MSG_QTY    OSTaskQPostN              (OS_TCB                *p_tcb,
+                                         void           *const *p_msg_tbl,
+                                         OS_MSG_SIZE           *p_size_tbl,
+                                         OS_MSG_QTY             n,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -1973,6 +2456,11 @@ void          OS_TmrLink                (OS_TMR                *p_tmr,
 
 void          OS_TmrUnlink              (OS_TMR                *p_tmr);
 
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+void          OS_TmrWheelLink           (OS_TMR                *p_tmr,
+                                         OS_TICK                remain);
+#endif
+
 void          OS_TmrTask                (void                  *p_arg);
 
 #endif
@@ -2056,6 +2544,24 @@ void          OS_StatTaskInit           (OS_ERR                *p_err);
 void          OS_TickTask               (void                  *p_arg);
 void          OS_TickTaskInit           (OS_ERR                *p_err);
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+void          OS_IntQPost               (OS_OBJ_TYPE            type,
+                                         void                  *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OS_IntQRePost             (OS_INT_Q              *p_int_q);
+
+CPU_BOOLEAN   OS_IntQSignalDirect       (OS_TCB                *p_tcb);
+
+void          OS_IntQTask               (void                  *p_arg);
+
+void          OS_IntQTaskInit           (OS_ERR                *p_err);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -2176,6 +2682,10 @@ void          OS_RdyListInsertHead      (OS_TCB                *p_tcb);
 
 void          OS_RdyListInsertTail      (OS_TCB                *p_tcb);
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+void          OS_RdyListInsertEdf       (OS_TCB                *p_tcb);
+#endif
+
 void          OS_RdyListMoveHeadToTail  (OS_RDY_LIST           *p_rdy_list);
 
 void          OS_RdyListRemove          (OS_TCB                *p_tcb);
@@ -2267,6 +2777,10 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #error  "OS_CFG.H,         OS_CFG_PRIO_MAX must be >= 8"
 #endif
 
+#if     OS_CFG_PRIO_MAX > (DEF_INT_CPU_NBR_BITS * DEF_INT_CPU_NBR_BITS)
+#error  "OS_CFG.H,         OS_CFG_PRIO_MAX must be <= DEF_INT_CPU_NBR_BITS squared (two-level ready bitmap)"
+#endif
+
 
 #ifndef OS_CFG_SCHED_LOCK_TIME_MEAS_EN
 #error  "OS_CFG.H, Missing OS_CFG_SCHED_LOCK_TIME_MEAS_EN: Include code to measure scheduler lock time"
@@ -2283,6 +2797,18 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #endif
 
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    #ifndef OS_CFG_SCHED_EDF_PRIO
+    #error  "OS_CFG_APP.H, Missing OS_CFG_SCHED_EDF_PRIO: Priority shared by the EDF tasks"
+    #elif ((OS_CFG_SCHED_EDF_PRIO == 0u) || (OS_CFG_SCHED_EDF_PRIO >= (OS_CFG_PRIO_MAX - 1u)))
+    #error  "OS_CFG_APP.H,     OS_CFG_SCHED_EDF_PRIO must be > 0 and < OS_CFG_PRIO_MAX - 1"
+    #endif
+    #if (OS_CFG_TASK_TICK_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_TASK_TICK_EN must be Enabled (1) to use EDF scheduling"
+    #endif
+#endif
+
+
 #ifndef OS_CFG_STK_SIZE_MIN
 #error  "OS_CFG.H, Missing OS_CFG_STK_SIZE_MIN: Determines the minimum size for a task stack"
 #endif
@@ -2344,6 +2870,16 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
     #ifndef OS_CFG_MUTEX_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_MUTEX_PEND_ABORT_EN: Include code for OSMutexPendAbort()"
     #endif
+
+    #if    (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED) && \
+           (!defined(OS_CPU_STREX_PTR))
+    #error  "OS_CPU.H, OS_CFG_MUTEX_FAST_EN requires OS_CPU_LDREX_PTR(), OS_CPU_STREX_PTR() and OS_CPU_CLREX()"
+    #endif
+
+    #if    (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED) && \
+           (OS_CFG_MUTEX_EN     == DEF_DISABLED)
+    #error  "OS_CFG.H, OS_CFG_MUTEX_PCP_EN requires OS_CFG_MUTEX_EN"
+    #endif
 #endif
 
 /*
@@ -2420,6 +2956,11 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TASK_Q_PEND_ABORT_EN: Include code for OSTaskQPendAbort()"
 #endif
 
+#if    (OS_CFG_TASK_Q_BATCH_EN == DEF_ENABLED) && \
+       (OS_CFG_TASK_Q_EN == DEF_DISABLED)
+#error  "OS_CFG.H,         OS_CFG_TASK_Q_EN must be Enabled (1) to use OSTaskQPostN() and OSTaskQPendN()"
+#endif
+
 #ifndef OS_CFG_TASK_PROFILE_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_PROFILE_EN: Include code for task profiling"
 #else
@@ -2455,6 +2996,31 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TIME_DLY_RESUME_EN: Include code for OSTimeDlyResume()"
 #endif
 
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
+    #ifndef OS_CFG_TICK_WHEEL_SIZE
+    #error  "OS_CFG.H, Missing OS_CFG_TICK_WHEEL_SIZE: Number of spokes in the tick wheel"
+    #elif ((OS_CFG_TICK_WHEEL_SIZE < 2u) || ((OS_CFG_TICK_WHEEL_SIZE & (OS_CFG_TICK_WHEEL_SIZE - 1u)) != 0u))
+    #error  "OS_CFG.H,         OS_CFG_TICK_WHEEL_SIZE must be a power of 2"
+    #endif
+    #if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    #error  "OS_CFG.H,         OS_CFG_DYN_TICK_EN must be Disabled (0) to use the tick wheel"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                 DEFERRED ISR POSTS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    #ifndef OS_CFG_INT_Q_SIZE
+    #error  "OS_CFG_APP.H, Missing OS_CFG_INT_Q_SIZE: Number of deferred ISR posts that can be queued"
+    #elif ((OS_CFG_INT_Q_SIZE < 2u) || ((OS_CFG_INT_Q_SIZE & (OS_CFG_INT_Q_SIZE - 1u)) != 0u))
+    #error  "OS_CFG_APP.H,     OS_CFG_INT_Q_SIZE must be a power of 2"
+    #endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                  TIMER MANAGEMENT
@@ -2467,6 +3033,13 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
     #ifndef OS_CFG_TMR_DEL_EN
     #error  "OS_CFG.H, Missing OS_CFG_TMR_DEL_EN: Enables (1) or Disables (0) code for OSTmrDel()"
     #endif
+    #if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+        #ifndef OS_CFG_TMR_WHEEL_SIZE
+        #error  "OS_CFG.H, Missing OS_CFG_TMR_WHEEL_SIZE: Number of spokes in the timer wheel"
+        #elif ((OS_CFG_TMR_WHEEL_SIZE < 2u) || ((OS_CFG_TMR_WHEEL_SIZE & (OS_CFG_TMR_WHEEL_SIZE - 1u)) != 0u))
+        #error  "OS_CFG.H,         OS_CFG_TMR_WHEEL_SIZE must be a power of 2"
+        #endif
+    #endif
 #endif
 
 /*
@@ -46,6 +46,10 @@ const  CPU_CHAR  *os_cfg_app__c = "$Id: $";
 #define  OS_CFG_IDLE_TASK_STK_LIMIT      ((OS_CFG_IDLE_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+#define  OS_CFG_INT_Q_TASK_STK_LIMIT     ((OS_CFG_INT_Q_TASK_STK_SIZE * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
+#endif
+
 #if (OS_CFG_STAT_TASK_EN == DEF_ENABLED)
 #define  OS_CFG_STAT_TASK_STK_LIMIT      ((OS_CFG_STAT_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #endif
@@ -68,6 +72,11 @@ const  CPU_CHAR  *os_cfg_app__c = "$Id: $";
 CPU_STK        OSCfg_IdleTaskStk   [OS_CFG_IDLE_TASK_STK_SIZE];
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+OS_INT_Q       OSCfg_IntQ          [OS_CFG_INT_Q_SIZE];
+CPU_STK        OSCfg_IntQTaskStk   [OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
+
 #if (OS_CFG_ISR_STK_SIZE > 0u)
 CPU_STK        OSCfg_ISRStk        [OS_CFG_ISR_STK_SIZE];
 #endif
@@ -106,6 +115,16 @@ CPU_STK_SIZE   const  OSCfg_IdleTaskStkSize      =            0u;
 CPU_INT32U     const  OSCfg_IdleTaskStkSizeRAM   =            0u;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+OS_INT_Q     * const  OSCfg_IntQBasePtr          = &OSCfg_IntQ[0];
+OS_OBJ_QTY     const  OSCfg_IntQSize             =  OS_CFG_INT_Q_SIZE;
+OS_PRIO        const  OSCfg_IntQTaskPrio         =  OS_CFG_INT_Q_TASK_PRIO;
+CPU_STK      * const  OSCfg_IntQTaskStkBasePtr   = &OSCfg_IntQTaskStk[0];
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkLimit     =  OS_CFG_INT_Q_TASK_STK_LIMIT;
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkSize      =  OS_CFG_INT_Q_TASK_STK_SIZE;
+CPU_INT32U     const  OSCfg_IntQTaskStkSizeRAM   =  sizeof(OSCfg_IntQTaskStk);
+#endif
+
 #if (OS_CFG_ISR_STK_SIZE > 0u)
 CPU_STK      * const  OSCfg_ISRStkBasePtr        = &OSCfg_ISRStk[0];
 CPU_STK_SIZE   const  OSCfg_ISRStkSize           =  OS_CFG_ISR_STK_SIZE;
@@ -210,6 +229,11 @@ CPU_INT32U     const  OSCfg_DataSizeRAM          = 0u
                                                  + sizeof(OSCfg_ISRStk)
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+                                                 + sizeof(OSCfg_IntQ)
+                                                 + sizeof(OSCfg_IntQTaskStk)
+#endif
+
 #if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
                                                  + sizeof(OSCfg_TickTaskStk)
 #endif
@@ -248,6 +272,16 @@ void  OSCfg_Init (void)
     (void)OSCfg_IdleTaskStkSizeRAM;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    (void)OSCfg_IntQBasePtr;
+    (void)OSCfg_IntQSize;
+    (void)OSCfg_IntQTaskPrio;
+    (void)OSCfg_IntQTaskStkBasePtr;
+    (void)OSCfg_IntQTaskStkLimit;
+    (void)OSCfg_IntQTaskStkSize;
+    (void)OSCfg_IntQTaskStkSizeRAM;
+#endif
+
     (void)OSCfg_ISRStkBasePtr;
     (void)OSCfg_ISRStkSize;
     (void)OSCfg_ISRStkSizeRAM;
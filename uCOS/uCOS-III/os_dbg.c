@@ -252,6 +252,27 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #endif
 #endif
 
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+                                  + sizeof(OSMutexPcpDbgListPtr)
+                                  + sizeof(OSMutexPcpQty)
+#endif
+#endif
+
+#if (OS_CFG_RING_EN == DEF_ENABLED)
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+                                  + sizeof(OSRingDbgListPtr)
+                                  + sizeof(OSRingQty)
+#endif
+#endif
+
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+                                  + sizeof(OSRWLockDbgListPtr)
+                                  + sizeof(OSRWLockQty)
+#endif
+#endif
+
 #if (OS_CFG_MEM_EN == DEF_ENABLED)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                                   + sizeof(OSMemDbgListPtr)
@@ -979,6 +979,20 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        OS_IntQPost(OS_OBJ_TYPE_FLAG,                           /* Post to ISR queue                                    */
+                    (void *)p_grp,
+                    (void *)0,
+                    0u,
+                    flags,
+                    opt,
+                    p_err);
+        OS_TRACE_FLAG_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
@@ -41,12 +41,22 @@ const  CPU_CHAR  *os_int__c = "$Id: $";
 
 
 #if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                 LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_IntQClaim (CPU_INT32U  in);
+
+
 /*
 ************************************************************************************************************************
 *                                                   POST TO ISR QUEUE
 *
-* Description: This function places contents of posts into an intermediate queue to help defer processing of interrupts
-*              at the task level.
+* Description: This function is called by the post services when they are called from an ISR.  The post is saved in
+*              the ISR queue and is carried out later by the ISR handler task, so the ISR does not walk pend lists or
+*              touch the ready list with interrupts disabled.
 *
 * Arguments  : type       is the type of kernel object the post is destined to:
 *
@@ -55,9 +65,10 @@ const  CPU_CHAR  *os_int__c = "$Id: $";
 *                             OS_OBJ_TYPE_FLAG
 *                             OS_OBJ_TYPE_TASK_MSG
 *                             OS_OBJ_TYPE_TASK_SIGNAL
+*                             OS_OBJ_TYPE_RING
 *
 *              p_obj      is a pointer to the kernel object to post to.  This can be a pointer to a semaphore,
-*              -----      a message queue or a task control clock.
+*              -----      a message queue, an event flag group, a ring or a task control block.
 *
 *              p_void     is a pointer to a message that is being posted.  This is used when posting to a message
 *                         queue or directly to a task.
@@ -67,14 +78,13 @@ const  CPU_CHAR  *os_int__c = "$Id: $";
 *              flags      if the post is done to an event flag group then this corresponds to the flags being
 *                         posted
 *
-*              ts         is a timestamp as to when the post was done
-*
 *              opt        this corresponds to post options and applies to:
 *
 *                             OSFlagPost()
 *                             OSSemPost()
 *                             OSQPost()
 *                             OSTaskQPost()
+*                             OSTaskSemPost()
 *
 *              p_err      is a pointer to a variable that will contain an error code returned by this function.
 *
@@ -85,9 +95,18 @@ const  CPU_CHAR  *os_int__c = "$Id: $";
 *
 * Returns    : none
 *
-* Note(s)    : 1) This function is DEPRECATED and is not recommended for new designs. Deferred ISRs is a deprecated
-*                 feature of the kernel. It remains fully functional and supported but should not be used for
-*                 new applications.
+* Note(s)    : 1) The ISR queue is a ring of OS_CFG_INT_Q_SIZE entries indexed by two free running counters.  ISRs are
+*                 the producers, they may nest, and claim an entry by advancing OSIntQInCtr, see OS_IntQClaim().  The
+*                 ISR handler task is the only consumer and advances OSIntQOutCtr once an entry has been re-posted.
+*
+*              2) The ISR handler task runs at task level so every ISR that claimed an entry has finished filling it
+*                 by the time the task reads it.
+*
+*              3) Only the first post after the ISR handler task started draining signals the task, a burst of posts
+*                 costs a single OSTaskSemPost().
+*
+*              4) Errors detected when the post is carried out (OS_ERR_SEM_OVF, OS_ERR_Q_MAX, ...) are not returned to
+*                 the ISR.
 ************************************************************************************************************************
 */
 
@@ -97,51 +116,75 @@ void  OS_IntQPost (OS_OBJ_TYPE   type,
                    OS_MSG_SIZE   msg_size,
                    OS_FLAGS      flags,
                    OS_OPT        opt,
-                   CPU_TS        ts,
                    OS_ERR       *p_err)
 {
+    OS_INT_Q    *p_int_q;
+    CPU_INT32U   in;
     CPU_SR_ALLOC();
 
 
-#if (OS_CFG_TS_EN == DEF_DISABLED)
-    (void)ts;                                                   /* Prevent compiler warning for not using 'ts'          */
-#endif
-
-    CPU_CRITICAL_ENTER();
-    if (OSIntQNbrEntries < OSCfg_IntQSize) {                    /* Make sure we haven't already filled the ISR queue    */
-        OSIntQNbrEntries++;
-
-        if (OSIntQNbrEntriesMax < OSIntQNbrEntries) {
-            OSIntQNbrEntriesMax = OSIntQNbrEntries;
+    do {
+        in = OSIntQInCtr;
+        if ((in - OSIntQOutCtr) >= (CPU_INT32U)OSCfg_IntQSize) {/* Make sure we haven't already filled the ISR queue    */
+            CPU_CRITICAL_ENTER();
+            OSIntQOvfCtr++;                                     /* Count the number of ISR queue overflows              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_INT_Q_FULL;
+            return;
         }
+    } while (OS_IntQClaim(in) == DEF_FALSE);                    /* Retry if a nested ISR claimed the entry first        */
+
+    p_int_q          = &OSCfg_IntQBasePtr[in & ((CPU_INT32U)OSCfg_IntQSize - 1u)];
+    p_int_q->Type    = type;                                    /* Save object type being posted                        */
+    p_int_q->ObjPtr  = p_obj;                                   /* Save pointer to object being posted                  */
+    p_int_q->MsgPtr  = p_void;                                  /* Save pointer to message if posting to a message queue*/
+    p_int_q->MsgSize = msg_size;                                /* Save the message size   if posting to a message queue*/
+    p_int_q->Flags   = flags;                                   /* Save the flags if posting to an event flag group     */
+    p_int_q->Opt     = opt;                                     /* Save post options                                    */
+
+    if (OSIntQSignalPend == DEF_FALSE) {                        /* See Note #3                                          */
+        OSIntQSignalPend = DEF_TRUE;
+        (void)OSTaskSemPost(&OSIntQTaskTCB,                     /* Make the ISR handler task ready to run               */
+                             OS_OPT_POST_NONE,
+                             p_err);
+    }
+   *p_err = OS_ERR_NONE;
+}
 
-        OSIntQInPtr->Type       = type;                         /* Save object type being posted                        */
-        OSIntQInPtr->ObjPtr     = p_obj;                        /* Save pointer to object being posted                  */
-        OSIntQInPtr->MsgPtr     = p_void;                       /* Save pointer to message if posting to a message queue*/
-        OSIntQInPtr->MsgSize    = msg_size;                     /* Save the message size   if posting to a message queue*/
-        OSIntQInPtr->Flags      = flags;                        /* Save the flags if posting to an event flag group     */
-        OSIntQInPtr->Opt        = opt;                          /* Save post options                                    */
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-        OSIntQInPtr->TS         = ts;                           /* Save time stamp                                      */
-#endif
 
-        OSIntQInPtr             = OSIntQInPtr->NextPtr;         /* Point to the next interrupt handler queue entry      */
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-        OSRdyList[0].NbrEntries = 1u;                           /* Make the interrupt handler task ready to run         */
-#endif
-        OSRdyList[0].HeadPtr    = &OSIntQTaskTCB;
-        OSRdyList[0].TailPtr    = &OSIntQTaskTCB;
-        OS_PrioInsert(0u);                                      /* Add task priority 0 in the priority table            */
-        if (OSPrioCur != 0) {                                   /* Chk if OSIntQTask is not running                     */
-            OSPrioSaved         = OSPrioCur;                    /* Save current priority                                */
-        }
+/*
+************************************************************************************************************************
+*                                         SEE IF A TASK SIGNAL BYPASSES THE ISR QUEUE
+*
+* Description: This function is called by OSTaskSemPost() when it is called from an ISR.  The ISR handler task is
+*              signaled by the ISR queue itself, and the tick and timer tasks are signaled from every tick interrupt.
+*              Deferring those signals would add a trip through the ISR handler task to every tick.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task being signaled.
+*
+* Returns    : DEF_TRUE   if the task is signaled directly
+*              DEF_FALSE  if the signal goes through the ISR queue
+*
+* Note(s)    : 1) Signaling a task semaphore with no other pender is a constant time operation.
+************************************************************************************************************************
+*/
 
-       *p_err                   = OS_ERR_NONE;
-    } else {
-        OSIntQOvfCtr++;                                         /* Count the number of ISR queue overflows              */
-       *p_err                   = OS_ERR_INT_Q_FULL;
+CPU_BOOLEAN  OS_IntQSignalDirect (OS_TCB  *p_tcb)
+{
+    if (p_tcb == &OSIntQTaskTCB) {
+        return (DEF_TRUE);
     }
-    CPU_CRITICAL_EXIT();
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+    if (p_tcb == &OSTickTaskTCB) {
+        return (DEF_TRUE);
+    }
+#endif
+#if (OS_CFG_TMR_EN == DEF_ENABLED)
+    if (p_tcb == &OSTmrTaskTCB) {
+        return (DEF_TRUE);
+    }
+#endif
+    return (DEF_FALSE);
 }
 
 
@@ -149,138 +192,81 @@ void  OS_IntQPost (OS_OBJ_TYPE   type,
 ************************************************************************************************************************
 *                                               RE-POST FROM ISR QUEUE
 *
-* Description: This function takes contents of posts from an intermediate queue to help defer processing of interrupts
-*              at the task level.
+* Description: This function carries out a post saved in the ISR queue by calling the post service it was destined to.
 *
-* Arguments  : none
+* Arguments  : p_int_q    is a pointer to the ISR queue entry to re-post.
 *
 * Returns    : none
 *
-* Note(s)    : 1) This function is DEPRECATED, see OS_IntQPost() note 1 for details.
+* Note(s)    : 1) The posts are made with OS_OPT_POST_NO_SCHED, OS_IntQTask() calls the scheduler once the queue is
+*                 empty.
 ************************************************************************************************************************
 */
 
-void  OS_IntQRePost (void)
+void  OS_IntQRePost (OS_INT_Q  *p_int_q)
 {
-#if (OS_CFG_TMR_EN == DEF_ENABLED)
-    CPU_TS  ts;
-#endif
+    OS_OPT  opt;
     OS_ERR  err;
 
 
-    switch (OSIntQOutPtr->Type) {                               /* Re-post to task                                      */
+    opt = p_int_q->Opt | OS_OPT_POST_NO_SCHED;                  /* See Note #1                                          */
+    switch (p_int_q->Type) {                                    /* Re-post to task                                      */
         case OS_OBJ_TYPE_FLAG:
 #if (OS_CFG_FLAG_EN == DEF_ENABLED)
-             (void)OS_FlagPost((OS_FLAG_GRP *) OSIntQOutPtr->ObjPtr,
-                                OSIntQOutPtr->Flags,
-                                OSIntQOutPtr->Opt,
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-                                OSIntQOutPtr->TS,
-#else
-                                0u,
-#endif
-                               &err);
+             (void)OSFlagPost((OS_FLAG_GRP *)p_int_q->ObjPtr,
+                               p_int_q->Flags,
+                               opt,
+                              &err);
 #endif
              break;
 
         case OS_OBJ_TYPE_Q:
 #if (OS_CFG_Q_EN == DEF_ENABLED)
-             OS_QPost((OS_Q *) OSIntQOutPtr->ObjPtr,
-                       OSIntQOutPtr->MsgPtr,
-                       OSIntQOutPtr->MsgSize,
-                       OSIntQOutPtr->Opt,
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-                        OSIntQOutPtr->TS,
-#else
-                        0u,
-#endif
-                      &err);
+             OSQPost((OS_Q *)p_int_q->ObjPtr,
+                      p_int_q->MsgPtr,
+                      p_int_q->MsgSize,
+                      opt,
+                     &err);
 #endif
              break;
 
         case OS_OBJ_TYPE_SEM:
 #if (OS_CFG_SEM_EN == DEF_ENABLED)
-             (void)OS_SemPost((OS_SEM *) OSIntQOutPtr->ObjPtr,
-                               OSIntQOutPtr->Opt,
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-                               OSIntQOutPtr->TS,
-#else
-                               0u,
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+             if (p_int_q->Flags != 0u) {                        /* Count from OSSemPostN()                              */
+                 (void)OSSemPostN((OS_SEM *)p_int_q->ObjPtr,
+                                  (OS_SEM_CTR)p_int_q->Flags,
+                                   opt,
+                                  &err);
+                 break;
+             }
 #endif
-                              &err);
+             (void)OSSemPost((OS_SEM *)p_int_q->ObjPtr,
+                              opt,
+                             &err);
 #endif
              break;
 
         case OS_OBJ_TYPE_TASK_MSG:
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
-             OS_TaskQPost((OS_TCB    *) OSIntQOutPtr->ObjPtr,
-                          (void      *) OSIntQOutPtr->MsgPtr,
-                           OSIntQOutPtr->MsgSize,
-                           OSIntQOutPtr->Opt,
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-                           OSIntQOutPtr->TS,
-#else
-                           0u,
-#endif
-                          &err);
-#endif
-             break;
-
-        case OS_OBJ_TYPE_TASK_RESUME:
-#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
-             (void)OS_TaskResume((OS_TCB *) OSIntQOutPtr->ObjPtr,
-                                 &err);
+             OSTaskQPost((OS_TCB *)p_int_q->ObjPtr,
+                          p_int_q->MsgPtr,
+                          p_int_q->MsgSize,
+                          opt,
+                         &err);
 #endif
              break;
 
         case OS_OBJ_TYPE_TASK_SIGNAL:
-             (void)OS_TaskSemPost((OS_TCB *) OSIntQOutPtr->ObjPtr,
-                                   OSIntQOutPtr->Opt,
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-                                   OSIntQOutPtr->TS,
-#else
-                                   0u,
-#endif
-                                  &err);
-             break;
-
-        case OS_OBJ_TYPE_TASK_SUSPEND:
-#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
-             (void)OS_TaskSuspend((OS_TCB *) OSIntQOutPtr->ObjPtr,
-                                  &err);
-#endif
+             (void)OSTaskSemPost((OS_TCB *)p_int_q->ObjPtr,
+                                  opt,
+                                 &err);
              break;
 
-        case OS_OBJ_TYPE_TICK:
-#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
-#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
-             OS_SchedRoundRobin(&OSRdyList[OSPrioSaved]);
-#endif
-
-             (void)OS_TaskSemPost((OS_TCB *)&OSTickTaskTCB,     /* Signal tick task                                     */
-                                   OS_OPT_POST_NONE,
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-                                   OSIntQOutPtr->TS,
-#else
-                                   0u,
-#endif
-                                  &err);
-#endif
-
-#if (OS_CFG_TMR_EN == DEF_ENABLED)
-             OSTmrUpdateCtr--;
-             if (OSTmrUpdateCtr == 0u) {
-                 OSTmrUpdateCtr = OSTmrUpdateCnt;
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-                 ts             = OS_TS_GET();                  /* Get timestamp                                        */
-#else
-                 ts             = 0u;
-#endif
-                 (void)OS_TaskSemPost(&OSTmrTaskTCB,            /* Signal timer task                                    */
-                                       OS_OPT_POST_NONE,
-                                       ts,
-                                      &err);
-             }
+        case OS_OBJ_TYPE_RING:                                  /* Element is in the ring, ready the consumer           */
+#if (OS_CFG_RING_EN == DEF_ENABLED)
+             OS_RingPost((OS_RING *)p_int_q->ObjPtr,
+                          opt);
 #endif
              break;
 
@@ -292,64 +278,51 @@ void  OS_IntQRePost (void)
 
 /*
 ************************************************************************************************************************
-*                                               INTERRUPT QUEUE MANAGEMENT TASK
+*                                                   ISR HANDLER TASK
 *
-* Description: This task is internal to uC/OS-III and is used to process the queue of deffered interrupts.
+* Description: This task is internal to uC/OS-III and carries out the posts that ISRs saved in the ISR queue.
 *
 * Arguments  : p_arg     is a pointer to an optional argument that is passed during task creation.  For this function
 *                        the argument is not used and will be a NULL pointer.
 *
 * Returns    : none
 *
-* Note(s)    : 1) This function is DEPRECATED, see OS_IntQPost() note 1 for details.
+* Note(s)    : 1) OSIntQSignalPend is cleared before the queue is read so a post that lands after the last entry was
+*                 taken signals the task again.  At worst the task wakes up once to an empty queue.
+*
+*              2) The whole burst is drained, including the posts made while draining, before the scheduler runs.
 ************************************************************************************************************************
 */
 
 void  OS_IntQTask (void  *p_arg)
 {
-    CPU_BOOLEAN  done;
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-    CPU_TS       ts_start;
-    CPU_TS       ts_end;
-#endif
-    CPU_SR_ALLOC();
-
+    CPU_INT32U  out;
+    CPU_INT32U  nbr;
+    OS_ERR      err;
 
 
     (void)p_arg;                                                /* Not using 'p_arg', prevent compiler warning          */
 
     while (DEF_ON) {
-        done = DEF_FALSE;
-        while (done == DEF_FALSE) {
-            CPU_CRITICAL_ENTER();
-            if (OSIntQNbrEntries == 0u) {
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-                OSRdyList[0].NbrEntries = 0u;                   /* Remove from ready list                               */
-#endif
-                OSRdyList[0].HeadPtr    = DEF_NULL;
-                OSRdyList[0].TailPtr    = DEF_NULL;
-                OS_PrioRemove(0u);                              /* Remove from the priority table                       */
-                CPU_CRITICAL_EXIT();
-                OSSched();
-                done = DEF_TRUE;                                /* No more entries in the queue, we are done            */
-            } else {
-                CPU_CRITICAL_EXIT();
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-                ts_start = OS_TS_GET();
-#endif
-                OS_IntQRePost();
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-                ts_end   = OS_TS_GET() - ts_start;              /* Measure execution time of tick task                  */
-                if (OSIntQTaskTimeMax < ts_end) {
-                    OSIntQTaskTimeMax = ts_end;
-                }
-#endif
-                CPU_CRITICAL_ENTER();
-                OSIntQOutPtr = OSIntQOutPtr->NextPtr;           /* Point to next item in the ISR queue                  */
-                OSIntQNbrEntries--;
-                CPU_CRITICAL_EXIT();
+        (void)OSTaskSemPend(0u,                                 /* Wait for an ISR to post                              */
+                            OS_OPT_PEND_BLOCKING,
+                            (CPU_TS *)0,
+                           &err);
+        OSIntQSignalPend = DEF_FALSE;                           /* See Note #1                                          */
+        CPU_MB();
+
+        out = OSIntQOutCtr;
+        nbr = OSIntQInCtr - out;
+        while (nbr > 0u) {                                      /* See Note #2                                          */
+            if (OSIntQNbrEntriesMax < nbr) {
+                OSIntQNbrEntriesMax = (OS_OBJ_QTY)nbr;
             }
+            OS_IntQRePost(&OSCfg_IntQBasePtr[out & ((CPU_INT32U)OSCfg_IntQSize - 1u)]);
+            out++;
+            OSIntQOutCtr = out;                                 /* Entry can be claimed again                           */
+            nbr          = OSIntQInCtr - out;
         }
+        OSSched();                                              /* Run the highest priority task made ready             */
     }
 }
 
@@ -358,70 +331,44 @@ void  OS_IntQTask (void  *p_arg)
 ************************************************************************************************************************
 *                                                 INITIALIZE THE ISR QUEUE
 *
-* Description: This function is called by OSInit() to initialize the ISR queue.
+* Description: This function is called by OSInit() to initialize the ISR queue and create the ISR handler task.
 *
 * Arguments  : p_err    is a pointer to a variable that will contain an error code returned by this function.
 *
-*                           OS_ERR_INT_Q             If you didn't provide an ISR queue in OS_CFG.C
-*                           OS_ERR_INT_Q_SIZE        If you didn't specify a large enough ISR queue.
-*                           OS_ERR_STK_INVALID       If you specified a NULL pointer for the task of the ISR task
-*                                                    handler
-*                           OS_ERR_STK_SIZE_INVALID  If you didn't specify a stack size greater than the minimum
-*                                                    specified by OS_CFG_STK_SIZE_MIN
-*                           OS_ERR_???               An error code returned by OSTaskCreate().
+*                           OS_ERR_INT_Q                   If you didn't provide an ISR queue in OS_CFG_APP.C
+*                           OS_ERR_INT_Q_SIZE              If the ISR queue size is not a power of 2 of at least 2
+*                           OS_ERR_INT_Q_STK_INVALID       If you specified a NULL pointer for the stack of the ISR
+*                                                          handler task
+*                           OS_ERR_INT_Q_STK_SIZE_INVALID  If you didn't specify a stack size greater than the minimum
+*                                                          specified by OS_CFG_STK_SIZE_MIN
+*                           OS_ERR_???                     An error code returned by OSTaskCreate().
 *
 * Returns    : none
 *
-* Note(s)    : 1) This function is DEPRECATED, see OS_IntQPost() note 1 for details.
+* Note(s)    : none
 ************************************************************************************************************************
 */
 
 void  OS_IntQTaskInit (OS_ERR  *p_err)
 {
-    OS_INT_Q      *p_int_q;
-    OS_INT_Q      *p_int_q_next;
-    OS_OBJ_QTY     i;
-
-
-    OSIntQOvfCtr = 0u;                                          /* Clear the ISR queue overflow counter                 */
+    OSIntQInCtr         = 0u;
+    OSIntQOutCtr        = 0u;
+    OSIntQSignalPend    = DEF_FALSE;
+    OSIntQNbrEntriesMax = 0u;
+    OSIntQOvfCtr        = 0u;                                   /* Clear the ISR queue overflow counter                 */
 
     if (OSCfg_IntQBasePtr == DEF_NULL) {
        *p_err = OS_ERR_INT_Q;
         return;
     }
 
-    if (OSCfg_IntQSize < 2u) {
+    if ((OSCfg_IntQSize < 2u) ||
+        ((OSCfg_IntQSize & (OSCfg_IntQSize - 1u)) != 0u)) {
        *p_err = OS_ERR_INT_Q_SIZE;
         return;
     }
 
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-    OSIntQTaskTimeMax = 0u;
-#endif
-
-    p_int_q           = OSCfg_IntQBasePtr;                      /* Initialize the circular ISR queue                    */
-    p_int_q_next      = p_int_q;
-    p_int_q_next++;
-    for (i = 0u; i < OSCfg_IntQSize; i++) {
-        p_int_q->Type    =  OS_OBJ_TYPE_NONE;
-        p_int_q->ObjPtr  = DEF_NULL;
-        p_int_q->MsgPtr  = DEF_NULL;
-        p_int_q->MsgSize = 0u;
-        p_int_q->Flags   = 0u;
-        p_int_q->Opt     = 0u;
-        p_int_q->NextPtr = p_int_q_next;
-        p_int_q++;
-        p_int_q_next++;
-    }
-    p_int_q--;
-    p_int_q_next        = OSCfg_IntQBasePtr;
-    p_int_q->NextPtr    = p_int_q_next;
-    OSIntQInPtr         = p_int_q_next;
-    OSIntQOutPtr        = p_int_q_next;
-    OSIntQNbrEntries    = 0u;
-    OSIntQNbrEntriesMax = 0u;
-
-                                                                /* ------------ CREATE THE ISR QUEUE TASK ------------- */
+                                                                /* ------------ CREATE THE ISR HANDLER TASK ----------- */
     if (OSCfg_IntQTaskStkBasePtr == DEF_NULL) {
        *p_err = OS_ERR_INT_Q_STK_INVALID;
         return;
@@ -436,7 +383,7 @@ void  OS_IntQTaskInit (OS_ERR  *p_err)
                  (CPU_CHAR   *)((void *)"uC/OS-III ISR Queue Task"),
                   OS_IntQTask,
                   DEF_NULL,
-                  0u,                                           /* This task is ALWAYS at priority '0' (i.e. highest)   */
+                  OSCfg_IntQTaskPrio,
                   OSCfg_IntQTaskStkBasePtr,
                   OSCfg_IntQTaskStkLimit,
                   OSCfg_IntQTaskStkSize,
@@ -447,4 +394,42 @@ void  OS_IntQTaskInit (OS_ERR  *p_err)
                   p_err);
 }
 
+
+/*
+************************************************************************************************************************
+*                                               CLAIM AN ISR QUEUE ENTRY
+*
+* Description: This function advances OSIntQInCtr from 'in' to 'in + 1' if no other ISR did it since 'in' was read.
+*
+* Arguments  : in       is the value of OSIntQInCtr read by the caller.
+*
+* Returns    : DEF_TRUE  if the entry 'in' now belongs to the caller.
+*              DEF_FALSE if a nested ISR claimed it first, the caller must read OSIntQInCtr again.
+*
+* Note(s)    : 1) OS_CPU_CAS32() is provided by ports that have an atomic compare and swap and then no interrupts are
+*                 disabled.  Other ports fall back to a critical section a few instructions long.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_IntQClaim (CPU_INT32U  in)
+{
+#ifdef OS_CPU_CAS32
+    return ((OS_CPU_CAS32(&OSIntQInCtr, in, in + 1u) != 0) ? DEF_TRUE : DEF_FALSE);
+#else
+    CPU_BOOLEAN  claimed;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OSIntQInCtr == in) {
+        OSIntQInCtr = in + 1u;
+        claimed     = DEF_TRUE;
+    } else {
+        claimed     = DEF_FALSE;
+    }
+    CPU_CRITICAL_EXIT();
+    return (claimed);
+#endif
+}
+
 #endif
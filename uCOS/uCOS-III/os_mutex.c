@@ -113,6 +113,9 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
     p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
     p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
     p_mutex->OwnerNestingCtr   =             0u;                /* Mutex is available                                   */
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    p_mutex->GrpLinked         =             DEF_FALSE;
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     p_mutex->TS                =             0u;
 #endif
@@ -348,7 +351,10 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_MUTEX_FAST_EN, a mutex that is free is taken by OS_MutexFastPend() without a critical
+*                 section and is not added to the owner's mutex group.  The first task to block on it adds it, so
+*                 priority inheritance is unchanged.  OSTaskDel() only releases the mutexes in the group, so a
+*                 task must not be deleted while it holds a mutex that no task has blocked on.
 ************************************************************************************************************************
 */
 
@@ -421,8 +427,22 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
     }
 #endif
 
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    if (OS_MutexFastPend(p_mutex) == DEF_TRUE) {                /* Free, taken without a critical section   See Note #1 */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_mutex->TS;
+        }
+#endif
+        OS_TRACE_MUTEX_PEND(p_mutex);
+        OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
-    if (p_mutex->OwnerNestingCtr == 0u) {                       /* Resource available?                                  */
+    if (p_mutex->OwnerTCBPtr == (OS_TCB *)0) {                  /* Resource available?                                  */
         p_mutex->OwnerTCBPtr     = OSTCBCurPtr;                 /* Yes, caller may proceed                              */
         p_mutex->OwnerNestingCtr = 1u;
 #if (OS_CFG_TS_EN == DEF_ENABLED)
@@ -486,6 +506,11 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
     }
 
     p_tcb = p_mutex->OwnerTCBPtr;                               /* Point to the TCB of the Mutex owner                  */
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    if (p_mutex->GrpLinked == DEF_FALSE) {                      /* Taken on the fast path, join the owner's group now   */
+        OS_MutexGrpAdd(p_tcb, p_mutex);
+    }
+#endif
     if (p_tcb->Prio > OSTCBCurPtr->Prio) {                      /* See if mutex owner has a lower priority than current */
         OS_TaskChangePrio(p_tcb, OSTCBCurPtr->Prio);
         OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
@@ -721,7 +746,8 @@ OS_OBJ_QTY  OSMutexPendAbort (OS_MUTEX  *p_mutex,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_MUTEX_FAST_EN, a mutex taken on the fast path that no task has blocked on is released
+*                 by OS_MutexFastPost() without a critical section.
 ************************************************************************************************************************
 */
 
@@ -791,6 +817,15 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     }
 #endif
 
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    if (OS_MutexFastPost(p_mutex) == DEF_TRUE) {                /* Nobody waiting, freed without a critical section     */
+        OS_TRACE_MUTEX_POST(p_mutex);
+        OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     if (OSTCBCurPtr != p_mutex->OwnerTCBPtr) {                  /* Make sure the mutex owner is releasing the mutex     */
         CPU_CRITICAL_EXIT();
@@ -889,6 +924,9 @@ void  OS_MutexClr (OS_MUTEX  *p_mutex)
     p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
     p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
     p_mutex->OwnerNestingCtr   =             0u;
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    p_mutex->GrpLinked         =             DEF_FALSE;
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     p_mutex->TS                =             0u;
 #endif
@@ -955,6 +993,87 @@ void  OS_MutexDbgListRemove (OS_MUTEX  *p_mutex)
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                             UNCONTENDED PEND AND POST
+*
+* Description: OS_MutexFastPend() takes a free mutex for the current task and OS_MutexFastPost() releases a mutex that
+*              the current task took with OS_MutexFastPend() and that no task has blocked on.  Neither disables
+*              interrupts.  When they return DEF_FALSE nothing was changed and the caller takes the regular path.
+*
+* Argument(s): p_mutex      is a pointer to the mutex.
+*
+* Returns    : DEF_TRUE     if the mutex was taken (OS_MutexFastPend()) or released (OS_MutexFastPost()).
+*              DEF_FALSE    otherwise.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The owner field is changed with an exclusive load and store, see OS_CPU_STREX_PTR().  The store
+*                 fails if anything ran since the load, so the fields read in between are those at the store.
+*                 Nothing is written between the two, a plain store may clear the monitor on some cores.
+*
+*              3) A mutex taken here is not added to the owner's group.  A task that blocks on it adds it while
+*                 the owner is preempted, and from then on the mutex is released by the regular path, which also
+*                 undoes the priority inheritance.
+*
+*              4) While the owner field is set the regular path treats the mutex as taken, whatever the nesting
+*                 counter holds.  OS_MutexFastPost() clears the counter before releasing the mutex so that a new
+*                 owner cannot see its own counter overwritten.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+CPU_BOOLEAN  OS_MutexFastPend (OS_MUTEX  *p_mutex)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = OSTCBCurPtr;
+    do {
+        if (OS_CPU_LDREX_PTR(&p_mutex->OwnerTCBPtr) != (void *)0) {
+            OS_CPU_CLREX();                                     /* Owned, maybe by the caller: take the regular path    */
+            return (DEF_FALSE);
+        }
+    } while (OS_CPU_STREX_PTR(&p_mutex->OwnerTCBPtr, p_tcb) == 0u);
+
+    p_mutex->OwnerNestingCtr = 1u;                              /* See Note #4                                          */
+    return (DEF_TRUE);
+}
+
+
+CPU_BOOLEAN  OS_MutexFastPost (OS_MUTEX  *p_mutex)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = OSTCBCurPtr;
+    if ((p_mutex->OwnerTCBPtr     != p_tcb)    ||               /* Not the owner, nested, or in the owner's group       */
+        (p_mutex->OwnerNestingCtr != 1u)       ||
+        (p_mutex->GrpLinked       == DEF_TRUE)) {
+        return (DEF_FALSE);
+    }
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_mutex->TS              = OS_TS_GET();                     /* Get timestamp                                        */
+#endif
+    p_mutex->OwnerNestingCtr = 0u;                              /* See Note #4                                          */
+    do {
+        if (OS_CPU_LDREX_PTR(&p_mutex->OwnerTCBPtr) != (void *)p_tcb) {
+            OS_CPU_CLREX();                                     /* Mutex was deleted meanwhile                          */
+            return (DEF_FALSE);
+        }
+        if (p_mutex->GrpLinked == DEF_TRUE) {                   /* A task blocked on it meanwhile                       */
+            OS_CPU_CLREX();
+            p_mutex->OwnerNestingCtr = 1u;
+            return (DEF_FALSE);
+        }
+    } while (OS_CPU_STREX_PTR(&p_mutex->OwnerTCBPtr, (OS_TCB *)0) == 0u);
+
+    return (DEF_TRUE);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               MUTEX GROUP ADD
@@ -977,6 +1096,9 @@ void  OS_MutexGrpAdd (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 {
     p_mutex->MutexGrpNextPtr = p_tcb->MutexGrpHeadPtr;      /* The mutex grp is not sorted add to head of list.       */
     p_tcb->MutexGrpHeadPtr   = p_mutex;
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    p_mutex->GrpLinked       = DEF_TRUE;
+#endif
 }
 
 
@@ -995,6 +1117,8 @@ void  OS_MutexGrpAdd (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_MUTEX_FAST_EN, a mutex that is not in the group is left alone.
 ************************************************************************************************************************
 */
 
@@ -1002,6 +1126,13 @@ void  OS_MutexGrpRemove (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 {
     OS_MUTEX  **pp_mutex;
 
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    if (p_mutex->GrpLinked == DEF_FALSE) {                  /* Taken on the fast path, never joined the group         */
+        return;
+    }
+    p_mutex->GrpLinked = DEF_FALSE;
+#endif
+
     pp_mutex = &p_tcb->MutexGrpHeadPtr;
 
     while(*pp_mutex != p_mutex) {
@@ -1025,6 +1156,9 @@ void  OS_MutexGrpRemove (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 * Returns    : Highest priority pending or OS_CFG_PRIO_MAX - 1u if none found.
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_MUTEX_PCP_EN, the search starts from the ceiling of the priority ceiling mutexes the task
+*                 holds, so a task that stops inheriting a priority does not drop below that ceiling.
 ************************************************************************************************************************
 */
 
@@ -1036,7 +1170,11 @@ OS_PRIO  OS_MutexGrpPrioFindHighest (OS_TCB  *p_tcb)
     OS_TCB     *p_head;
 
 
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)
+    highest_prio = p_tcb->CeilingPrio;                          /* See Note #2                                          */
+#else
     highest_prio = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
+#endif
     pp_mutex = &p_tcb->MutexGrpHeadPtr;
 
     while(*pp_mutex != (OS_MUTEX *)0) {
@@ -0,0 +1,868 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                         PRIORITY CEILING MUTEX MANAGEMENT
+*
+* File    : OS_MUTEX_PCP.C
+* Version : V3.08.00
+*
+* A priority ceiling mutex is given, when it is created, the priority of the highest priority task that will ever take
+* it.  The task that takes it is raised to that ceiling at once (immediate priority ceiling protocol), so no task that
+* also uses the mutex can preempt the owner.  Raising and restoring the owner's priority are O(1): the mutexes a task
+* holds form a stack and each one keeps the ceiling the owner had before it, nothing is searched.
+*
+* When a task releases its mutexes in the reverse order it took them and does not block while it holds one, a task is
+* blocked by at most one critical section of a lower priority task and the mutexes cannot deadlock.  The release order
+* is enforced, a task that must wait for something else while it holds a mutex should use OS_MUTEX instead.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_mutex_pcp__c = "$Id: $";
+#endif
+
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_MutexPcpTake    (OS_MUTEX_PCP  *p_mutex,
+                                  OS_TCB        *p_tcb);
+
+static  void  OS_MutexPcpRelease (OS_MUTEX_PCP  *p_mutex,
+                                  OS_TCB        *p_tcb);
+
+
+/*
+************************************************************************************************************************
+*                                           CREATE A PRIORITY CEILING MUTEX
+*
+* Description: This function creates a mutex that raises its owner to a fixed ceiling priority.
+*
+* Arguments  : p_mutex       is a pointer to the mutex to initialize.  Your application is responsible for allocating
+*                            storage for the mutex.
+*
+*              p_name        is a pointer to the name you would like to give the mutex.
+*
+*              ceiling       is the priority of the highest priority task that will take the mutex.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the mutex after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_mutex' is a NULL pointer
+*                                OS_ERR_PRIO_INVALID            If 'ceiling' is the idle task's priority or lower
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSMutexPcpCreate (OS_MUTEX_PCP  *p_mutex,
+                        CPU_CHAR      *p_name,
+                        OS_PRIO        ceiling,
+                        OS_ERR        *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mutex == (OS_MUTEX_PCP *)0) {                         /* Validate 'p_mutex'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    if (ceiling >= (OS_CFG_PRIO_MAX - 1u)) {                    /* Cannot raise a task to the idle task's priority      */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_mutex->Type            =  OS_OBJ_TYPE_MUTEX_PCP;          /* Mark the data structure as a ceiling mutex           */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_mutex->NamePtr         =  p_name;
+#else
+    (void)p_name;
+#endif
+    p_mutex->StkNextPtr      = (OS_MUTEX_PCP *)0;
+    p_mutex->OwnerTCBPtr     = (OS_TCB       *)0;
+    p_mutex->OwnerNestingCtr =                 0u;              /* Mutex is available                                   */
+    p_mutex->Ceiling         =  ceiling;
+    p_mutex->CeilingPrev     = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_mutex->TS              =                 0u;
+#endif
+    OS_PendListInit(&p_mutex->PendList);                        /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_MutexPcpDbgListAdd(p_mutex);
+    OSMutexPcpQty++;
+#endif
+
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           DELETE A PRIORITY CEILING MUTEX
+*
+* Description: This function deletes a priority ceiling mutex and readies all tasks pending on it.
+*
+* Arguments  : p_mutex       is a pointer to the mutex to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete mutex ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the mutex even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the mutex was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the mutex from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the mutex after you called
+*                                                                 OSStart()
+*                                OS_ERR_MUTEX_ORDER             If the owner took another mutex after this one
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_mutex' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_mutex' is not pointing to a ceiling mutex
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            One or more tasks were waiting on the mutex
+*
+* Returns    : == 0          if no tasks were waiting on the mutex, or upon error.
+*              >  0          if one or more tasks waiting on the mutex are now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of the mutex MUST
+*                 check the return code of OSMutexPcpPend().
+*
+*              2) A mutex that is owned is released for its owner, in the same order OSMutexPcpPost() requires.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_DEL_EN == DEF_ENABLED)
+OS_OBJ_QTY  OSMutexPcpDel (OS_MUTEX_PCP  *p_mutex,
+                           OS_OPT         opt,
+                           OS_ERR        *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb_owner;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a mutex from an ISR            */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mutex == (OS_MUTEX_PCP *)0) {                         /* Validate 'p_mutex'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_DEL_NO_PEND:
+        case OS_OPT_DEL_ALWAYS:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mutex->Type != OS_OBJ_TYPE_MUTEX_PCP) {               /* Make sure mutex was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_mutex->PendList;
+    p_tcb_owner =  p_mutex->OwnerTCBPtr;
+    if ((p_tcb_owner != (OS_TCB *)0) &&                         /* Owner must release it last in, first out  See Note #2*/
+        (p_tcb_owner->MutexPcpHeadPtr != p_mutex)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_ORDER;
+        return (0u);
+    }
+
+    nbr_tasks = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete mutex only if no task waiting                 */
+             if (p_pend_list->HeadPtr != (OS_TCB *)0) {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+                 return (0u);
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the mutex                              */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             ts = OS_TS_GET();                                  /* Get timestamp                                        */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
+                 OS_PendAbort(p_pend_list->HeadPtr,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_MutexPcpDbgListRemove(p_mutex);
+    OSMutexPcpQty--;
+#endif
+    if (p_tcb_owner != (OS_TCB *)0) {                           /* Does the mutex belong to a task?                     */
+        OS_MutexPcpRelease(p_mutex, p_tcb_owner);               /* Yes, drop the owner back from the ceiling            */
+    }
+    OS_MutexPcpClr(p_mutex);
+    CPU_CRITICAL_EXIT();
+
+    if ((nbr_tasks > 0u) ||
+        (p_tcb_owner != (OS_TCB *)0)) {
+        OSSched();                                              /* Find highest priority task ready to run              */
+    }
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          PEND ON A PRIORITY CEILING MUTEX
+*
+* Description: This function waits for a priority ceiling mutex.  The caller runs at the mutex ceiling, or higher,
+*              until it releases it.
+*
+* Arguments  : p_mutex       is a pointer to the mutex
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            resource up to the amount of time (in 'ticks') specified by this argument.  If you specify
+*                            0, however, your task will wait forever at the specified mutex or, until the resource
+*                            becomes available.
+*
+*              opt           determines whether the user wants to block if the mutex is not available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the mutex was posted or
+*                            pend aborted or the mutex deleted.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you
+*                            will not get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task owns the resource
+*                                OS_ERR_MUTEX_CEILING      If the caller's priority is higher than the mutex ceiling
+*                                OS_ERR_MUTEX_OWNER        If calling task already owns the mutex
+*                                OS_ERR_MUTEX_OVF          Mutex nesting counter overflowed
+*                                OS_ERR_OBJ_DEL            If 'p_mutex' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_mutex' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_mutex' is not pointing at a ceiling mutex
+*                                OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the mutex was not
+*                                                          available
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            The mutex was not received within the specified timeout
+*
+* Returns    : none
+*
+* Note(s)    : 1) A free mutex is taken without calling the scheduler.  Raising the caller cannot make another task
+*                 more eligible to run than the caller already is.
+*
+*              2) The mutex is only found owned when its owner blocked while holding it, or when the caller's priority
+*                 is above the ceiling.  The waiter does not lend its priority to the owner.
+************************************************************************************************************************
+*/
+
+void  OSMutexPcpPend (OS_MUTEX_PCP  *p_mutex,
+                      OS_TICK        timeout,
+                      OS_OPT         opt,
+                      CPU_TS        *p_ts,
+                      OS_ERR        *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN == DEF_DISABLED)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mutex == (OS_MUTEX_PCP *)0) {                         /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mutex->Type != OS_OBJ_TYPE_MUTEX_PCP) {               /* Make sure mutex was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OSTCBCurPtr->BasePrio < p_mutex->Ceiling) {             /* Caller must not be above the ceiling                 */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_CEILING;
+        return;
+    }
+
+    if (p_mutex->OwnerTCBPtr == (OS_TCB *)0) {                  /* Resource available?                                  */
+        OS_MutexPcpTake(p_mutex, OSTCBCurPtr);                  /* Yes, caller may proceed at the ceiling  See Note #1  */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_mutex->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if (OSTCBCurPtr == p_mutex->OwnerTCBPtr) {                  /* See if current task is already the owner of the mutex*/
+        if (p_mutex->OwnerNestingCtr == (OS_NESTING_CTR)-1) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_MUTEX_OVF;
+            return;
+        }
+        p_mutex->OwnerNestingCtr++;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_mutex->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_OWNER;                             /* Indicate that current task already owns the mutex    */
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = 0u;
+        }
+#endif
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return;
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+            if (p_ts != (CPU_TS *)0) {
+               *p_ts = 0u;
+            }
+#endif
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+
+    OS_Pend((OS_PEND_OBJ *)((void *)p_mutex),                   /* Block task pending on Mutex              See Note #2 */
+             OS_TASK_PEND_ON_MUTEX_PCP,
+             timeout);
+
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* We got the mutex, OSMutexPcpPost() raised us         */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get mutex within timeout     */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = 0u;
+             }
+#endif
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                          POST TO A PRIORITY CEILING MUTEX
+*
+* Description: This function releases a priority ceiling mutex and drops the caller back from its ceiling.
+*
+* Arguments  : p_mutex       is a pointer to the mutex
+*
+*              opt           is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                                OS_OPT_POST_NONE        No special option selected
+*                                OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the mutex was signaled
+*                                OS_ERR_MUTEX_NESTING      Mutex owner nested its use of the mutex
+*                                OS_ERR_MUTEX_NOT_OWNER    If the task posting is not the Mutex owner
+*                                OS_ERR_MUTEX_ORDER        If the caller took another ceiling mutex after this one
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_mutex' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_mutex' is not pointing at a ceiling mutex
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_POST_ISR           If you attempted to post from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) Ceiling mutexes are released in the reverse order they were taken, so the caller's previous ceiling
+*                 is the one saved in the mutex.  A mutex released out of order is left owned.
+*
+*              2) A waiting task is handed the mutex and raised to the ceiling before it runs.
+************************************************************************************************************************
+*/
+
+void  OSMutexPcpPost (OS_MUTEX_PCP  *p_mutex,
+                      OS_OPT         opt,
+                      OS_ERR        *p_err)
+{
+    OS_TCB  *p_tcb;
+    CPU_TS   ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mutex == (OS_MUTEX_PCP *)0) {                         /* Validate 'p_mutex'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mutex->Type != OS_OBJ_TYPE_MUTEX_PCP) {               /* Make sure mutex was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OSTCBCurPtr != p_mutex->OwnerTCBPtr) {                  /* Make sure the mutex owner is releasing the mutex     */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_NOT_OWNER;
+        return;
+    }
+
+    if (p_mutex->OwnerNestingCtr > 1u) {                        /* Are we done with all nestings?                       */
+        p_mutex->OwnerNestingCtr--;                             /* No                                                   */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_NESTING;
+        return;
+    }
+
+    if (OSTCBCurPtr->MutexPcpHeadPtr != p_mutex) {              /* Released in reverse order?               See Note #1 */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_ORDER;
+        return;
+    }
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts          = OS_TS_GET();                                  /* Get timestamp                                        */
+    p_mutex->TS = ts;
+#else
+    ts          = 0u;
+#endif
+    OS_MutexPcpRelease(p_mutex, OSTCBCurPtr);                   /* Drop back from the ceiling                           */
+
+    p_tcb = p_mutex->PendList.HeadPtr;
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any task waiting on mutex?                           */
+        p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* No                                                   */
+        p_mutex->OwnerNestingCtr =           0u;
+    } else {
+        OS_Post((OS_PEND_OBJ *)((void *)p_mutex),               /* Yes, give mutex to the highest priority waiter       */
+                               p_tcb,
+                               (void *)0,
+                               0u,
+                               ts);
+        OS_MutexPcpTake(p_mutex, p_tcb);                        /* ... at the ceiling                       See Note #2 */
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                     CLEAR THE CONTENTS OF A PRIORITY CEILING MUTEX
+*
+* Description: This function is called by OSMutexPcpDel() to clear the contents of a mutex
+*
+* Argument(s): p_mutex      is a pointer to the mutex to clear
+*              -------
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_MutexPcpClr (OS_MUTEX_PCP  *p_mutex)
+{
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_mutex->Type            =  OS_OBJ_TYPE_NONE;               /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_mutex->NamePtr         = (CPU_CHAR *)((void *)"?MUTEX");
+#endif
+    p_mutex->StkNextPtr      = (OS_MUTEX_PCP *)0;
+    p_mutex->OwnerTCBPtr     = (OS_TCB       *)0;
+    p_mutex->OwnerNestingCtr =                 0u;
+    p_mutex->CeilingPrev     = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_mutex->TS              =                 0u;
+#endif
+    OS_PendListInit(&p_mutex->PendList);                        /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                    ADD/REMOVE CEILING MUTEX TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a ceiling mutex to/from the debug list.
+*
+* Arguments  : p_mutex     is a pointer to the mutex to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void  OS_MutexPcpDbgListAdd (OS_MUTEX_PCP  *p_mutex)
+{
+    p_mutex->DbgNamePtr                  = (CPU_CHAR *)((void *)" ");
+    p_mutex->DbgPrevPtr                  = (OS_MUTEX_PCP *)0;
+    if (OSMutexPcpDbgListPtr == (OS_MUTEX_PCP *)0) {
+        p_mutex->DbgNextPtr              = (OS_MUTEX_PCP *)0;
+    } else {
+        p_mutex->DbgNextPtr              =  OSMutexPcpDbgListPtr;
+        OSMutexPcpDbgListPtr->DbgPrevPtr =  p_mutex;
+    }
+    OSMutexPcpDbgListPtr                 =  p_mutex;
+}
+
+
+void  OS_MutexPcpDbgListRemove (OS_MUTEX_PCP  *p_mutex)
+{
+    OS_MUTEX_PCP  *p_mutex_next;
+    OS_MUTEX_PCP  *p_mutex_prev;
+
+
+    p_mutex_prev = p_mutex->DbgPrevPtr;
+    p_mutex_next = p_mutex->DbgNextPtr;
+
+    if (p_mutex_prev == (OS_MUTEX_PCP *)0) {
+        OSMutexPcpDbgListPtr = p_mutex_next;
+        if (p_mutex_next != (OS_MUTEX_PCP *)0) {
+            p_mutex_next->DbgPrevPtr = (OS_MUTEX_PCP *)0;
+        }
+        p_mutex->DbgNextPtr = (OS_MUTEX_PCP *)0;
+
+    } else if (p_mutex_next == (OS_MUTEX_PCP *)0) {
+        p_mutex_prev->DbgNextPtr = (OS_MUTEX_PCP *)0;
+        p_mutex->DbgPrevPtr      = (OS_MUTEX_PCP *)0;
+
+    } else {
+        p_mutex_prev->DbgNextPtr =  p_mutex_next;
+        p_mutex_next->DbgPrevPtr =  p_mutex_prev;
+        p_mutex->DbgNextPtr      = (OS_MUTEX_PCP *)0;
+        p_mutex->DbgPrevPtr      = (OS_MUTEX_PCP *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           CEILING MUTEX POST ALL
+*
+* Description: This function is called by the kernel to release all the ceiling mutexes a task holds.  Used when
+*              deleting a task.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the task to process.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The task is being deleted, its priority is not restored.
+************************************************************************************************************************
+*/
+
+void  OS_MutexPcpPostAll (OS_TCB  *p_tcb)
+{
+    OS_MUTEX_PCP  *p_mutex;
+    OS_TCB        *p_tcb_new;
+    CPU_TS         ts;
+
+
+    while (p_tcb->MutexPcpHeadPtr != (OS_MUTEX_PCP *)0) {
+        p_mutex                = p_tcb->MutexPcpHeadPtr;
+        p_tcb->MutexPcpHeadPtr = p_mutex->StkNextPtr;           /* Pop the mutex                            See Note #2 */
+        p_tcb->CeilingPrio     = p_mutex->CeilingPrev;
+        p_mutex->StkNextPtr    = (OS_MUTEX_PCP *)0;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        ts                     = OS_TS_GET();                   /* Get timestamp                                        */
+        p_mutex->TS            = ts;
+#else
+        ts                     = 0u;
+#endif
+        p_tcb_new = p_mutex->PendList.HeadPtr;
+        if (p_tcb_new == (OS_TCB *)0) {                         /* Any task waiting on mutex?                           */
+            p_mutex->OwnerTCBPtr     = (OS_TCB *)0;             /* No                                                   */
+            p_mutex->OwnerNestingCtr =           0u;
+        } else {
+            OS_Post((OS_PEND_OBJ *)((void *)p_mutex),           /* Yes, give mutex to the highest priority waiter       */
+                                   p_tcb_new,
+                                   (void *)0,
+                                   0u,
+                                   ts);
+            OS_MutexPcpTake(p_mutex, p_tcb_new);
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                     TAKE OR RELEASE A CEILING MUTEX FOR A TASK
+*
+* Description: OS_MutexPcpTake() makes 'p_tcb' the owner of a free mutex, pushes the mutex on the task's stack and
+*              raises the task to the ceiling.  OS_MutexPcpRelease() pops the mutex at the top of the owner's stack and
+*              drops the owner back to the highest of its base priority, the ceiling of the mutexes it still holds and
+*              the priority it inherits from OS_MUTEX waiters.
+*
+* Argument(s): p_mutex      is a pointer to the mutex
+*
+*              p_tcb        is a pointer to the tcb of the task taking or releasing it
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) Called with interrupts disabled.  Neither one searches a list of mutexes or tasks, beyond the
+*                 OS_MUTEX group of a task that also holds priority inheritance mutexes.
+*
+*              3) OSPrioCur is kept up to date for the running task, as OSMutexPost() does, since the scheduler may not
+*                 run before the next round robin tick.
+************************************************************************************************************************
+*/
+
+static  void  OS_MutexPcpTake (OS_MUTEX_PCP  *p_mutex,
+                               OS_TCB        *p_tcb)
+{
+    p_mutex->OwnerTCBPtr     = p_tcb;
+    p_mutex->OwnerNestingCtr = 1u;
+    p_mutex->CeilingPrev     = p_tcb->CeilingPrio;              /* Push the mutex on the owner's stack                  */
+    p_mutex->StkNextPtr      = p_tcb->MutexPcpHeadPtr;
+    p_tcb->MutexPcpHeadPtr   = p_mutex;
+    if (p_mutex->Ceiling < p_tcb->CeilingPrio) {
+        p_tcb->CeilingPrio = p_mutex->Ceiling;
+    }
+
+    if (p_mutex->Ceiling < p_tcb->Prio) {                       /* Raise the owner to the ceiling                       */
+        OS_TaskChangePrio(p_tcb, p_mutex->Ceiling);
+        if (p_tcb == OSTCBCurPtr) {
+            OSPrioCur = p_mutex->Ceiling;                       /*                                          See Note #3 */
+        }
+    }
+}
+
+
+static  void  OS_MutexPcpRelease (OS_MUTEX_PCP  *p_mutex,
+                                  OS_TCB        *p_tcb)
+{
+    OS_PRIO  prio_new;
+
+
+    p_tcb->MutexPcpHeadPtr = p_mutex->StkNextPtr;               /* Pop the mutex, restore the previous ceiling          */
+    p_tcb->CeilingPrio     = p_mutex->CeilingPrev;
+    p_mutex->StkNextPtr    = (OS_MUTEX_PCP *)0;
+
+    if (p_tcb->Prio != p_tcb->BasePrio) {                       /* Was the owner raised?                                */
+        prio_new = OS_MutexGrpPrioFindHighest(p_tcb);           /* Yes, includes the remaining ceiling                  */
+        prio_new = (prio_new > p_tcb->BasePrio) ? p_tcb->BasePrio : prio_new;
+        if (prio_new != p_tcb->Prio) {
+            OS_TaskChangePrio(p_tcb, prio_new);
+            if (p_tcb == OSTCBCurPtr) {
+                OSPrioCur = prio_new;                           /*                                          See Note #3 */
+            }
+        }
+    }
+}
+#endif
@@ -44,6 +44,10 @@ CPU_DATA   OSPrioTbl[OS_PRIO_TBL_SIZE];                         /* Declare the a
                                                                 /* ... optimization.  In other words, this allows the ...*/
                                                                 /* ... table to be located in fast memory                */
 
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+CPU_DATA   OSPrioGrp;                                           /* Summary bitmap, bit 'ix' set when OSPrioTbl[ix] != 0 */
+#endif
+
 /*
 ************************************************************************************************************************
 *                                               INITIALIZE THE PRIORITY LIST
@@ -67,6 +71,9 @@ void  OS_PrioInit (void)
     for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
          OSPrioTbl[i] = 0u;
     }
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    OSPrioGrp = 0u;
+#endif
 
 #if (OS_CFG_TASK_IDLE_EN == DEF_DISABLED)
     OS_PrioInsert ((OS_PRIO)(OS_CFG_PRIO_MAX - 1u));            /* Insert what would be the idle task                   */
@@ -85,24 +92,28 @@ void  OS_PrioInit (void)
 * Returns    : The priority of the Highest Priority Task (HPT) waiting for the event
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When OS_CFG_PRIO_MAX exceeds the number of bits in a CPU_DATA, OSPrioGrp holds one bit per entry
+*                 of OSPrioTbl[].  The lookup is then two count leading zeros operations regardless of how many
+*                 priorities are configured, instead of a scan of the table.
 ************************************************************************************************************************
 */
 
 OS_PRIO  OS_PrioGetHighest (void)
 {
-    CPU_DATA  *p_tbl;
     OS_PRIO    prio;
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    OS_PRIO    ix;
 
 
-    prio  = 0u;
-    p_tbl = &OSPrioTbl[0];
-#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
-    while (*p_tbl == 0u) {                                      /* Search the bitmap table for the highest priority     */
-        prio += (OS_PRIO)DEF_INT_CPU_NBR_BITS;                  /* Compute the step of each CPU_DATA entry              */
-        p_tbl++;
-    }
+    ix    = (OS_PRIO)CPU_CntLeadZeros(OSPrioGrp);               /* Find the first non-empty entry of the bitmap table   */
+    prio  = ix * (OS_PRIO)DEF_INT_CPU_NBR_BITS;                 /* Compute the step of each CPU_DATA entry              */
+    prio += (OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[ix]);           /* Find the position of the first bit set at the entry  */
+#else
+
+
+    prio  = (OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[0]);            /* Find the position of the first bit set               */
 #endif
-    prio += (OS_PRIO)CPU_CntLeadZeros(*p_tbl);                  /* Find the position of the first bit set at the entry  */
 
     return (prio);
 }
@@ -137,6 +148,11 @@ void  OS_PrioInsert (OS_PRIO  prio)
     bit            = 1u;
     bit          <<= (DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr;
     OSPrioTbl[ix] |= bit;
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    bit            = 1u;
+    bit          <<= (DEF_INT_CPU_NBR_BITS - 1u) - (CPU_DATA)ix;
+    OSPrioGrp     |= bit;                                       /* Entry 'ix' now has at least one ready priority       */
+#endif
 }
 
 /*
@@ -169,4 +185,11 @@ void  OS_PrioRemove (OS_PRIO  prio)
     bit            = 1u;
     bit          <<= (DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr;
     OSPrioTbl[ix] &= ~bit;
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    if (OSPrioTbl[ix] == 0u) {                                  /* Clear the summary bit when the entry becomes empty   */
+        bit            = 1u;
+        bit          <<= (DEF_INT_CPU_NBR_BITS - 1u) - (CPU_DATA)ix;
+        OSPrioGrp     &= ~bit;
+    }
+#endif
 }
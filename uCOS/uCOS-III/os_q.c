@@ -587,6 +587,104 @@ void  *OSQPend (OS_Q         *p_q,
 }
 
 
+/*
+************************************************************************************************************************
+*                                       PEND ON A QUEUE FOR SEVERAL MESSAGES
+*
+* Description: This function waits for a message to be sent to a queue, like OSQPend(), then also takes the messages
+*              queued behind it, up to 'n_max' messages in all.  A consumer that handles bursts gets the whole burst
+*              with one call and at most one context switch.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+*              p_msg_tbl     is a table of 'n_max' entries that receives the messages, oldest first
+*
+*              p_size_tbl    is a table of 'n_max' entries that receives the size of each message
+*
+*              n_max         is the largest number of messages to take
+*
+*              timeout       is an optional timeout period (in clock ticks) for the first message, as with OSQPend()
+*
+*              opt           determines whether the user wants to block if the queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received messages
+*                                OS_ERR_PTR_INVALID        If 'p_msg_tbl' or 'p_size_tbl' is a NULL pointer
+*                                OS_ERR_Q_SIZE             If 'n_max' is 0
+*
+*                                or any of the errors returned by OSQPend() when no message was received.
+*
+* Returns    : The number of messages received, 0 upon error.
+*
+* Note(s)    : 1) The messages after the first one are those already queued, this function only blocks for the first.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY  OSQPendN (OS_Q         *p_q,
+                      void        **p_msg_tbl,
+                      OS_MSG_SIZE  *p_size_tbl,
+                      OS_MSG_QTY    n_max,
+                      OS_TICK       timeout,
+                      OS_OPT        opt,
+                      OS_ERR       *p_err)
+{
+    OS_MSG_QTY  nbr;
+    OS_ERR      err;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if ((p_msg_tbl  == (void **)0) ||                           /* Validate arguments                                   */
+        (p_size_tbl == (OS_MSG_SIZE *)0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (n_max == 0u) {
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+#endif
+
+    p_msg_tbl[0] = OSQPend(p_q,                                 /* Wait for the first message                           */
+                           timeout,
+                           opt,
+                          &p_size_tbl[0],
+                           (CPU_TS *)0,
+                           p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return (0u);
+    }
+
+    nbr = 1u;
+    CPU_CRITICAL_ENTER();
+    while (nbr < n_max) {                                       /* Take the messages queued behind it                   */
+        p_msg_tbl[nbr] = OS_MsgQGet(&p_q->MsgQ,
+                                    &p_size_tbl[nbr],
+                                    (CPU_TS *)0,
+                                    &err);
+        if (err != OS_ERR_NONE) {                               /* Queue is empty                                       */
+            break;
+        }
+        nbr++;
+    }
+    CPU_CRITICAL_EXIT();
+    return (nbr);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                             ABORT WAITING ON A MESSAGE QUEUE
@@ -833,6 +931,20 @@ void  OSQPost (OS_Q         *p_q,
         return;
     }
 #endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        OS_IntQPost(OS_OBJ_TYPE_Q,                              /* Post to ISR queue                                    */
+                    (void *)p_q,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    p_err);
+        OS_TRACE_Q_POST_EXIT(*p_err);
+        return;
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
@@ -885,6 +997,204 @@ void  OSQPost (OS_Q         *p_q,
 }
 
 
+/*
+************************************************************************************************************************
+*                                           POST SEVERAL MESSAGES TO A QUEUE
+*
+* Description: This function sends 'n' messages to a queue in a single call.  Each message goes to the highest priority
+*              task still waiting on the queue and the messages left over once no task is waiting are queued, in
+*              table order.  The result is the same as 'n' calls to OSQPost() but the scheduler runs only once, after
+*              all the messages have been posted.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_msg_tbl     is a table of the 'n' messages to send
+*
+*              p_size_tbl    is a table of the size of each message (in bytes), or a NULL pointer if all the messages
+*                            have a size of 0.
+*
+*              n             is the number of messages to send
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_FIFO         POST messages to the end of the queue (FIFO)
+*                                OS_OPT_POST_LIFO         POST messages to the front of the queue (LIFO), the last
+*                                                         message of the table ends up first
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the other options.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and all the messages were sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place a message into
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_PTR_INVALID       If 'p_msg_tbl' is a NULL pointer
+*                                OS_ERR_Q_MAX             If the queue is full
+*
+* Returns    : The number of messages sent.  On OS_ERR_Q_MAX or OS_ERR_MSG_POOL_EMPTY the messages from that number on
+*              were not sent.
+*
+* Note(s)    : 1) Like OS_OPT_POST_ALL, the whole batch is posted in a single critical section.
+*
+*              2) From an ISR, with OS_CFG_ISR_POST_DEFERRED_EN, each message takes an entry in the ISR queue.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY  OSQPostN (OS_Q          *p_q,
+                      void   *const *p_msg_tbl,
+                      OS_MSG_SIZE   *p_size_tbl,
+                      OS_MSG_QTY     n,
+                      OS_OPT         opt,
+                      OS_ERR        *p_err)
+{
+    OS_OPT         post_type;
+    OS_PEND_LIST  *p_pend_list;
+    OS_MSG_QTY     nbr;
+    OS_MSG_SIZE    msg_size;
+    CPU_BOOLEAN    rdy;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_Q_POST_ENTER(p_q, p_msg_tbl, n, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_msg_tbl == (void *const *)0) {                        /* Validate 'p_msg_tbl'                                 */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_PTR_INVALID);
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_Q_POST_FAILED(p_q);
+             OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+       *p_err = OS_ERR_NONE;
+        for (nbr = 0u; nbr < n; nbr++) {                        /* Post each message to ISR queue                       */
+            if (p_size_tbl != (OS_MSG_SIZE *)0) {
+                msg_size = p_size_tbl[nbr];
+            } else {
+                msg_size = 0u;
+            }
+            OS_IntQPost(OS_OBJ_TYPE_Q,
+                        (void *)p_q,
+                        p_msg_tbl[nbr],
+                        msg_size,
+                        0u,
+                        opt,
+                        p_err);
+            if (*p_err != OS_ERR_NONE) {
+                break;
+            }
+        }
+        OS_TRACE_Q_POST_EXIT(*p_err);
+        return (nbr);
+    }
+#endif
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    if ((opt & OS_OPT_POST_LIFO) == 0u) {                       /* Determine whether we post FIFO or LIFO               */
+        post_type = OS_OPT_POST_FIFO;
+    } else {
+        post_type = OS_OPT_POST_LIFO;
+    }
+
+    OS_TRACE_Q_POST(p_q);
+
+    rdy    = DEF_FALSE;
+   *p_err  = OS_ERR_NONE;
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_q->PendList;
+    for (nbr = 0u; nbr < n; nbr++) {
+        if (p_size_tbl != (OS_MSG_SIZE *)0) {
+            msg_size = p_size_tbl[nbr];
+        } else {
+            msg_size = 0u;
+        }
+        if (p_pend_list->HeadPtr != (OS_TCB *)0) {              /* Any task waiting on message queue?                   */
+            OS_Post((OS_PEND_OBJ *)((void *)p_q),               /* Yes, highest priority one gets the message           */
+                    p_pend_list->HeadPtr,
+                    p_msg_tbl[nbr],
+                    msg_size,
+                    ts);
+            rdy = DEF_TRUE;
+        } else {
+            OS_MsgQPut(&p_q->MsgQ,                              /* No,  place message in the message queue              */
+                       p_msg_tbl[nbr],
+                       msg_size,
+                       post_type,
+                       ts,
+                       p_err);
+            if (*p_err != OS_ERR_NONE) {                        /* Queue full or out of OS_MSGs                         */
+                break;
+            }
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((rdy == DEF_TRUE) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler once for the whole batch           */
+    }
+
+    OS_TRACE_Q_POST_EXIT(*p_err);
+    return (nbr);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                        CLEAR THE CONTENTS OF A MESSAGE QUEUE
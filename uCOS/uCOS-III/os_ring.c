@@ -0,0 +1,735 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                     SINGLE PRODUCER, SINGLE CONSUMER RING MANAGEMENT
+*
+* File    : OS_RING.C
+* Version : V3.08.00
+*
+* A ring carries fixed size elements from one producer to one consumer through a power of 2 array and two free
+* running counters.  The producer only writes 'In' and the consumer only writes 'Out', so a push or a pop is a copy
+* and a counter update with no critical section.  Either side may be an ISR.
+*
+* The consumer can block on an empty ring.  It re-checks the ring with interrupts disabled before it blocks, and a
+* producer only calls the kernel when it finds the consumer blocked, that is on the empty to non-empty transition.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_ring__c = "$Id: $";
+#endif
+
+#if (OS_CFG_RING_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_RingCopy (void         *p_dest,
+                           const void   *p_src,
+                           OS_MSG_SIZE   size);
+
+
+/*
+************************************************************************************************************************
+*                                                    CREATE A RING
+*
+* Description: This function creates a single producer, single consumer ring of fixed size elements.
+*
+* Arguments  : p_ring        is a pointer to the ring to initialize.  Your application is responsible for allocating
+*                            storage for the ring.
+*
+*              p_name        is a pointer to an ASCII string that will be used to name the ring
+*
+*              p_storage     is a pointer to the element storage, 'nbr_elem' * 'elem_size' bytes.  With elements a
+*                            multiple of 4 bytes, storage aligned on 4 bytes lets elements be copied a word at a time.
+*
+*              nbr_elem      is the capacity of the ring in elements, a power of 2
+*
+*              elem_size     is the size of an element in bytes
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful
+*                                OS_ERR_CREATE_ISR              Can't create from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the ring after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_ring'
+*                                OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_storage'
+*                                OS_ERR_Q_SIZE                  If 'nbr_elem' is not a power of 2 or 'elem_size' is 0
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSRingCreate (OS_RING      *p_ring,
+                    CPU_CHAR     *p_name,
+                    void         *p_storage,
+                    OS_MSG_QTY    nbr_elem,
+                    OS_MSG_SIZE   elem_size,
+                    OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_ring == (OS_RING *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_storage == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if ((nbr_elem == 0u) ||                                     /* Capacity must be a power of 2                        */
+        ((nbr_elem & (nbr_elem - 1u)) != 0u) ||
+        (elem_size == 0u)) {
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_ring->Type       = OS_OBJ_TYPE_RING;                      /* Mark the data structure as a ring                    */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_ring->NamePtr    = p_name;                                /* Save the name of the ring                            */
+#else
+    (void)p_name;
+#endif
+    p_ring->StoragePtr = (CPU_INT08U *)p_storage;
+    p_ring->Mask       = (CPU_INT32U)nbr_elem - 1u;
+    p_ring->ElemSize   = elem_size;
+    p_ring->In         = 0u;
+    p_ring->Out        = 0u;
+    OS_PendListInit(&p_ring->PendList);                         /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_RingDbgListAdd(p_ring);
+    OSRingQty++;
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    DELETE A RING
+*
+* Description: This function deletes a ring.  The elements still in the ring are discarded.
+*
+* Arguments  : p_ring        is a pointer to the ring you want to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the ring ONLY if the consumer is not waiting
+*                                OS_OPT_DEL_ALWAYS           Deletes the ring even if the consumer is waiting.
+*                                                            In this case, the consumer will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the ring was deleted
+*                                OS_ERR_DEL_ISR                 If you tried to delete the ring from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the ring after you called
+*                                                                 OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If you pass a NULL pointer for 'p_ring'
+*                                OS_ERR_OBJ_TYPE                If 'p_ring' is not pointing at a ring
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            The consumer was waiting on the ring
+*
+* Returns    : == 0          if the consumer was not waiting on the ring, or upon error.
+*              >  0          if the consumer waiting on the ring is now readied and informed.
+*
+* Note(s)    : 1) The producer and the consumer MUST not use the ring once it is deleted.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RING_DEL_EN == DEF_ENABLED)
+OS_OBJ_QTY  OSRingDel (OS_RING  *p_ring,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't delete a ring from an ISR                      */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_ring == (OS_RING *)0) {                               /* Validate 'p_ring'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_ring->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete ring only if the consumer is not waiting      */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+                 OS_RingDbgListRemove(p_ring);
+                 OSRingQty--;
+#endif
+                 OS_RingClr(p_ring);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the ring                               */
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Ready the consumer                                   */
+                 p_tcb = p_pend_list->HeadPtr;
+                 OS_PendAbort(p_tcb,
+                              0u,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+             OS_RingDbgListRemove(p_ring);
+             OSRingQty--;
+#endif
+             OS_RingClr(p_ring);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              TAKE AN ELEMENT FROM A RING
+*
+* Description: This function copies the oldest element of a ring to 'p_elem' and frees its slot.  It must only be
+*              called by the ring's consumer.
+*
+* Arguments  : p_ring        is a pointer to the ring
+*
+*              p_elem        is a pointer to where the element is copied, 'elem_size' bytes
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for an
+*                            element up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever or, until an element is pushed.
+*
+*              opt           determines whether the user wants to block if the ring is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING     Only this option may be used from an ISR
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and an element was copied
+*                                OS_ERR_OBJ_DEL            If 'p_ring' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_ring'
+*                                OS_ERR_OBJ_TYPE           If 'p_ring' is not pointing at a ring
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you tried to block from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the ring was empty
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_elem'
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            No element was pushed within the specified timeout
+*
+* Returns    : none
+*
+* Note(s)    : 1) Only an empty ring enters the kernel.  The ring is checked again with interrupts disabled before
+*                 the consumer blocks, so a push that lands in between is not missed.
+************************************************************************************************************************
+*/
+
+void  OSRingPop (OS_RING   *p_ring,
+                 void      *p_elem,
+                 OS_TICK    timeout,
+                 OS_OPT     opt,
+                 OS_ERR    *p_err)
+{
+    CPU_INT32U  out;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_ring == (OS_RING *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_elem == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    out = p_ring->Out;
+    if (p_ring->In == out) {                                    /* Ring empty?                                          */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {           /* Yes, caller wants to block?                          */
+           *p_err = OS_ERR_PEND_WOULD_BLOCK;                    /* No                                                   */
+            return;
+        }
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+        if (OSIntNestingCtr > 0u) {                             /* Not allowed to block in an ISR                       */
+           *p_err = OS_ERR_PEND_ISR;
+            return;
+        }
+#endif
+        CPU_CRITICAL_ENTER();
+        if (p_ring->In == out) {                                /* Still empty?                          See Note #1    */
+            if (OSSchedLockNestingCtr > 0u) {                   /* Can't pend when the scheduler is locked              */
+                CPU_CRITICAL_EXIT();
+               *p_err = OS_ERR_SCHED_LOCKED;
+                return;
+            }
+            OS_Pend((OS_PEND_OBJ *)((void *)p_ring),            /* Block the consumer until the next push               */
+                    OS_TASK_PEND_ON_RING,
+                    timeout);
+            CPU_CRITICAL_EXIT();
+            OSSched();                                          /* Find the next highest priority task ready to run     */
+
+            CPU_CRITICAL_ENTER();
+            switch (OSTCBCurPtr->PendStatus) {
+                case OS_STATUS_PEND_OK:                         /* An element was pushed                                */
+                    *p_err = OS_ERR_NONE;
+                     break;
+
+                case OS_STATUS_PEND_ABORT:                      /* Indicate that we aborted                             */
+                    *p_err = OS_ERR_PEND_ABORT;
+                     break;
+
+                case OS_STATUS_PEND_TIMEOUT:                    /* Indicate that we didn't get an element within TO     */
+                    *p_err = OS_ERR_TIMEOUT;
+                     break;
+
+                case OS_STATUS_PEND_DEL:                        /* Indicate that the ring was deleted                   */
+                    *p_err = OS_ERR_OBJ_DEL;
+                     break;
+
+                default:
+                    *p_err = OS_ERR_STATUS_INVALID;
+                     break;
+            }
+            CPU_CRITICAL_EXIT();
+            if (*p_err != OS_ERR_NONE) {
+                return;
+            }
+        } else {
+            CPU_CRITICAL_EXIT();
+        }
+    }
+
+    CPU_RMB();                                                  /* Read the element after seeing it published           */
+    OS_RingCopy(p_elem,
+               &p_ring->StoragePtr[(out & p_ring->Mask) * p_ring->ElemSize],
+                p_ring->ElemSize);
+    CPU_MB();                                                   /* Element read before its slot is given back           */
+    p_ring->Out = out + 1u;
+   *p_err       = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               PUT AN ELEMENT IN A RING
+*
+* Description: This function copies an element to a ring.  It must only be called by the ring's producer, which can be
+*              a task or an ISR.  If the consumer is blocked on the empty ring, it is readied.
+*
+* Arguments  : p_ring        is a pointer to the ring
+*
+*              p_elem        is a pointer to the element to copy, 'elem_size' bytes
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE         No option specified
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler when the consumer is readied
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the element was put in the ring
+*                                OS_ERR_INT_Q_FULL        The element was put in the ring but the ISR queue could not
+*                                                         take the consumer's wakeup, the next push retries it
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_ring' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If 'p_ring' is not pointing at a ring
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_PTR_INVALID       If 'p_elem' is a NULL pointer
+*                                OS_ERR_Q_FULL            If the ring is full, the element was not put in the ring
+*
+* Returns    : none
+*
+* Note(s)    : 1) The consumer blocks with interrupts disabled and only after seeing 'In' unchanged, so once 'In' is
+*                 published an empty pend list means the consumer will see the element without being readied.
+************************************************************************************************************************
+*/
+
+void  OSRingPush (OS_RING   *p_ring,
+                  void      *p_elem,
+                  OS_OPT     opt,
+                  OS_ERR    *p_err)
+{
+    CPU_INT32U  in;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_ring == (OS_RING *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_elem == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    in = p_ring->In;
+    if ((in - p_ring->Out) > p_ring->Mask) {                    /* Ring full?                                           */
+       *p_err = OS_ERR_Q_FULL;
+        return;
+    }
+    OS_RingCopy(&p_ring->StoragePtr[(in & p_ring->Mask) * p_ring->ElemSize],
+                 p_elem,
+                 p_ring->ElemSize);
+    CPU_WMB();                                                  /* Write the element before publishing it               */
+    p_ring->In = in + 1u;
+    CPU_MB();                                                   /* Publish before looking for the consumer See Note #1  */
+
+   *p_err = OS_ERR_NONE;
+    if (p_ring->PendList.HeadPtr != (OS_TCB *)0) {              /* Consumer blocked on the empty ring?                  */
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+        if (OSIntNestingCtr > 0u) {                             /* Yes, from an ISR the wakeup goes to the ISR queue    */
+            OS_IntQPost(OS_OBJ_TYPE_RING,
+                        (void *)p_ring,
+                        (void *)0,
+                        0u,
+                        0u,
+                        opt,
+                        p_err);
+            return;
+        }
+#endif
+        OS_RingPost(p_ring, opt);                               /* Yes, ready it                                        */
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    CLEAR A RING
+*
+* Description: This function is called by OSRingDel() to clear the contents of a ring
+*
+
+* Argument(s): p_ring    is a pointer to the ring to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RingClr (OS_RING  *p_ring)
+{
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_ring->Type       =  OS_OBJ_TYPE_NONE;                     /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_ring->NamePtr    = (CPU_CHAR *)((void *)"?RING");
+#endif
+    p_ring->StoragePtr = (CPU_INT08U *)0;
+    p_ring->Mask       =  0u;
+    p_ring->ElemSize   =  0u;
+    p_ring->In         =  0u;
+    p_ring->Out        =  0u;
+    OS_PendListInit(&p_ring->PendList);                         /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                           READY THE CONSUMER WAITING ON A RING
+*
+* Description: This function readies the consumer blocked on an empty ring once an element has been pushed.  It is
+*              called by OSRingPush() and, for pushes made from ISRs, by the ISR handler task.
+*
+* Argument(s): p_ring    is a pointer to the ring
+*              ------
+*
+*              opt       OS_OPT_POST_NO_SCHED to not call the scheduler
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The consumer may have been readied already, by an earlier push, a timeout or an abort.
+************************************************************************************************************************
+*/
+
+void  OS_RingPost (OS_RING  *p_ring,
+                   OS_OPT    opt)
+{
+    OS_TCB  *p_tcb;
+    CPU_TS   ts;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_ring->PendList.HeadPtr;
+    if (p_tcb == (OS_TCB *)0) {                                 /* Still waiting?                       See Note #2     */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+    OS_Post((OS_PEND_OBJ *)((void *)p_ring),
+            p_tcb,
+            (void *)0,
+            0u,
+            ts);
+    CPU_CRITICAL_EXIT();
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                               COPY A RING ELEMENT
+*
+* Description: This function copies an element to or from a ring, a word at a time when the size and both addresses
+*              allow it.
+*
+* Argument(s): p_dest    is a pointer to the destination
+*
+*              p_src     is a pointer to the source
+*
+*              size      is the element size in bytes
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_RingCopy (void         *p_dest,
+                           const void   *p_src,
+                           OS_MSG_SIZE   size)
+{
+    CPU_INT32U        *p_dest32;
+    const CPU_INT32U  *p_src32;
+    CPU_INT08U        *p_dest08;
+    const CPU_INT08U  *p_src08;
+
+
+    if ((((CPU_ADDR)p_dest | (CPU_ADDR)p_src | (CPU_ADDR)size) & (sizeof(CPU_INT32U) - 1u)) == 0u) {
+        p_dest32 = (CPU_INT32U *)p_dest;
+        p_src32  = (const CPU_INT32U *)p_src;
+        while (size > 0u) {
+           *p_dest32++ = *p_src32++;
+            size      -= (OS_MSG_SIZE)sizeof(CPU_INT32U);
+        }
+    } else {
+        p_dest08 = (CPU_INT08U *)p_dest;
+        p_src08  = (const CPU_INT08U *)p_src;
+        while (size > 0u) {
+           *p_dest08++ = *p_src08++;
+            size--;
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                        ADD/REMOVE RING TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a ring to/from the debug list.
+*
+* Arguments  : p_ring    is a pointer to the ring to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void  OS_RingDbgListAdd (OS_RING  *p_ring)
+{
+    p_ring->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_ring->DbgPrevPtr               = (OS_RING *)0;
+    if (OSRingDbgListPtr == (OS_RING *)0) {
+        p_ring->DbgNextPtr           = (OS_RING *)0;
+    } else {
+        p_ring->DbgNextPtr           =  OSRingDbgListPtr;
+        OSRingDbgListPtr->DbgPrevPtr =  p_ring;
+    }
+    OSRingDbgListPtr                 =  p_ring;
+}
+
+
+void  OS_RingDbgListRemove (OS_RING  *p_ring)
+{
+    OS_RING  *p_ring_next;
+    OS_RING  *p_ring_prev;
+
+
+    p_ring_prev = p_ring->DbgPrevPtr;
+    p_ring_next = p_ring->DbgNextPtr;
+
+    if (p_ring_prev == (OS_RING *)0) {
+        OSRingDbgListPtr = p_ring_next;
+        if (p_ring_next != (OS_RING *)0) {
+            p_ring_next->DbgPrevPtr = (OS_RING *)0;
+        }
+        p_ring->DbgNextPtr = (OS_RING *)0;
+
+    } else if (p_ring_next == (OS_RING *)0) {
+        p_ring_prev->DbgNextPtr = (OS_RING *)0;
+        p_ring->DbgPrevPtr      = (OS_RING *)0;
+
+    } else {
+        p_ring_prev->DbgNextPtr =  p_ring_next;
+        p_ring_next->DbgPrevPtr =  p_ring_prev;
+        p_ring->DbgNextPtr      = (OS_RING *)0;
+        p_ring->DbgPrevPtr      = (OS_RING *)0;
+    }
+}
+#endif
+#endif
@@ -0,0 +1,1009 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                           READER-WRITER LOCK MANAGEMENT
+*
+* File    : OS_RWLOCK.C
+* Version : V3.08.00
+*
+* A reader-writer lock lets any number of readers, or one writer, hold it.  Its state is one word: the number of
+* readers, a bit set while a writer holds the lock and a bit set while tasks may be waiting.  A reader takes or
+* releases the lock with a compare and swap of that word while neither bit is set, so readers of read-mostly data do
+* not serialize and do not enter the kernel.  A writer takes a free lock the same way.
+*
+* Writers are preferred: once a writer waits, arriving readers wait too, so a writer only waits for the readers that
+* held the lock when it arrived and for the readers of higher priority queued ahead of it.  Waiters are handed the
+* lock in priority order when it becomes free: either the highest priority writer, or every reader queued ahead of
+* the highest priority writer.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_rwlock__c = "$Id: $";
+#endif
+
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                     LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#define  OS_RWLOCK_WR                    0x80000000u            /* A writer holds the lock                              */
+#define  OS_RWLOCK_WAIT                  0x40000000u            /* Tasks may be waiting, readers must enter the kernel  */
+#define  OS_RWLOCK_RD_MASK               0x3FFFFFFFu            /* Number of readers holding the lock                   */
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_RWLockGrant      (OS_RWLOCK  *p_lock);
+
+static  OS_ERR      OS_RWLockPendStatus (void);
+
+
+/*
+************************************************************************************************************************
+*                                             CREATE A READER-WRITER LOCK
+*
+* Description: This function creates a reader-writer lock.
+*
+* Arguments  : p_lock        is a pointer to the lock to initialize.  Your application is responsible for allocating
+*                            storage for the lock.
+*
+*              p_name        is a pointer to the name you would like to give the lock.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the lock after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSRWLockCreate (OS_RWLOCK  *p_lock,
+                      CPU_CHAR   *p_name,
+                      OS_ERR     *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_lock->Type        =  OS_OBJ_TYPE_RWLOCK;                  /* Mark the data structure as a reader-writer lock      */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_lock->NamePtr     =  p_name;
+#else
+    (void)p_name;
+#endif
+    p_lock->State       =           0u;                         /* Lock is available                                    */
+    p_lock->OwnerTCBPtr = (OS_TCB *)0;
+    OS_PendListInit(&p_lock->PendList);                         /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_RWLockDbgListAdd(p_lock);
+    OSRWLockQty++;
+#endif
+
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             DELETE A READER-WRITER LOCK
+*
+* Description: This function deletes a reader-writer lock and readies all tasks pending on it.
+*
+* Arguments  : p_lock        is a pointer to the lock to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the lock ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the lock even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the lock was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the lock from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the lock after you called
+*                                                                 OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_lock' is not pointing to a reader-writer lock
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            One or more tasks were waiting on the lock
+*
+* Returns    : == 0          if no tasks were waiting on the lock, or upon error.
+*              >  0          if one or more tasks waiting on the lock are now readied and informed.
+*
+* Note(s)    : 1) Tasks that hold the lock MUST not release it once it is deleted.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RWLOCK_DEL_EN == DEF_ENABLED)
+OS_OBJ_QTY  OSRWLockDel (OS_RWLOCK  *p_lock,
+                         OS_OPT      opt,
+                         OS_ERR     *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a lock from an ISR             */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_lock->Type != OS_OBJ_TYPE_RWLOCK) {                   /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_lock->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete lock only if no task waiting                  */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+                 OS_RWLockDbgListRemove(p_lock);
+                 OSRWLockQty--;
+#endif
+                 OS_RWLockClr(p_lock);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the lock                               */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             ts = OS_TS_GET();                                  /* Get timestamp                                        */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
+                 p_tcb = p_pend_list->HeadPtr;
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+             OS_RWLockDbgListRemove(p_lock);
+             OSRWLockQty--;
+#endif
+             OS_RWLockClr(p_lock);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 TAKE A LOCK TO READ
+*
+* Description: This function waits for a reader-writer lock to be free of writers and counts the caller as a reader.
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            lock up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever or, until the lock is handed to it.
+*
+*              opt           determines whether the user wants to block if the lock is not available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the caller is a reader
+*                                OS_ERR_MUTEX_OWNER        If the caller holds the lock as the writer
+*                                OS_ERR_OBJ_DEL            If 'p_lock' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the lock was not
+*                                                          available
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            The lock was not received within the specified timeout
+*
+* Returns    : none
+*
+* Note(s)    : 1) With no writer holding or waiting, the reader count is raised with OS_CPU_CAS32() and the kernel is not
+*                 entered.  A port without OS_CPU_CAS32() always takes the critical section.
+*
+*              2) A task that already reads MUST not take the lock again to read.  A writer that arrived in between
+*                 would make it wait for itself.
+*
+*              3) Readers are not known to the kernel, so a writer that waits does not lend them its priority.  A task
+*                 MUST not be deleted while it holds the lock.
+************************************************************************************************************************
+*/
+
+void  OSRWLockPendRd (OS_RWLOCK  *p_lock,
+                      OS_TICK     timeout,
+                      OS_OPT      opt,
+                      OS_ERR     *p_err)
+{
+    CPU_INT32U  state;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_lock->Type != OS_OBJ_TYPE_RWLOCK) {                   /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#ifdef OS_CPU_CAS32
+    state = p_lock->State;
+    while ((state & (OS_RWLOCK_WR | OS_RWLOCK_WAIT)) == 0u) {   /* No writer holding or waiting?            See Note #1 */
+        if (OS_CPU_CAS32(&p_lock->State, state, state + 1u) != 0) {
+           *p_err = OS_ERR_NONE;                                /* Yes, one more reader                                 */
+            return;
+        }
+        state = p_lock->State;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    state = p_lock->State;
+    if (((state & OS_RWLOCK_WR) == 0u) &&                       /* Free for readers and nobody waiting?                 */
+        (p_lock->PendList.HeadPtr == (OS_TCB *)0)) {
+        p_lock->State = (state & OS_RWLOCK_RD_MASK) + 1u;       /* Yes, also clears a stale wait bit                    */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if (p_lock->OwnerTCBPtr == OSTCBCurPtr) {                   /* Would the writer wait for itself?                    */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_OWNER;
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return;
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+
+    p_lock->State = state | OS_RWLOCK_WAIT;                     /* Send the next readers and writers to the kernel      */
+    OS_Pend((OS_PEND_OBJ *)((void *)p_lock),                    /* Block task pending on the lock                       */
+             OS_TASK_PEND_ON_RWLOCK_RD,
+             timeout);
+
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+   *p_err = OS_RWLockPendStatus();                              /* Already counted as a reader when handed the lock     */
+}
+
+
+/*
+************************************************************************************************************************
+*                                               RELEASE A LOCK AFTER READING
+*
+* Description: This function removes the caller from the readers of a reader-writer lock.  The last reader hands the
+*              lock to the tasks waiting on it.
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              opt           is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                                OS_OPT_POST_NONE        No special option selected
+*                                OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful
+*                                OS_ERR_MUTEX_NOT_OWNER    If the lock has no reader
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_POST_ISR           If you attempted to post from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) With nobody waiting, the reader count is lowered with OS_CPU_CAS32() and the kernel is not entered.
+************************************************************************************************************************
+*/
+
+void  OSRWLockPostRd (OS_RWLOCK  *p_lock,
+                      OS_OPT      opt,
+                      OS_ERR     *p_err)
+{
+    CPU_INT32U  state;
+    OS_OBJ_QTY  nbr_tasks;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_lock->Type != OS_OBJ_TYPE_RWLOCK) {                   /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#ifdef OS_CPU_CAS32
+    state = p_lock->State;
+    while (((state & (OS_RWLOCK_WR | OS_RWLOCK_WAIT)) == 0u) && /* Readers only and nobody waiting?         See Note #1 */
+           ((state & OS_RWLOCK_RD_MASK) != 0u)) {
+        if (OS_CPU_CAS32(&p_lock->State, state, state - 1u) != 0) {
+           *p_err = OS_ERR_NONE;                                /* Yes, one less reader                                 */
+            return;
+        }
+        state = p_lock->State;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    state = p_lock->State;
+    if (((state & OS_RWLOCK_WR)      != 0u) ||                  /* Make sure the lock is held by readers                */
+        ((state & OS_RWLOCK_RD_MASK) == 0u)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_NOT_OWNER;
+        return;
+    }
+
+    state--;
+    if ((state & OS_RWLOCK_RD_MASK) != 0u) {                    /* Other readers left?                                  */
+        p_lock->State = state;                                  /* Yes, they release it                                 */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    nbr_tasks = OS_RWLockGrant(p_lock);                         /* No, hand the lock to the waiters                     */
+    CPU_CRITICAL_EXIT();
+
+    if ((nbr_tasks > 0u) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 TAKE A LOCK TO WRITE
+*
+* Description: This function waits for a reader-writer lock to be free and makes the caller its writer.
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            lock up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever or, until the lock is handed to it.
+*
+*              opt           determines whether the user wants to block if the lock is not available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the caller is the writer
+*                                OS_ERR_MUTEX_OWNER        If the caller already holds the lock as the writer
+*                                OS_ERR_OBJ_DEL            If 'p_lock' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the lock was not
+*                                                          available
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            The lock was not received within the specified timeout
+*
+* Returns    : none
+*
+* Note(s)    : 1) A free lock is taken with OS_CPU_CAS32() without entering the kernel.
+*
+*              2) A waiting writer sets the wait bit, so readers that arrive after it wait as well.
+************************************************************************************************************************
+*/
+
+void  OSRWLockPendWr (OS_RWLOCK  *p_lock,
+                      OS_TICK     timeout,
+                      OS_OPT      opt,
+                      OS_ERR     *p_err)
+{
+    CPU_INT32U  state;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_lock->Type != OS_OBJ_TYPE_RWLOCK) {                   /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#ifdef OS_CPU_CAS32
+    if (OS_CPU_CAS32(&p_lock->State, 0u, OS_RWLOCK_WR) != 0) {  /* Free?                                    See Note #1 */
+        p_lock->OwnerTCBPtr = OSTCBCurPtr;                      /* Yes, caller is the writer                            */
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    state = p_lock->State;
+    if ((state & (OS_RWLOCK_WR | OS_RWLOCK_RD_MASK)) == 0u) {   /* Resource available?                                  */
+        p_lock->State       = state | OS_RWLOCK_WR;             /* Yes, caller may proceed                              */
+        p_lock->OwnerTCBPtr = OSTCBCurPtr;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if (p_lock->OwnerTCBPtr == OSTCBCurPtr) {                   /* See if current task is already the writer            */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_OWNER;
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return;
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+
+    p_lock->State = state | OS_RWLOCK_WAIT;                     /* Stop new readers                         See Note #2 */
+    OS_Pend((OS_PEND_OBJ *)((void *)p_lock),                    /* Block task pending on the lock                       */
+             OS_TASK_PEND_ON_RWLOCK_WR,
+             timeout);
+
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+   *p_err = OS_RWLockPendStatus();                              /* Already the writer when handed the lock              */
+}
+
+
+/*
+************************************************************************************************************************
+*                                               RELEASE A LOCK AFTER WRITING
+*
+* Description: This function releases a reader-writer lock held by the caller as the writer and hands it to the
+*              tasks waiting on it.
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              opt           is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                                OS_OPT_POST_NONE        No special option selected
+*                                OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful
+*                                OS_ERR_MUTEX_NOT_OWNER    If the caller is not the writer
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_POST_ISR           If you attempted to post from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) With nobody waiting, the lock is freed with OS_CPU_CAS32().  The owner is cleared first, a task that
+*                 preempts in between still finds the writer bit set and cannot take the lock.
+************************************************************************************************************************
+*/
+
+void  OSRWLockPostWr (OS_RWLOCK  *p_lock,
+                      OS_OPT      opt,
+                      OS_ERR     *p_err)
+{
+    OS_OBJ_QTY  nbr_tasks;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_lock->Type != OS_OBJ_TYPE_RWLOCK) {                   /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#ifdef OS_CPU_CAS32
+    if (p_lock->OwnerTCBPtr == OSTCBCurPtr) {                   /* Nobody waiting?                          See Note #1 */
+        p_lock->OwnerTCBPtr = (OS_TCB *)0;
+        if (OS_CPU_CAS32(&p_lock->State, OS_RWLOCK_WR, 0u) != 0) {
+           *p_err = OS_ERR_NONE;                                /* Yes, the lock is free                                */
+            return;
+        }
+        p_lock->OwnerTCBPtr = OSTCBCurPtr;                      /* No, hand it over in the kernel                       */
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OSTCBCurPtr != p_lock->OwnerTCBPtr) {                   /* Make sure the writer is releasing the lock           */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_NOT_OWNER;
+        return;
+    }
+
+    p_lock->OwnerTCBPtr = (OS_TCB *)0;
+    nbr_tasks           = OS_RWLockGrant(p_lock);               /* Hand the lock to the waiters                         */
+    CPU_CRITICAL_EXIT();
+
+    if ((nbr_tasks > 0u) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                       CLEAR THE CONTENTS OF A READER-WRITER LOCK
+*
+* Description: This function is called by OSRWLockDel() to clear the contents of a reader-writer lock
+*
+* Argument(s): p_lock       is a pointer to the lock to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockClr (OS_RWLOCK  *p_lock)
+{
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_lock->Type        =  OS_OBJ_TYPE_NONE;                    /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_lock->NamePtr     = (CPU_CHAR *)((void *)"?RWLOCK");
+#endif
+    p_lock->State       =           0u;
+    p_lock->OwnerTCBPtr = (OS_TCB *)0;
+    OS_PendListInit(&p_lock->PendList);                         /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                    ADD/REMOVE READER-WRITER LOCK TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a reader-writer lock to/from the debug list.
+*
+* Arguments  : p_lock      is a pointer to the lock to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void  OS_RWLockDbgListAdd (OS_RWLOCK  *p_lock)
+{
+    p_lock->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_lock->DbgPrevPtr               = (OS_RWLOCK *)0;
+    if (OSRWLockDbgListPtr == (OS_RWLOCK *)0) {
+        p_lock->DbgNextPtr           = (OS_RWLOCK *)0;
+    } else {
+        p_lock->DbgNextPtr           =  OSRWLockDbgListPtr;
+        OSRWLockDbgListPtr->DbgPrevPtr =  p_lock;
+    }
+    OSRWLockDbgListPtr               =  p_lock;
+}
+
+
+void  OS_RWLockDbgListRemove (OS_RWLOCK  *p_lock)
+{
+    OS_RWLOCK  *p_lock_next;
+    OS_RWLOCK  *p_lock_prev;
+
+
+    p_lock_prev = p_lock->DbgPrevPtr;
+    p_lock_next = p_lock->DbgNextPtr;
+
+    if (p_lock_prev == (OS_RWLOCK *)0) {
+        OSRWLockDbgListPtr = p_lock_next;
+        if (p_lock_next != (OS_RWLOCK *)0) {
+            p_lock_next->DbgPrevPtr = (OS_RWLOCK *)0;
+        }
+        p_lock->DbgNextPtr = (OS_RWLOCK *)0;
+
+    } else if (p_lock_next == (OS_RWLOCK *)0) {
+        p_lock_prev->DbgNextPtr = (OS_RWLOCK *)0;
+        p_lock->DbgPrevPtr      = (OS_RWLOCK *)0;
+
+    } else {
+        p_lock_prev->DbgNextPtr =  p_lock_next;
+        p_lock_next->DbgPrevPtr =  p_lock_prev;
+        p_lock->DbgNextPtr      = (OS_RWLOCK *)0;
+        p_lock->DbgPrevPtr      = (OS_RWLOCK *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          HAND A FREE LOCK TO THE WAITING TASKS
+*
+* Description: This function is called when the last holder releases a reader-writer lock.  If the highest priority
+*              waiter is a writer, it becomes the owner.  Otherwise every reader queued ahead of the highest priority
+*              writer is readied and counted as a reader.
+*
+* Argument(s): p_lock       is a pointer to the lock, held by nobody
+*
+* Returns    : The number of tasks readied.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Called with interrupts disabled.  The wait bit is left set while tasks still wait.
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_RWLockGrant (OS_RWLOCK  *p_lock)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_OBJ_QTY     nbr_tasks;
+    CPU_INT32U     state;
+    CPU_TS         ts;
+
+
+    p_pend_list = &p_lock->PendList;
+    p_tcb       =  p_pend_list->HeadPtr;
+    nbr_tasks   =  0u;
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any task waiting on the lock?                        */
+        p_lock->State = 0u;                                     /* No, the lock is free                                 */
+        return (0u);
+    }
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_RWLOCK_WR) {           /* Highest priority waiter is a writer?                 */
+        state               = OS_RWLOCK_WR;                     /* Yes, give it the lock                                */
+        p_lock->OwnerTCBPtr = p_tcb;
+        OS_Post((OS_PEND_OBJ *)((void *)p_lock),
+                               p_tcb,
+                               (void *)0,
+                               0u,
+                               ts);
+        nbr_tasks = 1u;
+    } else {
+        while ((p_tcb != (OS_TCB *)0) &&                        /* No, ready the readers ahead of the first writer      */
+               (p_tcb->PendOn == OS_TASK_PEND_ON_RWLOCK_RD)) {
+            OS_Post((OS_PEND_OBJ *)((void *)p_lock),
+                                   p_tcb,
+                                   (void *)0,
+                                   0u,
+                                   ts);
+            nbr_tasks++;
+            p_tcb = p_pend_list->HeadPtr;
+        }
+        state = (CPU_INT32U)nbr_tasks;
+    }
+
+    if (p_pend_list->HeadPtr != (OS_TCB *)0) {                  /* Tasks still waiting?                 See Note #2     */
+        state |= OS_RWLOCK_WAIT;
+    }
+    p_lock->State = state;
+    return (nbr_tasks);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            STATUS OF A PEND ON A LOCK
+*
+* Description: This function returns the error code for how the current task's pend on a reader-writer lock ended.
+*
+* Argument(s): none
+*
+* Returns    : OS_ERR_NONE, OS_ERR_PEND_ABORT, OS_ERR_TIMEOUT, OS_ERR_OBJ_DEL or OS_ERR_STATUS_INVALID
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  OS_ERR  OS_RWLockPendStatus (void)
+{
+    OS_ERR  err;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* We were handed the lock                              */
+             err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get the lock within timeout  */
+             err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (err);
+}
+#endif
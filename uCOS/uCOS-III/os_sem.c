@@ -732,6 +732,20 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
         return (0u);
     }
 #endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        OS_IntQPost(OS_OBJ_TYPE_SEM,                            /* Post to ISR queue                                    */
+                    (void *)p_sem,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    p_err);
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
@@ -783,6 +797,164 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
 }
 
 
+/*
+************************************************************************************************************************
+*                                              POST SEVERAL COUNTS TO A SEMAPHORE
+*
+* Description: This function signals a semaphore 'cnt' times in a single call.  Each count readies the highest priority
+*              task still waiting on the semaphore and the counts left over once no task is waiting are added to the
+*              semaphore counter.  The result is the same as 'cnt' calls to OSSemPost() with OS_OPT_POST_1 but the
+*              scheduler runs only once, after all the counts have been posted.
+*
+* Arguments  : p_sem    is a pointer to the semaphore
+*
+*              cnt      is the number of counts to post
+*
+*              opt      determines the type of POST performed:
+*
+*                           OS_OPT_POST_NONE         No option
+*                           OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE              The call was successful and the semaphore was signaled
+*                           OS_ERR_OBJ_PTR_NULL      If 'p_sem' is a NULL pointer
+*                           OS_ERR_OBJ_TYPE          If 'p_sem' is not pointing at a semaphore
+*                           OS_ERR_OPT_INVALID       If you specified an invalid option
+*                           OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                           OS_ERR_SEM_OVF           If the counts left over would overflow the semaphore count, in
+*                                                    which case nothing is posted
+*
+* Returns    : The current value of the semaphore counter or 0 upon error.
+*
+* Note(s)    : 1) Like OS_OPT_POST_ALL, the tasks are readied in a single critical section, one task per count.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+OS_SEM_CTR  OSSemPostN (OS_SEM      *p_sem,
+                        OS_SEM_CTR   cnt,
+                        OS_OPT       opt,
+                        OS_ERR      *p_err)
+{
+    OS_SEM_CTR     ctr;
+    OS_PEND_LIST  *p_pend_list;
+    CPU_BOOLEAN    rdy;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_SEM_POST_ENTER(p_sem, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_sem == (OS_SEM *)0) {                                 /* Validate 'p_sem'                                     */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err  = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_SEM_POST_FAILED(p_sem);
+             OS_TRACE_SEM_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Make sure semaphore was created                      */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        if (cnt == 0u) {                                        /* 'Flags' of 0 would be taken for an OSSemPost()       */
+           *p_err = OS_ERR_NONE;
+            OS_TRACE_SEM_POST_EXIT(*p_err);
+            return (0u);
+        }
+        OS_IntQPost(OS_OBJ_TYPE_SEM,                            /* Post to ISR queue, the count goes in 'Flags'         */
+                    (void *)p_sem,
+                    (void *)0,
+                    0u,
+                    (OS_FLAGS)cnt,
+                    opt,
+                    p_err);
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    OS_TRACE_SEM_POST(p_sem);
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_sem->PendList;
+    if ((p_pend_list->HeadPtr == (OS_TCB *)0) &&                /* Would the counter overflow?                          */
+        (cnt > ((OS_SEM_CTR)-1 - p_sem->Ctr))) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SEM_OVF;
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+    rdy = DEF_FALSE;
+    while ((cnt > 0u) &&                                        /* One count per waiting task, highest priority first   */
+           (p_pend_list->HeadPtr != (OS_TCB *)0)) {
+        OS_Post((OS_PEND_OBJ *)((void *)p_sem),                 /* Removes the task from the pend list                  */
+                p_pend_list->HeadPtr,
+                (void *)0,
+                0u,
+                ts);
+        cnt--;
+        rdy = DEF_TRUE;
+    }
+    if (cnt > 0u) {                                             /* Counts left over go to the semaphore                 */
+        p_sem->Ctr += cnt;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        p_sem->TS   = ts;
+#endif
+    }
+    ctr = p_sem->Ctr;
+    CPU_CRITICAL_EXIT();
+    if ((rdy == DEF_TRUE) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler once for the whole batch           */
+    }
+   *p_err = OS_ERR_NONE;
+
+    OS_TRACE_SEM_POST_EXIT(*p_err);
+    return (ctr);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                    SET SEMAPHORE
@@ -63,7 +63,7 @@ const  CPU_CHAR  *os_task__c = "$Id: $";
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) A task moved to a priority other than OS_CFG_SCHED_EDF_PRIO stops being an EDF task.
 ************************************************************************************************************************
 */
 
@@ -115,6 +115,12 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
         p_tcb = OSTCBCurPtr;
     }
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (prio_new != OS_CFG_SCHED_EDF_PRIO) {                    /* Leaving the EDF scheduling class?                    */
+        p_tcb->EdfPeriod = 0u;
+    }
+#endif
+
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
     p_tcb->BasePrio = prio_new;                                 /* Update base priority                                 */
 
@@ -126,6 +132,11 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
             }
         }
     }
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)
+    if (prio_new > p_tcb->CeilingPrio) {                        /* Stay at the ceiling of the ceiling mutexes held      */
+        prio_new = p_tcb->CeilingPrio;
+    }
+#endif
 #endif
 
     OS_TaskChangePrio(p_tcb, prio_new);
@@ -571,6 +582,10 @@ void  OSTaskDel (OS_TCB  *p_tcb,
                  case OS_TASK_PEND_ON_FLAG:                     /* Remove from pend list                                */
                  case OS_TASK_PEND_ON_Q:
                  case OS_TASK_PEND_ON_SEM:
+                 case OS_TASK_PEND_ON_RING:
+                 case OS_TASK_PEND_ON_MUTEX_PCP:
+                 case OS_TASK_PEND_ON_RWLOCK_RD:
+                 case OS_TASK_PEND_ON_RWLOCK_WR:
                       OS_PendListRemove(p_tcb);
                       break;
 
@@ -617,6 +632,12 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     }
 #endif
 
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)
+    if (p_tcb->MutexPcpHeadPtr != (OS_MUTEX_PCP *)0) {          /* Release the ceiling mutexes the task holds           */
+        OS_MutexPcpPostAll(p_tcb);
+    }
+#endif
+
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
     (void)OS_MsgQFreeAll(&p_tcb->MsgQ);                         /* Free task's message queue messages                   */
 #endif
@@ -648,6 +669,250 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                          MAKE A TASK AN EARLIEST DEADLINE FIRST TASK
+*
+* Description: This function places a periodic task in the EDF scheduling class.  EDF tasks all run at priority
+*              OS_CFG_SCHED_EDF_PRIO and, among themselves, the task whose current job has the earliest absolute
+*              deadline runs first.  Tasks at higher priorities preempt them and tasks at lower priorities only run
+*              when no EDF task is ready, as with any other priority.
+*
+* Arguments  : p_tcb      is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you wish to
+*                         change the calling task.
+*
+*              period     is the period of the task, in ticks
+*
+*              deadline   is the deadline of each job, in ticks from its release.  It cannot be more than 'period'.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    If the call was successful
+*                             OS_ERR_EDF_DEADLINE_INVALID    If 'deadline' is 0 or greater than 'period'
+*                             OS_ERR_EDF_PERIOD_INVALID      If 'period' is 0
+*                             OS_ERR_OS_NOT_RUNNING          If 'p_tcb' is NULL and uC/OS-III is not running yet
+*                             OS_ERR_STATE_INVALID           If the task is in an invalid state
+*                             OS_ERR_TASK_CHANGE_PRIO_ISR    If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The current job of the task is considered released by this call.  The task then calls OSTaskEdfWait()
+*                 at the end of every job to wait for the release of the next one, 'period' ticks after the previous
+*                 release.
+*
+*              2) OSTaskChangePrio() to a priority other than OS_CFG_SCHED_EDF_PRIO takes the task out of the EDF
+*                 class.  The priority the task was created with is not remembered.
+*
+*              3) Mutex priority inheritance still works across priorities.  Between two EDF tasks there is no
+*                 deadline inheritance, a job holding a mutex needed by a job with an earlier deadline runs by its
+*                 own deadline.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+void  OSTaskEdfSet (OS_TCB   *p_tcb,
+                    OS_TICK   period,
+                    OS_TICK   deadline,
+                    OS_ERR   *p_err)
+{
+    OS_TICK   tick_ctr;
+    OS_PRIO   prio_new;
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    OS_PRIO   prio_high;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_CHANGE_PRIO_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if ((p_tcb != (OS_TCB *)0) && (p_tcb->TaskState == OS_TASK_STATE_DEL)) {
+       *p_err = OS_ERR_STATE_INVALID;
+        return;
+    }
+    if (period == 0u) {                                         /* Validate the period and the deadline                 */
+       *p_err = OS_ERR_EDF_PERIOD_INVALID;
+        return;
+    }
+    if ((deadline == 0u) || (deadline > period)) {
+       *p_err = OS_ERR_EDF_DEADLINE_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Are we changing 'self'?                              */
+        if (OSRunning != OS_STATE_OS_RUNNING) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_OS_NOT_RUNNING;
+            return;
+        }
+        p_tcb = OSTCBCurPtr;
+    }
+
+#if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    tick_ctr = BSP_OS_TickGet();
+#else
+    tick_ctr = OSTickCtr;
+#endif
+    p_tcb->EdfPeriod      = period;                             /* The current job is released now      See Note #1     */
+    p_tcb->EdfDeadlineRel = deadline;
+    p_tcb->EdfRelease     = tick_ctr;
+    p_tcb->EdfDeadline    = tick_ctr + deadline;
+    p_tcb->EdfMissCtr     = 0u;
+
+    prio_new = OS_CFG_SCHED_EDF_PRIO;
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    p_tcb->BasePrio = prio_new;                                 /* Update base priority                                 */
+
+    if (p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) {              /* Owning a mutex?                                      */
+        if (prio_new > p_tcb->Prio) {
+            prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
+            if (prio_new > prio_high) {
+                prio_new = prio_high;
+            }
+        }
+    }
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)
+    if (prio_new > p_tcb->CeilingPrio) {                        /* Stay at the ceiling of the ceiling mutexes held      */
+        prio_new = p_tcb->CeilingPrio;
+    }
+#endif
+#endif
+
+    OS_TaskChangePrio(p_tcb, prio_new);                         /* Also re-sorts a task that was already an EDF task    */
+
+    OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio_new);
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OSSched();                                              /* Run highest priority task ready                      */
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        END THE CURRENT JOB OF AN EARLIEST DEADLINE FIRST TASK
+*
+* Description: This function is called by an EDF task when its current job is done.  The task is delayed until the
+*              release of its next job, 'period' ticks after the release of the current one, and the deadline of the
+*              next job is set for when it is readied.
+*
+* Arguments  : p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    If the call was successful
+*                             OS_ERR_EDF_TASK_INVALID        If the calling task is not an EDF task
+*                             OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                             OS_ERR_SCHED_LOCKED            If the scheduler is locked
+*                             OS_ERR_TIME_DLY_ISR            If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) A job done after its deadline is counted in the task's .EdfMissCtr.
+*
+*              2) When the next release has already passed, the next job starts at once.  Releases more than a whole
+*                 period late are skipped, so that the task does not run a backlog of jobs, and are counted as missed.
+*
+*              3) The task leaves the ready list only after the tick list insert.  With OS_CFG_DYN_TICK_EN, the insert
+*                 reads the tick counter again and finds the release already passed if a tick elapsed since it was
+*                 read above.  The task is then put back in the ready list by its new deadline.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+void  OSTaskEdfWait (OS_ERR  *p_err)
+{
+    OS_TCB   *p_tcb;
+    OS_TICK   tick_ctr;
+    OS_TICK   release;
+    OS_TICK   skip;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't delay when the scheduler is locked             */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->EdfPeriod == 0u) {                               /* Only EDF tasks have jobs                             */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_EDF_TASK_INVALID;
+        return;
+    }
+
+#if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    tick_ctr = BSP_OS_TickGet();
+#else
+    tick_ctr = OSTickCtr;
+#endif
+    if (OS_TICK_BEFORE(p_tcb->EdfDeadline, tick_ctr) == DEF_TRUE) {
+        p_tcb->EdfMissCtr++;                                    /* Job done after its deadline          See Note #1     */
+    }
+
+    release = p_tcb->EdfRelease + p_tcb->EdfPeriod;
+    if (OS_TICK_BEFORE(release, tick_ctr) == DEF_TRUE) {        /* Next release already passed?         See Note #2     */
+        skip = (tick_ctr - release) / p_tcb->EdfPeriod;         /* Yes, skip the releases a whole period late           */
+        release           += skip * p_tcb->EdfPeriod;
+        p_tcb->EdfMissCtr += skip;
+    }
+    p_tcb->EdfRelease  = release;
+    p_tcb->EdfDeadline = release + p_tcb->EdfDeadlineRel;
+
+    OS_TickListInsertDly(p_tcb,                                 /* Wait for the release of the next job     See Note #3 */
+                         release,
+                         OS_OPT_TIME_MATCH,
+                         p_err);
+    OS_RdyListRemove(p_tcb);                                    /* Leave the ready list with the old deadline           */
+    if (*p_err == OS_ERR_TIME_ZERO_DLY) {
+        OS_RdyListInsert(p_tcb);                                /* Next job released, back by its new deadline          */
+       *p_err = OS_ERR_NONE;
+    }
+    CPU_CRITICAL_EXIT();
+
+    OSSched();                                                  /* Find next task to run!                               */
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                    FLUSH TASK's QUEUE
@@ -914,6 +1179,101 @@ void  *OSTaskQPend (OS_TICK       timeout,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                              WAIT FOR SEVERAL MESSAGES
+*
+* Description: This function waits for a message to be posted to the current task, like OSTaskQPend(), then also takes
+*              the messages queued behind it, up to 'n_max' messages in all.
+*
+* Arguments  : p_msg_tbl     is a table of 'n_max' entries that receives the messages, oldest first
+*
+*              p_size_tbl    is a table of 'n_max' entries that receives the size of each message
+*
+*              n_max         is the largest number of messages to take
+*
+*              timeout       is an optional timeout period (in clock ticks) for the first message, as with
+*                            OSTaskQPend()
+*
+*              opt           determines whether the user wants to block if the task's queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_err         is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                                OS_ERR_NONE               The call was successful and your task received messages
+*                                OS_ERR_PTR_INVALID        If 'p_msg_tbl' or 'p_size_tbl' is a NULL pointer
+*                                OS_ERR_Q_SIZE             If 'n_max' is 0
+*
+*                                or any of the errors returned by OSTaskQPend() when no message was received.
+*
+* Returns    : The number of messages received, 0 upon error.
+*
+* Note(s)    : 1) The messages after the first one are those already queued, this function only blocks for the first.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY  OSTaskQPendN (void        **p_msg_tbl,
+                          OS_MSG_SIZE  *p_size_tbl,
+                          OS_MSG_QTY    n_max,
+                          OS_TICK       timeout,
+                          OS_OPT        opt,
+                          OS_ERR       *p_err)
+{
+    OS_MSG_QTY  nbr;
+    OS_ERR      err;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if ((p_msg_tbl  == (void **)0) ||                           /* Validate arguments                                   */
+        (p_size_tbl == (OS_MSG_SIZE *)0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (n_max == 0u) {
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+#endif
+
+    p_msg_tbl[0] = OSTaskQPend(timeout,                         /* Wait for the first message                           */
+                               opt,
+                              &p_size_tbl[0],
+                               (CPU_TS *)0,
+                               p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return (0u);
+    }
+
+    nbr = 1u;
+    CPU_CRITICAL_ENTER();
+    while (nbr < n_max) {                                       /* Take the messages queued behind it                   */
+        p_msg_tbl[nbr] = OS_MsgQGet(&OSTCBCurPtr->MsgQ,
+                                    &p_size_tbl[nbr],
+                                    (CPU_TS *)0,
+                                    &err);
+        if (err != OS_ERR_NONE) {                               /* Queue is empty                                       */
+            break;
+        }
+        nbr++;
+    }
+    CPU_CRITICAL_EXIT();
+    return (nbr);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                              ABORT WAITING FOR A MESSAGE
@@ -1106,6 +1466,23 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        if (p_tcb == (OS_TCB *)0) {                             /* Resolve 'self' now, not in the ISR handler task      */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_MSG,                       /* Post to ISR queue                                    */
+                    (void *)p_tcb,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    p_err);
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+        return;
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
@@ -1169,6 +1546,204 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                           POST SEVERAL MESSAGES TO A TASK
+*
+* Description: This function sends 'n' messages to a task in a single call.  If the task is waiting for a message, the
+*              first message readies it and the others are queued, in table order.  The result is the same as 'n'
+*              calls to OSTaskQPost() but the scheduler runs only once, after all the messages have been posted.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task receiving the messages.  If you specify a NULL pointer
+*                         then the messages will be posted to the task's queue of the calling task.
+*
+*              p_msg_tbl  is a table of the 'n' messages to send
+*
+*              p_size_tbl is a table of the size of each message (in bytes), or a NULL pointer if all the messages have
+*                         a size of 0.
+*
+*              n          is the number of messages to send
+*
+*              opt        specifies whether the post will be FIFO or LIFO:
+*
+*                             OS_OPT_POST_FIFO       Post at the end   of the queue
+*                             OS_OPT_POST_LIFO       Post at the front of the queue
+*
+*                             OS_OPT_POST_NO_SCHED   Do not run the scheduler after the post
+*
+*                          Note(s): 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*
+*              p_err      is a pointer to a variable that will hold the error code associated
+*                         with the outcome of this call.  Errors can be:
+*
+*                             OS_ERR_NONE              The call was successful and all the messages were sent
+*                             OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs available from the pool
+*                             OS_ERR_OPT_INVALID       If you specified an invalid option
+*                             OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                             OS_ERR_PTR_INVALID       If 'p_msg_tbl' is a NULL pointer
+*                             OS_ERR_Q_MAX             If the queue is full
+*                             OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
+*                                                      and if it does, would be considered a system failure
+*
+* Returns    : The number of messages sent.  On OS_ERR_Q_MAX or OS_ERR_MSG_POOL_EMPTY the messages from that number on
+*              were not sent.
+*
+* Note(s)    : 1) The whole batch is posted in a single critical section.
+*
+*              2) From an ISR, with OS_CFG_ISR_POST_DEFERRED_EN, each message takes an entry in the ISR queue.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY  OSTaskQPostN (OS_TCB         *p_tcb,
+                          void    *const *p_msg_tbl,
+                          OS_MSG_SIZE    *p_size_tbl,
+                          OS_MSG_QTY      n,
+                          OS_OPT          opt,
+                          OS_ERR         *p_err)
+{
+    OS_MSG_QTY   nbr;
+    OS_MSG_SIZE  msg_size;
+    CPU_BOOLEAN  rdy;
+    CPU_TS       ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_TASK_MSG_Q_POST_ENTER(&p_tcb->MsgQ, p_msg_tbl, n, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_msg_tbl == (void *const *)0) {
+        OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_PTR_INVALID);
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* User must supply a valid option                      */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+             OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        if (p_tcb == (OS_TCB *)0) {                             /* Resolve 'self' now, not in the ISR handler task      */
+            p_tcb = OSTCBCurPtr;
+        }
+       *p_err = OS_ERR_NONE;
+        for (nbr = 0u; nbr < n; nbr++) {                        /* Post each message to ISR queue                       */
+            if (p_size_tbl != (OS_MSG_SIZE *)0) {
+                msg_size = p_size_tbl[nbr];
+            } else {
+                msg_size = 0u;
+            }
+            OS_IntQPost(OS_OBJ_TYPE_TASK_MSG,
+                        (void *)p_tcb,
+                        p_msg_tbl[nbr],
+                        msg_size,
+                        0u,
+                        opt,
+                        p_err);
+            if (*p_err != OS_ERR_NONE) {
+                break;
+            }
+        }
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+        return (nbr);
+    }
+#endif
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    OS_TRACE_TASK_MSG_Q_POST(&p_tcb->MsgQ);
+
+    rdy    = DEF_FALSE;
+   *p_err  = OS_ERR_NONE;                                       /* Assume we won't have any errors                      */
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Post msgs to 'self'?                                 */
+        p_tcb = OSTCBCurPtr;
+    }
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+        case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+        case OS_TASK_STATE_PEND:
+        case OS_TASK_STATE_PEND_TIMEOUT:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             for (nbr = 0u; nbr < n; nbr++) {
+                 if (p_size_tbl != (OS_MSG_SIZE *)0) {
+                     msg_size = p_size_tbl[nbr];
+                 } else {
+                     msg_size = 0u;
+                 }
+                 if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) { /* Is task waiting for a message to be sent to it?      */
+                     OS_Post((OS_PEND_OBJ *)0,                  /* Yes, the first message readies it                    */
+                              p_tcb,
+                              p_msg_tbl[nbr],
+                              msg_size,
+                              ts);
+                     rdy = DEF_TRUE;
+                 } else {
+                     OS_MsgQPut(&p_tcb->MsgQ,                   /* No,  deposit the message in the task's queue         */
+                                p_msg_tbl[nbr],
+                                msg_size,
+                                opt,
+                                ts,
+                                p_err);
+                     if (*p_err != OS_ERR_NONE) {               /* Queue full or out of OS_MSGs                         */
+                         break;
+                     }
+                 }
+             }
+             CPU_CRITICAL_EXIT();
+             if ((rdy == DEF_TRUE) &&
+                 ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+                 OSSched();                                     /* Run the scheduler once for the whole batch           */
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+             nbr    = 0u;
+            *p_err  = OS_ERR_STATE_INVALID;
+             break;
+    }
+
+    OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+    return (nbr);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                       GET THE CURRENT VALUE OF A TASK REGISTER
@@ -1838,6 +2413,24 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if ((OSIntNestingCtr > 0u) &&                               /* See if called from an ISR, kernel tasks signaled ... */
+        (OS_IntQSignalDirect(p_tcb) == DEF_FALSE)) {            /* ... by the ISR queue or the tick go direct           */
+        if (p_tcb == (OS_TCB *)0) {                             /* Resolve 'self' now, not in the ISR handler task      */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_SIGNAL,                    /* Post to ISR queue                                    */
+                    (void *)p_tcb,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    p_err);
+        OS_TRACE_TASK_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
@@ -2546,6 +3139,14 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->TimeQuantaCtr        =                     0u;
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    p_tcb->EdfPeriod            =                     0u;
+    p_tcb->EdfDeadlineRel       =                     0u;
+    p_tcb->EdfRelease           =                     0u;
+    p_tcb->EdfDeadline          =                     0u;
+    p_tcb->EdfMissCtr           =                     0u;
+#endif
+
 #if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)
     p_tcb->CPUUsage             =                     0u;
     p_tcb->CPUUsageMax          =                     0u;
@@ -2578,6 +3179,10 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->BasePrio             =  OS_PRIO_INIT;
     p_tcb->MutexGrpHeadPtr      = (OS_MUTEX         *)0;
 #endif
+#if (OS_CFG_MUTEX_PCP_EN == DEF_ENABLED)
+    p_tcb->MutexPcpHeadPtr      = (OS_MUTEX_PCP     *)0;
+    p_tcb->CeilingPrio          = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     p_tcb->DbgPrevPtr           = (OS_TCB           *)0;
@@ -2772,6 +3377,10 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
                      case OS_TASK_PEND_ON_FLAG:
                      case OS_TASK_PEND_ON_Q:
                      case OS_TASK_PEND_ON_SEM:
+                     case OS_TASK_PEND_ON_RING:
+                     case OS_TASK_PEND_ON_MUTEX_PCP:
+                     case OS_TASK_PEND_ON_RWLOCK_RD:
+                     case OS_TASK_PEND_ON_RWLOCK_WR:
                           OS_PendListChangePrio(p_tcb);
                           break;
 
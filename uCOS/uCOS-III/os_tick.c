@@ -48,6 +48,8 @@ const  CPU_CHAR  *os_tick__c = "$Id: $";
 
 static  CPU_TS  OS_TickListUpdateDly     (OS_TICK ticks);
 static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK ticks);
+static  void    OS_TickDlyExpire         (OS_TCB *p_tcb);
+static  void    OS_TickTimeoutExpire     (OS_TCB *p_tcb);
 
 /*
 ************************************************************************************************************************
@@ -99,6 +101,9 @@ void  OS_TickTask (void  *p_arg)
             tick_step = 1u;                                     /* Always tick once when dynamic tick is disabled       */
             OSTickCtr++;                                        /* Keep track of the number of ticks                    */
 #endif
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
+            OSTickWheelCtr++;                                   /* Advance the wheel once for both lists                */
+#endif
 
             OS_TRACE_TICK_INCREMENT(OSTickCtr);
 
@@ -154,6 +159,11 @@ void  OS_TickTask (void  *p_arg)
 
 void  OS_TickTaskInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
+    CPU_INT32U  spoke;
+
+
+#endif
     OSTickCtr                    = 0u;                          /* Clear the tick counter                               */
 
 #if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
@@ -161,8 +171,16 @@ void  OS_TickTaskInit (OS_ERR  *p_err)
     OSTickCtrPend                = 0u;
 #endif
 
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
+    OSTickWheelCtr               = 0u;
+    for (spoke = 0u; spoke < OS_CFG_TICK_WHEEL_SIZE; spoke++) {
+        OSTickListDly.WheelTbl[spoke]     = (OS_TCB *)0;
+        OSTickListTimeout.WheelTbl[spoke] = (OS_TCB *)0;
+    }
+#else
     OSTickListDly.TCB_Ptr        = (OS_TCB *)0;
     OSTickListTimeout.TCB_Ptr    = (OS_TCB *)0;
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OSTickListDly.NbrEntries     = 0u;
@@ -225,6 +243,32 @@ void  OS_TickTaskInit (OS_ERR  *p_err)
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
+void  OS_TickListInsert (OS_TICK_LIST  *p_list,
+                         OS_TCB        *p_tcb,
+                         OS_TICK        time)
+{
+    OS_TCB  **p_spoke;
+
+
+    if (time == 0u) {                                           /* Expire on the next tick, as the delta list does      */
+        time = 1u;
+    }
+    p_tcb->TickRemain  = time;
+    p_tcb->TickMatch   = OSTickWheelCtr + time;                 /* Absolute expiry, hashed to a spoke                   */
+    p_spoke            = &p_list->WheelTbl[p_tcb->TickMatch & (OS_CFG_TICK_WHEEL_SIZE - 1u)];
+    p_tcb->TickPrevPtr = (OS_TCB *)0;                           /* Add to the head of the spoke, spokes are unsorted    */
+    p_tcb->TickNextPtr = *p_spoke;
+    if (*p_spoke != (OS_TCB *)0) {
+        (*p_spoke)->TickPrevPtr = p_tcb;
+    }
+   *p_spoke            = p_tcb;
+    p_tcb->TickListPtr = p_list;                                /* Link to this list                                    */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_list->NbrEntries++;
+#endif
+}
+#else
 void  OS_TickListInsert (OS_TICK_LIST  *p_list,
                          OS_TCB        *p_tcb,
                          OS_TICK        time)
@@ -314,6 +358,7 @@ void  OS_TickListInsert (OS_TICK_LIST  *p_list,
     }
 #endif
 }
+#endif
 
 /*
 ************************************************************************************************************************
@@ -419,6 +464,34 @@ void  OS_TickListInsertDly (OS_TCB   *p_tcb,
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
+void  OS_TickListRemove (OS_TCB  *p_tcb)
+{
+    OS_TICK_LIST  *p_list;
+    OS_TCB        *p_tcb1;
+    OS_TCB        *p_tcb2;
+
+
+    p_list = p_tcb->TickListPtr;
+    p_tcb1 = p_tcb->TickPrevPtr;
+    p_tcb2 = p_tcb->TickNextPtr;
+    if (p_tcb1 == (OS_TCB *)0) {                                /* Head of its spoke?                                   */
+        p_list->WheelTbl[p_tcb->TickMatch & (OS_CFG_TICK_WHEEL_SIZE - 1u)] = p_tcb2;
+    } else {
+        p_tcb1->TickNextPtr = p_tcb2;
+    }
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb1;
+    }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_list->NbrEntries--;
+#endif
+    p_tcb->TickPrevPtr = (OS_TCB       *)0;
+    p_tcb->TickNextPtr = (OS_TCB       *)0;
+    p_tcb->TickRemain  =                 0u;
+    p_tcb->TickListPtr = (OS_TICK_LIST *)0;
+}
+#else
 void  OS_TickListRemove (OS_TCB  *p_tcb)
 {
     OS_TICK_LIST  *p_list;
@@ -463,6 +536,7 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
         p_tcb->TickListPtr  = (OS_TICK_LIST *)0;
     }
 }
+#endif
 
 /*
 ************************************************************************************************************************
@@ -478,6 +552,52 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
+static  CPU_TS  OS_TickListUpdateDly (OS_TICK  ticks)
+{
+    OS_TCB       *p_tcb;
+    OS_TCB       *p_tcb_next;
+    OS_TICK_LIST *p_list;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS        ts_start;
+    CPU_TS        ts_delta_dly;
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_OBJ_QTY    nbr_updated;
+#endif
+
+
+    (void)ticks;                                                /* Wheel is advanced one tick at a time by OS_TickTask()*/
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts_start    = OS_TS_GET();
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    nbr_updated = 0u;
+#endif
+    p_list      = &OSTickListDly;
+    p_tcb       = p_list->WheelTbl[OSTickWheelCtr & (OS_CFG_TICK_WHEEL_SIZE - 1u)];
+    while (p_tcb != (OS_TCB *)0) {                              /* Only this spoke can hold entries expiring now        */
+        p_tcb_next = p_tcb->TickNextPtr;
+        if (p_tcb->TickMatch == OSTickWheelCtr) {               /* Others are one or more revolutions away              */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+            nbr_updated++;
+#endif
+            OS_TickListRemove(p_tcb);
+            OS_TickDlyExpire(p_tcb);
+        }
+        p_tcb = p_tcb_next;
+    }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_list->NbrUpdated = nbr_updated;
+#endif
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts_delta_dly = OS_TS_GET() - ts_start;                      /* Measure execution time of the update                 */
+    return (ts_delta_dly);
+#else
+    return (0u);
+#endif
+}
+#else
 static  CPU_TS  OS_TickListUpdateDly (OS_TICK  ticks)
 {
     OS_TCB       *p_tcb;
@@ -511,15 +631,7 @@ static  CPU_TS  OS_TickListUpdateDly (OS_TICK  ticks)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
             nbr_updated++;                                      /* Keep track of the number of TCBs updated             */
 #endif
-            if (p_tcb->TaskState == OS_TASK_STATE_DLY) {
-                p_tcb->TaskState = OS_TASK_STATE_RDY;
-                OS_RdyListInsert(p_tcb);                        /* Insert the task in the ready list                    */
-
-            } else {
-                if (p_tcb->TaskState == OS_TASK_STATE_DLY_SUSPENDED) {
-                    p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
-                }
-            }
+            OS_TickDlyExpire(p_tcb);
 
             p_list->TCB_Ptr = p_tcb->TickNextPtr;
             p_tcb           = p_list->TCB_Ptr;                  /* Get 'p_tcb' again for loop                           */
@@ -556,6 +668,7 @@ static  CPU_TS  OS_TickListUpdateDly (OS_TICK  ticks)
     return (0u);
 #endif
 }
+#endif
 
 
 /*
@@ -572,9 +685,11 @@ static  CPU_TS  OS_TickListUpdateDly (OS_TICK  ticks)
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_WHEEL_EN == DEF_ENABLED)
 static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK  ticks)
 {
     OS_TCB       *p_tcb;
+    OS_TCB       *p_tcb_next;
     OS_TICK_LIST *p_list;
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     CPU_TS        ts_start;
@@ -583,9 +698,49 @@ static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK  ticks)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_OBJ_QTY    nbr_updated;
 #endif
-#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
-    OS_TCB       *p_tcb_owner;
-    OS_PRIO       prio_new;
+
+
+    (void)ticks;                                                /* Wheel is advanced one tick at a time by OS_TickTask()*/
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts_start    = OS_TS_GET();
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    nbr_updated = 0u;
+#endif
+    p_list      = &OSTickListTimeout;
+    p_tcb       = p_list->WheelTbl[OSTickWheelCtr & (OS_CFG_TICK_WHEEL_SIZE - 1u)];
+    while (p_tcb != (OS_TCB *)0) {                              /* Only this spoke can hold entries expiring now        */
+        p_tcb_next = p_tcb->TickNextPtr;
+        if (p_tcb->TickMatch == OSTickWheelCtr) {               /* Others are one or more revolutions away              */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+            nbr_updated++;
+#endif
+            OS_TickListRemove(p_tcb);
+            OS_TickTimeoutExpire(p_tcb);
+        }
+        p_tcb = p_tcb_next;
+    }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_list->NbrUpdated = nbr_updated;
+#endif
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts_delta_timeout = OS_TS_GET() - ts_start;                  /* Measure execution time of the update                 */
+    return (ts_delta_timeout);
+#else
+    return (0u);
+#endif
+}
+#else
+static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK  ticks)
+{
+    OS_TCB       *p_tcb;
+    OS_TICK_LIST *p_list;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS        ts_start;
+    CPU_TS        ts_delta_timeout;
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_OBJ_QTY    nbr_updated;
 #endif
 
                                                                 /*  ======= UPDATE TASKS WAITING WITH TIMEOUT ========  */
@@ -610,46 +765,7 @@ static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK  ticks)
             nbr_updated++;
 #endif
 
-#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
-            p_tcb_owner = (OS_TCB *)0;
-            if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
-                p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
-            }
-#endif
-
-#if (OS_MSG_EN == DEF_ENABLED)
-            p_tcb->MsgPtr  = (void *)0;
-            p_tcb->MsgSize = 0u;
-#endif
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-            p_tcb->TS      = OS_TS_GET();
-#endif
-            OS_PendListRemove(p_tcb);                           /* Remove task from pend list                           */
-            if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT) {
-                OS_RdyListInsert(p_tcb);                        /* Insert the task in the ready list                    */
-                p_tcb->TaskState  = OS_TASK_STATE_RDY;
-
-            } else {
-                if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED) {
-                    p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
-                }
-            }
-            p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;         /* Indicate pend timed out                              */
-            p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;        /* Indicate no longer pending                           */
-
-#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
-            if (p_tcb_owner != (OS_TCB *)0) {
-                if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
-                    (p_tcb_owner->Prio == p_tcb->Prio)) {       /* Has the owner inherited a priority?                  */
-                    prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
-                    prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
-                    if(prio_new != p_tcb_owner->Prio) {
-                        OS_TaskChangePrio(p_tcb_owner, prio_new);
-                        OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
-                    }
-                }
-            }
-#endif
+            OS_TickTimeoutExpire(p_tcb);
 
             p_list->TCB_Ptr = p_tcb->TickNextPtr;
             p_tcb           = p_list->TCB_Ptr;                  /* Get 'p_tcb' again for loop                           */
@@ -686,3 +802,84 @@ static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK  ticks)
 #endif
 }
 #endif
+
+
+/*
+************************************************************************************************************************
+*                                              EXPIRE A DELAY OR TIMEOUT
+*
+* Description: These functions make a task ready (or just suspended) when its delay, or the timeout of its pend,
+*              expires.  The caller unlinks the task from the tick list.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickDlyExpire (OS_TCB  *p_tcb)
+{
+    if (p_tcb->TaskState == OS_TASK_STATE_DLY) {
+        p_tcb->TaskState = OS_TASK_STATE_RDY;
+        OS_RdyListInsert(p_tcb);                                /* Insert the task in the ready list                    */
+
+    } else {
+        if (p_tcb->TaskState == OS_TASK_STATE_DLY_SUSPENDED) {
+            p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
+        }
+    }
+}
+
+
+static  void  OS_TickTimeoutExpire (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    OS_TCB       *p_tcb_owner;
+    OS_PRIO       prio_new;
+#endif
+
+
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    p_tcb_owner = (OS_TCB *)0;
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
+        p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
+    }
+#endif
+
+#if (OS_MSG_EN == DEF_ENABLED)
+    p_tcb->MsgPtr  = (void *)0;
+    p_tcb->MsgSize = 0u;
+#endif
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_tcb->TS      = OS_TS_GET();
+#endif
+    OS_PendListRemove(p_tcb);                           /* Remove task from pend list                           */
+    if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT) {
+        OS_RdyListInsert(p_tcb);                        /* Insert the task in the ready list                    */
+        p_tcb->TaskState  = OS_TASK_STATE_RDY;
+
+    } else {
+        if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED) {
+            p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+        }
+    }
+    p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;         /* Indicate pend timed out                              */
+    p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;        /* Indicate no longer pending                           */
+
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    if (p_tcb_owner != (OS_TCB *)0) {
+        if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+            (p_tcb_owner->Prio == p_tcb->Prio)) {       /* Has the owner inherited a priority?                  */
+            prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+            prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+            if(prio_new != p_tcb_owner->Prio) {
+                OS_TaskChangePrio(p_tcb_owner, prio_new);
+                OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+            }
+        }
+    }
+#endif
+}
+#endif
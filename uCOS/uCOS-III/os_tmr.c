@@ -185,6 +185,11 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
     p_tmr->CallbackPtrArg =  p_callback_arg;
     p_tmr->NextPtr        = (OS_TMR *)0;
     p_tmr->PrevPtr        = (OS_TMR *)0;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+    p_tmr->Match          =           0u;
+    p_tmr->FireNextPtr    = (OS_TMR *)0;
+    p_tmr->FirePend       =    DEF_FALSE;
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_TmrDbgListAdd(p_tmr);
@@ -394,7 +399,11 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
 
     switch (p_tmr->State) {
         case OS_TMR_STATE_RUNNING:
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+             remain = p_tmr->Match - OSTmrTickCtr;              /* Ticks until the timer task reaches the match         */
+#else
              remain = p_tmr->Remain;
+#endif
             *p_err  = OS_ERR_NONE;
              break;
 
@@ -590,7 +599,9 @@ void  OSTmrSet (OS_TMR               *p_tmr,
 CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
                          OS_ERR  *p_err)
 {
+#if (OS_CFG_TMR_WHEEL_EN == DEF_DISABLED)
     OS_TMR      *p_next;
+#endif
     CPU_BOOLEAN  success;
 
 
@@ -634,11 +645,21 @@ CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
 
     switch (p_tmr->State) {
         case OS_TMR_STATE_RUNNING:                              /* Restart the timer                                    */
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+             OS_TmrUnlink(p_tmr);                               /* Move to the spoke of the new expiry                  */
+             p_tmr->State  = OS_TMR_STATE_RUNNING;
+             if (p_tmr->Dly == 0u) {
+                 OS_TmrWheelLink(p_tmr, p_tmr->Period);
+             } else {
+                 OS_TmrWheelLink(p_tmr, p_tmr->Dly);
+             }
+#else
              if (p_tmr->Dly == 0u) {
                  p_tmr->Remain = p_tmr->Period;
              } else {
                  p_tmr->Remain = p_tmr->Dly;
              }
+#endif
             *p_err         = OS_ERR_NONE;
              success       = DEF_TRUE;
              break;
@@ -646,6 +667,13 @@ CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
         case OS_TMR_STATE_STOPPED:                              /* Start the timer                                      */
         case OS_TMR_STATE_COMPLETED:
              p_tmr->State  = OS_TMR_STATE_RUNNING;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+             if (p_tmr->Dly == 0u) {
+                 OS_TmrWheelLink(p_tmr, p_tmr->Period);
+             } else {
+                 OS_TmrWheelLink(p_tmr, p_tmr->Dly);
+             }
+#else
              if (p_tmr->Dly == 0u) {
                  p_tmr->Remain = p_tmr->Period;
              } else {
@@ -668,6 +696,7 @@ CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
                  OSTmrListEntries++;
 #endif
              }
+#endif
             *p_err   = OS_ERR_NONE;
              success = DEF_TRUE;
              break;
@@ -959,6 +988,10 @@ void  OS_TmrClr (OS_TMR  *p_tmr)
     p_tmr->CallbackPtrArg = (void              *)0;
     p_tmr->NextPtr        = (OS_TMR            *)0;
     p_tmr->PrevPtr        = (OS_TMR            *)0;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+    p_tmr->Match          =                      0u;
+    p_tmr->FirePend       =              DEF_FALSE;             /* FireNextPtr is only used by the timer task           */
+#endif
 }
 
 
@@ -1044,11 +1077,21 @@ void  OS_TmrDbgListRemove (OS_TMR  *p_tmr)
 
 void  OS_TmrInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+    CPU_INT32U  spoke;
+
+
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OSTmrDbgListPtr     = (OS_TMR *)0;
 #endif
 
     OSTmrListPtr        = (OS_TMR *)0;                          /* Create an empty timer list                           */
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+    for (spoke = 0u; spoke < OS_CFG_TMR_WHEEL_SIZE; spoke++) {
+        OSTmrWheelTbl[spoke] = (OS_TMR *)0;
+    }
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OSTmrListEntries    =           0u;
 #endif
@@ -1132,13 +1175,20 @@ void  OS_TmrInit (OS_ERR  *p_err)
 
 void  OS_TmrUnlink (OS_TMR  *p_tmr)
 {
+    OS_TMR **p_list;
     OS_TMR  *p_tmr1;
     OS_TMR  *p_tmr2;
 
 
-    if (OSTmrListPtr == p_tmr) {                                /* See if timer to remove is at the beginning of list   */
-        p_tmr1       = p_tmr->NextPtr;
-        OSTmrListPtr = p_tmr1;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+    p_tmr->FirePend = DEF_FALSE;                                /* Cancel a callback still due in this batch            */
+    p_list          = &OSTmrWheelTbl[p_tmr->Match & (OS_CFG_TMR_WHEEL_SIZE - 1u)];
+#else
+    p_list          = &OSTmrListPtr;
+#endif
+    if (*p_list == p_tmr) {                                     /* See if timer to remove is at the beginning of list   */
+        p_tmr1  = p_tmr->NextPtr;
+       *p_list  = p_tmr1;
         if (p_tmr1 != (OS_TMR *)0) {
             p_tmr1->PrevPtr = (OS_TMR *)0;
         }
@@ -1159,6 +1209,47 @@ void  OS_TmrUnlink (OS_TMR  *p_tmr)
 }
 
 
+
+/*
+************************************************************************************************************************
+*                                           ADD A TIMER TO THE TIMER WHEEL
+*
+* Description: This function is called to link a running timer into the spoke of the timer wheel for its expiry.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to insert.
+*              -----
+*
+*              remain         Is the number of timer ticks until the timer expires, must be > 0.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+void  OS_TmrWheelLink (OS_TMR   *p_tmr,
+                       OS_TICK   remain)
+{
+    OS_TMR  **p_spoke;
+
+
+    p_tmr->Remain   = remain;
+    p_tmr->Match    = OSTmrTickCtr + remain;                    /* Absolute expiry, hashed to a spoke                   */
+    p_tmr->FirePend = DEF_FALSE;                                /* A restart cancels a callback still due               */
+    p_spoke         = &OSTmrWheelTbl[p_tmr->Match & (OS_CFG_TMR_WHEEL_SIZE - 1u)];
+    p_tmr->PrevPtr  = (OS_TMR *)0;                              /* Add to the head of the spoke, spokes are unsorted    */
+    p_tmr->NextPtr  = *p_spoke;
+    if (*p_spoke != (OS_TMR *)0) {
+        (*p_spoke)->PrevPtr = p_tmr;
+    }
+   *p_spoke         = p_tmr;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OSTmrListEntries++;
+#endif
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                 TIMER MANAGEMENT TASK
@@ -1179,6 +1270,9 @@ void  OS_TmrTask (void  *p_arg)
     OS_TMR_CALLBACK_PTR  p_fnct;
     OS_TMR              *p_tmr;
     OS_TMR              *p_tmr_next;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+    OS_TMR              *p_fire;
+#endif
 #if (OS_CFG_DYN_TICK_EN != DEF_ENABLED)
     CPU_TS               ts;
 #endif
@@ -1211,6 +1305,37 @@ void  OS_TmrTask (void  *p_arg)
         ts_start = OS_TS_GET();
 #endif
         OSTmrTickCtr++;                                         /* Increment the current time                           */
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+        p_fire   = (OS_TMR *)0;
+        p_tmr    = OSTmrWheelTbl[OSTmrTickCtr & (OS_CFG_TMR_WHEEL_SIZE - 1u)];
+        while (p_tmr != (OS_TMR *)0) {                          /* Collect the timers expiring on this tick             */
+            p_tmr_next = p_tmr->NextPtr;
+            if (p_tmr->Match == OSTmrTickCtr) {                 /* Others in the spoke are revolutions away             */
+                OS_TmrUnlink(p_tmr);
+                if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
+                    p_tmr->State = OS_TMR_STATE_RUNNING;
+                    OS_TmrWheelLink(p_tmr, p_tmr->Period);      /* Reload the time remaining                            */
+                } else {
+                    p_tmr->State = OS_TMR_STATE_COMPLETED;      /* Indicate that the timer has completed                */
+                }
+                p_tmr->FirePend    = DEF_TRUE;
+                p_tmr->FireNextPtr = p_fire;
+                p_fire             = p_tmr;
+            }
+            p_tmr = p_tmr_next;
+        }
+        while (p_fire != (OS_TMR *)0) {                         /* Run the callbacks as one batch                       */
+            p_tmr  = p_fire;
+            p_fire = p_tmr->FireNextPtr;
+            if (p_tmr->FirePend == DEF_TRUE) {                  /* Not stopped or restarted by an earlier callback      */
+                p_tmr->FirePend = DEF_FALSE;
+                p_fnct = p_tmr->CallbackPtr;                    /* Execute callback function if available               */
+                if (p_fnct != (OS_TMR_CALLBACK_PTR)0u) {
+                    (*p_fnct)(p_tmr, p_tmr->CallbackPtrArg);
+                }
+            }
+        }
+#else
         p_tmr    = OSTmrListPtr;
         while (p_tmr != (OS_TMR *)0) {                          /* Update all the timers in the list                    */
             OSSchedLock(&err);
@@ -1233,6 +1358,7 @@ void  OS_TmrTask (void  *p_arg)
             OSSchedUnlock(&err);
             (void)err;
         }
+#endif
 
 #if (OS_CFG_TS_EN == DEF_ENABLED)
         ts_delta = OS_TS_GET() - ts_start;                      /* Measure execution time of timer task                 */